@@ -0,0 +1,536 @@
+#ifndef VIOLET_BENCH_APP_HPP
+#define VIOLET_BENCH_APP_HPP
+
+#include <Violet.hpp>
+using namespace Violet;
+
+/// <summary>
+/// View size that benchmarks draw at (unless they set their own)
+/// </summary>
+const Size2D<int> BenchViewSize{ Size2D<int>(1280, 720) };
+
+/// <summary>
+/// Get the number of heap allocations made so far
+/// </summary>
+/// <returns>Number of allocations</returns>
+U64 GetAllocationCount();
+
+/// <summary>
+/// Benchmark result
+/// </summary>
+struct BenchResult {
+	/// <summary>
+	/// Benchmark name
+	/// </summary>
+	std::string name;
+
+	/// <summary>
+	/// Frame time statistics
+	/// </summary>
+	FrameTimeStats frameTime;
+
+	/// <summary>
+	/// Number of sprites drawn
+	/// </summary>
+	U64 sprites{ 0 };
+
+	/// <summary>
+	/// Number of sprite batches
+	/// </summary>
+	U64 batches{ 0 };
+
+	/// <summary>
+	/// Number of draw calls
+	/// </summary>
+	U64 drawCalls{ 0 };
+
+	/// <summary>
+	/// Time spent drawing sprite frames (in milliseconds)
+	/// </summary>
+	double drawTime{ 0 };
+
+	/// <summary>
+	/// Number of heap allocations
+	/// </summary>
+	U64 allocations{ 0 };
+
+	/// <summary>
+	/// Benchmark specific values
+	/// </summary>
+	std::vector<std::pair<std::string, double>> values;
+};
+
+/// <summary>
+/// Benchmark application
+/// </summary>
+class BenchApp : public App {
+public:
+	/// <summary>
+	/// Application constructor
+	/// </summary>
+	/// <param name="outFileName">File to write results to (empty = standard output)</param>
+	BenchApp(std::string outFileName) : App("Benchmark"), outFileName(outFileName) { }
+
+	/// <summary>
+	/// Start the next benchmark (or exit if there are none left)
+	/// </summary>
+	static void NextBench();
+
+	/// <summary>
+	/// Finish the current benchmark and start the next one
+	/// </summary>
+	/// <param name="result">Result of the current benchmark</param>
+	static void FinishBench(BenchResult result);
+
+private:
+	/// <summary>
+	/// On start event
+	/// </summary>
+	void OnStart();
+
+	/// <summary>
+	/// On update start event
+	/// </summary>
+	void OnUpdateStart();
+
+	/// <summary>
+	/// On update end event
+	/// </summary>
+	void OnUpdateEnd();
+
+	/// <summary>
+	/// On fixed update start event
+	/// </summary>
+	void OnFixedUpdateStart();
+
+	/// <summary>
+	/// On fixed update end event
+	/// </summary>
+	void OnFixedUpdateEnd();
+
+	/// <summary>
+	/// On draw start event
+	/// </summary>
+	void OnDrawStart();
+
+	/// <summary>
+	/// On draw end event
+	/// </summary>
+	void OnDrawEnd();
+
+	/// <summary>
+	/// On close event
+	/// </summary>
+	void OnClose();
+
+	/// <summary>
+	/// Write results as JSON
+	/// </summary>
+	void WriteResults();
+
+	/// <summary>
+	/// Benchmarks to run, in order
+	/// </summary>
+	static void (* const benches[])();
+
+	/// <summary>
+	/// Next benchmark to run
+	/// </summary>
+	static int nextBench;
+
+	/// <summary>
+	/// Results
+	/// </summary>
+	static std::vector<BenchResult> results;
+
+	/// <summary>
+	/// File to write results to
+	/// </summary>
+	std::string outFileName;
+};
+
+/// <summary>
+/// Benchmark scene (runs a number of warm up frames, then measures a number of frames)
+/// </summary>
+class BenchScene : public Scene {
+public:
+	/// <summary>
+	/// Benchmark scene constructor
+	/// </summary>
+	/// <param name="name">Benchmark name</param>
+	/// <param name="frames">Number of frames to measure</param>
+	/// <param name="warmUpFrames">Number of frames to run before measuring</param>
+	BenchScene(std::string name, const U64 frames, const U64 warmUpFrames) :
+		name(name), frames(frames), warmUpFrames(warmUpFrames) { }
+
+	/// <summary>
+	/// Get string representation of benchmark scene
+	/// </summary>
+	/// <returns>String representation of benchmark scene</returns>
+	std::string ToString() {
+		return "Benchmark (" + name + ")";
+	}
+
+protected:
+	/// <summary>
+	/// Set up the benchmark (not measured)
+	/// </summary>
+	virtual void OnBenchStart() = 0;
+
+	/// <summary>
+	/// Update the benchmark for a frame
+	/// </summary>
+	virtual void OnBenchUpdate() = 0;
+
+	/// <summary>
+	/// Draw the benchmark for a frame
+	/// </summary>
+	virtual void OnBenchDraw() = 0;
+
+	/// <summary>
+	/// Add benchmark specific values to the result
+	/// </summary>
+	/// <param name="result">Result</param>
+	virtual void OnBenchEnd(BenchResult& result) = 0;
+
+	/// <summary>
+	/// Clean up the benchmark
+	/// </summary>
+	virtual void OnBenchExit() = 0;
+
+	/// <summary>
+	/// Check if frames are being measured
+	/// </summary>
+	/// <returns>True if measuring, false if warming up</returns>
+	bool CheckMeasuring() const {
+		return frame >= warmUpFrames;
+	}
+
+	/// <summary>
+	/// Benchmark name
+	/// </summary>
+	std::string name;
+
+	/// <summary>
+	/// Number of frames to measure
+	/// </summary>
+	U64 frames;
+
+	/// <summary>
+	/// Number of frames to run before measuring
+	/// </summary>
+	U64 warmUpFrames;
+
+private:
+	/// <summary>
+	/// On start event
+	/// </summary>
+	void OnStart();
+
+	/// <summary>
+	/// On update start event
+	/// </summary>
+	void OnUpdateStart();
+
+	/// <summary>
+	/// On update end event
+	/// </summary>
+	void OnUpdateEnd() { }
+
+	/// <summary>
+	/// On fixed update start event
+	/// </summary>
+	void OnFixedUpdateStart() { }
+
+	/// <summary>
+	/// On fixed update end event
+	/// </summary>
+	void OnFixedUpdateEnd() { }
+
+	/// <summary>
+	/// On draw start event
+	/// </summary>
+	void OnDrawStart();
+
+	/// <summary>
+	/// On draw end event
+	/// </summary>
+	void OnDrawEnd() { }
+
+	/// <summary>
+	/// On exit event
+	/// </summary>
+	void OnExit();
+
+	/// <summary>
+	/// Current frame
+	/// </summary>
+	U64 frame{ 0 };
+
+	/// <summary>
+	/// Result being measured
+	/// </summary>
+	BenchResult result;
+
+	/// <summary>
+	/// Allocation count when measuring started
+	/// </summary>
+	U64 startAllocations{ 0 };
+
+	/// <summary>
+	/// Finished flag
+	/// </summary>
+	bool finished{ false };
+};
+
+/// <summary>
+/// Rotating sprites spread across several textures
+/// </summary>
+class SpriteBench : public BenchScene {
+public:
+	/// <summary>
+	/// Number of sprites
+	/// </summary>
+	static constexpr int SpriteCount = 10000;
+
+	/// <summary>
+	/// Number of textures
+	/// </summary>
+	static constexpr int TextureCount = 8;
+
+	/// <summary>
+	/// Sprite benchmark constructor
+	/// </summary>
+	SpriteBench() : BenchScene("sprites", 600, 30) { }
+
+private:
+	/// <summary>
+	/// Set up the benchmark (not measured)
+	/// </summary>
+	void OnBenchStart();
+
+	/// <summary>
+	/// Update the benchmark for a frame
+	/// </summary>
+	void OnBenchUpdate();
+
+	/// <summary>
+	/// Draw the benchmark for a frame
+	/// </summary>
+	void OnBenchDraw();
+
+	/// <summary>
+	/// Add benchmark specific values to the result
+	/// </summary>
+	/// <param name="result">Result</param>
+	void OnBenchEnd(BenchResult& result);
+
+	/// <summary>
+	/// Clean up the benchmark
+	/// </summary>
+	void OnBenchExit();
+
+	/// <summary>
+	/// Textures
+	/// </summary>
+	std::shared_ptr<Texture> textures[TextureCount];
+
+	/// <summary>
+	/// Sprite positions
+	/// </summary>
+	std::vector<Vec2D<float>> positions;
+
+	/// <summary>
+	/// Rotation angle
+	/// </summary>
+	float angle{ 0 };
+};
+
+/// <summary>
+/// Full screen map scrolling at 4K
+/// </summary>
+class MapBench : public BenchScene {
+public:
+	/// <summary>
+	/// Map benchmark constructor
+	/// </summary>
+	MapBench() : BenchScene("map_scroll_4k", 600, 30) { }
+
+private:
+	/// <summary>
+	/// Set up the benchmark (not measured)
+	/// </summary>
+	void OnBenchStart();
+
+	/// <summary>
+	/// Update the benchmark for a frame
+	/// </summary>
+	void OnBenchUpdate();
+
+	/// <summary>
+	/// Draw the benchmark for a frame
+	/// </summary>
+	void OnBenchDraw();
+
+	/// <summary>
+	/// Add benchmark specific values to the result
+	/// </summary>
+	/// <param name="result">Result</param>
+	void OnBenchEnd(BenchResult& result);
+
+	/// <summary>
+	/// Clean up the benchmark
+	/// </summary>
+	void OnBenchExit();
+
+	/// <summary>
+	/// Map
+	/// </summary>
+	std::shared_ptr<Map> map{ nullptr };
+};
+
+/// <summary>
+/// Actors spawning and despawning every frame
+/// </summary>
+class ActorBench : public BenchScene {
+public:
+	/// <summary>
+	/// Number of actors to keep alive
+	/// </summary>
+	static constexpr int ActorCount = 10000;
+
+	/// <summary>
+	/// Actor benchmark constructor
+	/// </summary>
+	ActorBench() : BenchScene("actor_churn", 600, 30) { }
+
+private:
+	/// <summary>
+	/// Set up the benchmark (not measured)
+	/// </summary>
+	void OnBenchStart();
+
+	/// <summary>
+	/// Update the benchmark for a frame
+	/// </summary>
+	void OnBenchUpdate();
+
+	/// <summary>
+	/// Draw the benchmark for a frame
+	/// </summary>
+	void OnBenchDraw();
+
+	/// <summary>
+	/// Add benchmark specific values to the result
+	/// </summary>
+	/// <param name="result">Result</param>
+	void OnBenchEnd(BenchResult& result);
+
+	/// <summary>
+	/// Clean up the benchmark
+	/// </summary>
+	void OnBenchExit();
+
+	/// <summary>
+	/// Number of actors spawned while measuring
+	/// </summary>
+	U64 spawns{ 0 };
+};
+
+/// <summary>
+/// Many sound effects mixing at once
+/// </summary>
+class SoundBench : public BenchScene {
+public:
+	/// <summary>
+	/// Number of voices
+	/// </summary>
+	static constexpr int VoiceCount = 64;
+
+	/// <summary>
+	/// Sound benchmark constructor
+	/// </summary>
+	SoundBench() : BenchScene("sound_mix_64", 600, 30) { }
+
+private:
+	/// <summary>
+	/// Set up the benchmark (not measured)
+	/// </summary>
+	void OnBenchStart();
+
+	/// <summary>
+	/// Update the benchmark for a frame
+	/// </summary>
+	void OnBenchUpdate();
+
+	/// <summary>
+	/// Draw the benchmark for a frame
+	/// </summary>
+	void OnBenchDraw();
+
+	/// <summary>
+	/// Add benchmark specific values to the result
+	/// </summary>
+	/// <param name="result">Result</param>
+	void OnBenchEnd(BenchResult& result);
+
+	/// <summary>
+	/// Clean up the benchmark
+	/// </summary>
+	void OnBenchExit();
+
+	/// <summary>
+	/// Device statistics when measuring started
+	/// </summary>
+	SoundDeviceStats startStats;
+};
+
+/// <summary>
+/// Loading a large map and sprite sheet
+/// </summary>
+class LoadBench : public BenchScene {
+public:
+	/// <summary>
+	/// Load benchmark constructor
+	/// </summary>
+	LoadBench() : BenchScene("load_map_sheet", 20, 2) { }
+
+private:
+	/// <summary>
+	/// Set up the benchmark (not measured)
+	/// </summary>
+	void OnBenchStart();
+
+	/// <summary>
+	/// Update the benchmark for a frame
+	/// </summary>
+	void OnBenchUpdate();
+
+	/// <summary>
+	/// Draw the benchmark for a frame
+	/// </summary>
+	void OnBenchDraw();
+
+	/// <summary>
+	/// Add benchmark specific values to the result
+	/// </summary>
+	/// <param name="result">Result</param>
+	void OnBenchEnd(BenchResult& result);
+
+	/// <summary>
+	/// Clean up the benchmark
+	/// </summary>
+	void OnBenchExit();
+
+	/// <summary>
+	/// Time spent loading maps while measuring (in milliseconds)
+	/// </summary>
+	double mapTime{ 0 };
+
+	/// <summary>
+	/// Time spent loading sheets while measuring (in milliseconds)
+	/// </summary>
+	double sheetTime{ 0 };
+};
+
+#endif // VIOLET_BENCH_APP_HPP
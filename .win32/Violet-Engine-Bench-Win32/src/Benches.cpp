@@ -0,0 +1,505 @@
+#include "App.hpp"
+
+/// <summary>
+/// Create a checkered texture
+/// </summary>
+/// <param name="size">Texture size</param>
+/// <param name="cellSize">Checker cell size</param>
+/// <param name="color">Color</param>
+/// <returns>Created texture</returns>
+static std::shared_ptr<Texture> CreateCheckerTexture(Size2D<int> size, const int cellSize, ColorRGBA<float> color) {
+	std::shared_ptr<Image> image = Engine::CreateImage(size);
+	std::shared_ptr<ColorRGBA<float>[]> pixels = image->GetPixels();
+
+	for (int y = 0; y < size.h; ++y) {
+		for (int x = 0; x < size.w; ++x) {
+			float shade = (((x / cellSize) + (y / cellSize)) & 1) ? 1.0f : 0.5f;
+			pixels[x + (y * size.w)] = { color.r * shade, color.g * shade, color.b * shade, color.a };
+		}
+	}
+	return Engine::CreateTexture(image);
+}
+
+/// <summary>
+/// Write a sprite sheet file laid out as a grid
+/// </summary>
+/// <param name="fileName">File name</param>
+/// <param name="count">Number of frames</param>
+/// <param name="frameSize">Frame size</param>
+/// <param name="columns">Number of frames per row</param>
+static void WriteGridSheet(std::string fileName, const int count, Size2D<int> frameSize, const int columns) {
+	std::shared_ptr<BinaryFile> file = Engine::OpenBinaryFile(fileName, false);
+	file->WriteString("VIOLSPR", false);
+	file->WriteUInt8(1);
+	file->WriteInt32(count);
+	for (int i = 0; i < count; ++i) {
+		file->WriteInt32((i % columns) * frameSize.w);
+		file->WriteInt32((i / columns) * frameSize.h);
+		file->WriteInt32(frameSize.w);
+		file->WriteInt32(frameSize.h);
+		file->WriteInt32(0);
+		file->WriteInt32(0);
+	}
+}
+
+/// <summary>
+/// Write a map file filled with random tiles
+/// </summary>
+/// <param name="fileName">File name</param>
+/// <param name="mapSize">Map size (in tiles)</param>
+/// <param name="gridSize">Grid size</param>
+/// <param name="layerCount">Number of layers</param>
+/// <param name="tileCount">Number of tiles in the sheet</param>
+static void WriteRandomMap(std::string fileName, Size2D<int> mapSize, Size2D<int> gridSize, const int layerCount, const int tileCount) {
+	std::shared_ptr<BinaryFile> file = Engine::OpenBinaryFile(fileName, false);
+	file->WriteString("VIOLMAP", false);
+	file->WriteUInt8(1);
+	file->WriteUInt16(mapSize.w);
+	file->WriteUInt16(mapSize.h);
+	file->WriteUInt16(gridSize.w);
+	file->WriteUInt16(gridSize.h);
+	file->WriteUInt8(layerCount);
+	for (int i = 0; i < layerCount; ++i) {
+		file->WriteUInt8(i);
+		for (int j = 0; j < mapSize.w * mapSize.h; ++j) {
+			file->WriteUInt16(Math::RandomRange(0, tileCount - 1));
+			file->WriteUInt8(0);
+			file->WriteUInt8(0);
+		}
+	}
+}
+
+/// <summary>
+/// Write a mono 16-bit sine wave WAV file
+/// </summary>
+/// <param name="fileName">File name</param>
+/// <param name="sampleRate">Sample rate</param>
+/// <param name="frames">Number of frames</param>
+/// <param name="frequency">Sine wave frequency</param>
+static void WriteSineWAV(std::string fileName, const int sampleRate, const int frames, const float frequency) {
+	std::shared_ptr<BinaryFile> file = Engine::OpenBinaryFile(fileName, false);
+	file->WriteString("RIFF", false);
+	file->WriteUInt32(36 + (frames * sizeof(S16)));
+	file->WriteString("WAVE", false);
+	file->WriteString("fmt ", false);
+	file->WriteUInt32(16);
+	file->WriteUInt16(1);
+	file->WriteUInt16(1);
+	file->WriteUInt32(sampleRate);
+	file->WriteUInt32(sampleRate * sizeof(S16));
+	file->WriteUInt16(sizeof(S16));
+	file->WriteUInt16(16);
+	file->WriteString("data", false);
+	file->WriteUInt32(frames * sizeof(S16));
+	for (int i = 0; i < frames; ++i) {
+		file->WriteInt16(static_cast<S16>(Math::Sin(2 * Pi * frequency * i / sampleRate) * 8192));
+	}
+}
+
+/*******************/
+/* BENCHMARK SCENE */
+/*******************/
+
+/// <summary>
+/// On start event
+/// </summary>
+void BenchScene::OnStart() {
+	result.name = name;
+	OnBenchStart();
+}
+
+/// <summary>
+/// On update start event
+/// </summary>
+void BenchScene::OnUpdateStart() {
+	if (finished) {
+		return;
+	}
+
+	if (frame == warmUpFrames) {
+		Engine::ResetFrameTimeStats();
+		AllocTracker::ResetStats();
+		startAllocations = GetAllocationCount();
+	}
+	else if (frame > warmUpFrames) {
+		// Statistics from the last frame that was drawn
+		GraphicsStats stats = Graphics::GetStats();
+		result.sprites += stats.sprites;
+		result.batches += stats.batches;
+		result.drawCalls += stats.drawCalls;
+		result.drawTime += stats.drawTime;
+	}
+
+	if (frame == warmUpFrames + frames) {
+		result.allocations = GetAllocationCount() - startAllocations;
+		result.frameTime = Engine::GetFrameTimeStats();
+		if (AllocTracker::IsEnabled()) {
+			// Allocations per subsystem
+			AllocStats allocStats = AllocTracker::GetStats();
+			double allocFrames = static_cast<double>(Math::Max(allocStats.frames, static_cast<U64>(1)));
+			for (int i = 0; i < AllocTagCount; ++i) {
+				std::string tagName = AllocTracker::GetTagName(static_cast<AllocTag>(i));
+				result.values.push_back({ tagName + "AllocationsPerFrame", allocStats.total[i].allocations / allocFrames });
+				result.values.push_back({ tagName + "BytesPerFrame", allocStats.total[i].bytes / allocFrames });
+			}
+		}
+		OnBenchEnd(result);
+
+		finished = true;
+		BenchApp::FinishBench(result);
+		return;
+	}
+
+	OnBenchUpdate();
+	++frame;
+}
+
+/// <summary>
+/// On draw start event
+/// </summary>
+void BenchScene::OnDrawStart() {
+	if (!finished) {
+		OnBenchDraw();
+	}
+}
+
+/// <summary>
+/// On exit event
+/// </summary>
+void BenchScene::OnExit() {
+	OnBenchExit();
+}
+
+/********************/
+/* SPRITE BENCHMARK */
+/********************/
+
+/// <summary>
+/// Set up the benchmark (not measured)
+/// </summary>
+void SpriteBench::OnBenchStart() {
+	for (int i = 0; i < TextureCount; ++i) {
+		float hue = static_cast<float>(i) / TextureCount;
+		textures[i] = CreateCheckerTexture(Size2D<int>(32, 32), 8,
+			{ (Math::Sin(2 * Pi * hue) + 1) / 2, (Math::Cos(2 * Pi * hue) + 1) / 2, 1.0f - hue, 1.0f });
+	}
+
+	positions.reserve(SpriteCount);
+	for (int i = 0; i < SpriteCount; ++i) {
+		positions.push_back({ Math::RandomFloat() * BenchViewSize.w, Math::RandomFloat() * BenchViewSize.h });
+	}
+}
+
+/// <summary>
+/// Update the benchmark for a frame
+/// </summary>
+void SpriteBench::OnBenchUpdate() {
+	angle += 1;
+}
+
+/// <summary>
+/// Draw the benchmark for a frame
+/// </summary>
+void SpriteBench::OnBenchDraw() {
+	// Neighboring sprites use different textures, so this is the worst case for batching
+	for (int i = 0; i < SpriteCount; ++i) {
+		textures[i % TextureCount]->Draw(TextureFilter::Bilinear,
+			SpriteParams(0, positions[i], { 1.0f, 1.0f }, angle + i, 0.75f));
+	}
+}
+
+/// <summary>
+/// Add benchmark specific values to the result
+/// </summary>
+/// <param name="result">Result</param>
+void SpriteBench::OnBenchEnd(BenchResult& result) {
+	result.values.push_back({ "sprites", static_cast<double>(SpriteCount) });
+	result.values.push_back({ "textures", static_cast<double>(TextureCount) });
+}
+
+/// <summary>
+/// Clean up the benchmark
+/// </summary>
+void SpriteBench::OnBenchExit() {
+
+}
+
+/*****************/
+/* MAP BENCHMARK */
+/*****************/
+
+/// <summary>
+/// Set up the benchmark (not measured)
+/// </summary>
+void MapBench::OnBenchStart() {
+	WriteGridSheet("BenchTiles.spr", 256, Size2D<int>(16, 16), 16);
+	WriteRandomMap("BenchMap.map", Size2D<int>(512, 512), Size2D<int>(16, 16), 2, 256);
+
+	map = Engine::OpenMap("BenchMap.map");
+	map->SetTexture(0, CreateCheckerTexture(Size2D<int>(256, 256), 4, { 0.25f, 0.75f, 0.25f, 1.0f }));
+	map->SetSheet(0, Engine::OpenSheet("BenchTiles.spr"));
+
+	Graphics::SetBaseViewSize(Size2D<int>(3840, 2160));
+}
+
+/// <summary>
+/// Update the benchmark for a frame
+/// </summary>
+void MapBench::OnBenchUpdate() {
+	map->AddScroll(0, { 2, 1 });
+	map->AddScroll(1, { 4, 2 });
+}
+
+/// <summary>
+/// Draw the benchmark for a frame
+/// </summary>
+void MapBench::OnBenchDraw() {
+	map->Draw();
+}
+
+/// <summary>
+/// Add benchmark specific values to the result
+/// </summary>
+/// <param name="result">Result</param>
+void MapBench::OnBenchEnd(BenchResult& result) {
+	result.values.push_back({ "viewWidth", 3840 });
+	result.values.push_back({ "viewHeight", 2160 });
+	result.values.push_back({ "layers", 2 });
+}
+
+/// <summary>
+/// Clean up the benchmark
+/// </summary>
+void MapBench::OnBenchExit() {
+	Graphics::SetBaseViewSize(BenchViewSize);
+	map = nullptr;
+	remove("BenchMap.map");
+	remove("BenchTiles.spr");
+}
+
+/*******************/
+/* ACTOR BENCHMARK */
+/*******************/
+
+/// <summary>
+/// Actor that lives for a random number of frames
+/// </summary>
+class ChurnActor : public Actor {
+public:
+	/// <summary>
+	/// Get string representation of churn actor
+	/// </summary>
+	/// <returns>String representation of churn actor</returns>
+	std::string ToString() {
+		return "Churn Actor";
+	}
+
+	/// <summary>
+	/// Number of actors alive
+	/// </summary>
+	static int alive;
+
+private:
+	/// <summary>
+	/// On spawn event
+	/// </summary>
+	void OnSpawn() {
+		life = Math::RandomRange(1, 60);
+		++alive;
+	}
+
+	/// <summary>
+	/// On update event
+	/// </summary>
+	void OnUpdate() {
+		if (--life <= 0) {
+			Dispose();
+		}
+	}
+
+	/// <summary>
+	/// On fixed update event
+	/// </summary>
+	void OnFixedUpdate() {
+
+	}
+
+	/// <summary>
+	/// On draw event
+	/// </summary>
+	void OnDraw() {
+
+	}
+
+	/// <summary>
+	/// On dispose event
+	/// </summary>
+	void OnDispose() {
+		--alive;
+	}
+
+	/// <summary>
+	/// Frames left to live
+	/// </summary>
+	int life{ 0 };
+};
+
+/// <summary>
+/// Number of actors alive
+/// </summary>
+int ChurnActor::alive{ 0 };
+
+/// <summary>
+/// Set up the benchmark (not measured)
+/// </summary>
+void ActorBench::OnBenchStart() {
+
+}
+
+/// <summary>
+/// Update the benchmark for a frame
+/// </summary>
+void ActorBench::OnBenchUpdate() {
+	// Replace the actors that died last frame
+	while (ChurnActor::alive < ActorCount) {
+		Actor::Spawn<ChurnActor>();
+		if (CheckMeasuring()) {
+			++spawns;
+		}
+	}
+}
+
+/// <summary>
+/// Draw the benchmark for a frame
+/// </summary>
+void ActorBench::OnBenchDraw() {
+
+}
+
+/// <summary>
+/// Add benchmark specific values to the result
+/// </summary>
+/// <param name="result">Result</param>
+void ActorBench::OnBenchEnd(BenchResult& result) {
+	result.values.push_back({ "actors", static_cast<double>(ActorCount) });
+	result.values.push_back({ "spawnsPerFrame", static_cast<double>(spawns) / frames });
+}
+
+/// <summary>
+/// Clean up the benchmark
+/// </summary>
+void ActorBench::OnBenchExit() {
+
+}
+
+/*******************/
+/* SOUND BENCHMARK */
+/*******************/
+
+/// <summary>
+/// Set up the benchmark (not measured)
+/// </summary>
+void SoundBench::OnBenchStart() {
+	// Make the voices last exactly as long as the benchmark, since sound effects can't be stopped early
+	const int blockFrames = SoundBufferLen / (2 * sizeof(S16));
+	const int sourceRate = 22050;
+	U64 outputFrames = (warmUpFrames + frames) * blockFrames;
+	WriteSineWAV("BenchVoice.wav", sourceRate, static_cast<int>(outputFrames * sourceRate / Sound::GetSampleRate()), 440);
+
+	for (int i = 0; i < VoiceCount; ++i) {
+		Sound::PlaySFX("BenchVoice.wav");
+	}
+}
+
+/// <summary>
+/// Update the benchmark for a frame
+/// </summary>
+void SoundBench::OnBenchUpdate() {
+	if (!CheckMeasuring()) {
+		startStats = Sound::GetDeviceStats();
+	}
+	Sound::Render(1);
+}
+
+/// <summary>
+/// Draw the benchmark for a frame
+/// </summary>
+void SoundBench::OnBenchDraw() {
+
+}
+
+/// <summary>
+/// Add benchmark specific values to the result
+/// </summary>
+/// <param name="result">Result</param>
+void SoundBench::OnBenchEnd(BenchResult& result) {
+	SoundDeviceStats stats = Sound::GetDeviceStats();
+	U64 blocks = stats.blocks - startStats.blocks;
+
+	result.values.push_back({ "voices", static_cast<double>(VoiceCount) });
+	result.values.push_back({ "mixBlocks", static_cast<double>(blocks) });
+	result.values.push_back({ "mixMsPerBlock", (blocks > 0) ? ((stats.time - startStats.time) / blocks) : 0 });
+}
+
+/// <summary>
+/// Clean up the benchmark
+/// </summary>
+void SoundBench::OnBenchExit() {
+	// Let the voices end before the file goes away
+	Sound::Render(1);
+	remove("BenchVoice.wav");
+}
+
+/******************/
+/* LOAD BENCHMARK */
+/******************/
+
+/// <summary>
+/// Set up the benchmark (not measured)
+/// </summary>
+void LoadBench::OnBenchStart() {
+	WriteGridSheet("BenchLarge.spr", 65536, Size2D<int>(16, 16), 256);
+	WriteRandomMap("BenchLarge.map", Size2D<int>(1024, 1024), Size2D<int>(16, 16), 2, 65536);
+}
+
+/// <summary>
+/// Update the benchmark for a frame
+/// </summary>
+void LoadBench::OnBenchUpdate() {
+	double start = Engine::GetTicks();
+	std::shared_ptr<Map> map = Engine::OpenMap("BenchLarge.map");
+	double mapEnd = Engine::GetTicks();
+	std::shared_ptr<Sheet> sheet = Engine::OpenSheet("BenchLarge.spr");
+	double sheetEnd = Engine::GetTicks();
+
+	if (CheckMeasuring()) {
+		mapTime += mapEnd - start;
+		sheetTime += sheetEnd - mapEnd;
+	}
+}
+
+/// <summary>
+/// Draw the benchmark for a frame
+/// </summary>
+void LoadBench::OnBenchDraw() {
+
+}
+
+/// <summary>
+/// Add benchmark specific values to the result
+/// </summary>
+/// <param name="result">Result</param>
+void LoadBench::OnBenchEnd(BenchResult& result) {
+	result.values.push_back({ "mapTiles", 1024 * 1024 * 2 });
+	result.values.push_back({ "sheetFrames", 65536 });
+	result.values.push_back({ "mapLoadMs", mapTime / frames });
+	result.values.push_back({ "sheetLoadMs", sheetTime / frames });
+}
+
+/// <summary>
+/// Clean up the benchmark
+/// </summary>
+void LoadBench::OnBenchExit() {
+	remove("BenchLarge.map");
+	remove("BenchLarge.spr");
+}
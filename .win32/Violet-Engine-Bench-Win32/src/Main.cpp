@@ -0,0 +1,212 @@
+#include "App.hpp"
+
+#ifndef VIOLET_ALLOC_TRACKING
+// Without the engine's allocation tracker, count allocations here
+
+/// <summary>
+/// Number of heap allocations made so far
+/// </summary>
+static std::atomic<U64> allocationCount{ 0 };
+
+/// <summary>
+/// Allocate memory (counted)
+/// </summary>
+/// <param name="size">Size</param>
+/// <returns>Allocated memory</returns>
+void* operator new(size_t size) {
+	++allocationCount;
+	void* memory = malloc((size > 0) ? size : 1);
+	if (!memory) {
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+/// <summary>
+/// Free memory
+/// </summary>
+/// <param name="memory">Memory</param>
+void operator delete(void* memory) noexcept {
+	free(memory);
+}
+
+/// <summary>
+/// Free memory
+/// </summary>
+/// <param name="memory">Memory</param>
+/// <param name="size">Size</param>
+void operator delete(void* memory, size_t size) noexcept {
+	free(memory);
+}
+#endif
+
+/// <summary>
+/// Get the number of heap allocations made so far
+/// </summary>
+/// <returns>Number of allocations</returns>
+U64 GetAllocationCount() {
+#ifdef VIOLET_ALLOC_TRACKING
+	return AllocTracker::GetAllocationCount();
+#else
+	return allocationCount;
+#endif
+}
+
+/// <summary>
+/// Benchmarks to run, in order
+/// </summary>
+void (* const BenchApp::benches[])() = {
+	Engine::SetScene<SpriteBench>,
+	Engine::SetScene<MapBench>,
+	Engine::SetScene<ActorBench>,
+	Engine::SetScene<SoundBench>,
+	Engine::SetScene<LoadBench>
+};
+
+/// <summary>
+/// Next benchmark to run
+/// </summary>
+int BenchApp::nextBench{ 0 };
+
+/// <summary>
+/// Results
+/// </summary>
+std::vector<BenchResult> BenchApp::results;
+
+/// <summary>
+/// Start the next benchmark (or exit if there are none left)
+/// </summary>
+void BenchApp::NextBench() {
+	if (nextBench < static_cast<int>(sizeof(benches) / sizeof(benches[0]))) {
+		benches[nextBench++]();
+	}
+	else {
+		Engine::Exit();
+	}
+}
+
+/// <summary>
+/// Finish the current benchmark and start the next one
+/// </summary>
+/// <param name="result">Result of the current benchmark</param>
+void BenchApp::FinishBench(BenchResult result) {
+	Engine::DebugMessage("BENCHMARK END:       " + result.name + ", avg " + std::to_string(result.frameTime.average) +
+		" ms, p99 " + std::to_string(result.frameTime.p99) + " ms");
+	results.push_back(result);
+	NextBench();
+}
+
+/// <summary>
+/// On start event
+/// </summary>
+void BenchApp::OnStart() {
+	// Run as fast as possible
+	Engine::SetVSync(false);
+	Engine::SetFrameLimit(UnlimitedFrameRate);
+	Graphics::SetBaseViewSize(BenchViewSize);
+	Math::SetSeed(0);
+
+	// Fail if anything allocates while drawing
+	AllocTracker::SetStrict(true);
+}
+
+/// <summary>
+/// On update start event
+/// </summary>
+void BenchApp::OnUpdateStart() {
+
+}
+
+/// <summary>
+/// On update end event
+/// </summary>
+void BenchApp::OnUpdateEnd() {
+
+}
+
+/// <summary>
+/// On fixed update start event
+/// </summary>
+void BenchApp::OnFixedUpdateStart() {
+
+}
+
+/// <summary>
+/// On fixed update end event
+/// </summary>
+void BenchApp::OnFixedUpdateEnd() {
+
+}
+
+/// <summary>
+/// On draw start event
+/// </summary>
+void BenchApp::OnDrawStart() {
+
+}
+
+/// <summary>
+/// On draw end event
+/// </summary>
+void BenchApp::OnDrawEnd() {
+
+}
+
+/// <summary>
+/// On close event
+/// </summary>
+void BenchApp::OnClose() {
+	WriteResults();
+}
+
+/// <summary>
+/// Write results as JSON
+/// </summary>
+void BenchApp::WriteResults() {
+	std::string json = "{\n\t\"benchmarks\": [";
+	for (size_t i = 0; i < results.size(); ++i) {
+		const BenchResult& result = results[i];
+		double frames = static_cast<double>(Math::Max(result.frameTime.frames, static_cast<U64>(1)));
+
+		json += (i > 0) ? ",\n\t\t{\n" : "\n\t\t{\n";
+		json += "\t\t\t\"name\": \"" + result.name + "\",\n";
+		json += "\t\t\t\"frames\": " + std::to_string(result.frameTime.frames) + ",\n";
+		json += "\t\t\t\"frameTimeMs\": { \"average\": " + std::to_string(result.frameTime.average) +
+			", \"minimum\": " + std::to_string(result.frameTime.minimum) +
+			", \"maximum\": " + std::to_string(result.frameTime.maximum) +
+			", \"p50\": " + std::to_string(result.frameTime.p50) +
+			", \"p95\": " + std::to_string(result.frameTime.p95) +
+			", \"p99\": " + std::to_string(result.frameTime.p99) + " },\n";
+		json += "\t\t\t\"spritesPerFrame\": " + std::to_string(result.sprites / frames) + ",\n";
+		json += "\t\t\t\"batchesPerFrame\": " + std::to_string(result.batches / frames) + ",\n";
+		json += "\t\t\t\"drawCallsPerFrame\": " + std::to_string(result.drawCalls / frames) + ",\n";
+		json += "\t\t\t\"drawTimeMs\": " + std::to_string(result.drawTime / frames) + ",\n";
+		json += "\t\t\t\"drawNsPerSprite\": " + std::to_string((result.sprites > 0) ? (result.drawTime * 1000000.0 / result.sprites) : 0) + ",\n";
+		json += "\t\t\t\"allocationsPerFrame\": " + std::to_string(result.allocations / frames);
+		for (const std::pair<std::string, double>& value : result.values) {
+			json += ",\n\t\t\t\"" + value.first + "\": " + std::to_string(value.second);
+		}
+		json += "\n\t\t}";
+	}
+	json += "\n\t]\n}\n";
+
+	if (outFileName.empty()) {
+		fputs(json.c_str(), stdout);
+	}
+	else {
+		Engine::OpenBinaryFile(outFileName, false)->WriteString(json, false);
+	}
+}
+
+/// <summary>
+/// Main function
+/// </summary>
+/// <param name="argc">Argument count</param>
+/// <param name="argv">Arguments (optional file to write results to)</param>
+int main(int argc, char* argv[]) {
+	// Mix sound on demand so that the sound benchmark measures mixing and nothing else does
+	Sound::SetDevice(SoundDevice::Null, "", false);
+
+	std::make_shared<BenchApp>((argc > 1) ? argv[1] : "")->Run();
+	return 0;
+}
@@ -0,0 +1,57 @@
+#include "App.hpp"
+
+/// <summary>
+/// On start event
+/// </summary>
+void StartupScene::OnStart() {
+	BenchApp::NextBench();
+}
+
+/// <summary>
+/// On update start event
+/// </summary>
+void StartupScene::OnUpdateStart() {
+
+}
+
+/// <summary>
+/// On update end event
+/// </summary>
+void StartupScene::OnUpdateEnd() {
+
+}
+
+/// <summary>
+/// On fixed update start event
+/// </summary>
+void StartupScene::OnFixedUpdateStart() {
+
+}
+
+/// <summary>
+/// On fixed update end event
+/// </summary>
+void StartupScene::OnFixedUpdateEnd() {
+
+}
+
+/// <summary>
+/// On draw start event
+/// </summary>
+void StartupScene::OnDrawStart() {
+
+}
+
+/// <summary>
+/// On draw end event
+/// </summary>
+void StartupScene::OnDrawEnd() {
+
+}
+
+/// <summary>
+/// On exit event
+/// </summary>
+void StartupScene::OnExit() {
+
+}
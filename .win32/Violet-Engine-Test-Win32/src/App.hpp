@@ -95,6 +95,16 @@ private:
 	/// </summary>
 	std::shared_ptr<Map> map{ nullptr };
 
+	/// <summary>
+	/// Background scroll positions (camera, clouds 1, clouds 2, clouds 3)
+	/// </summary>
+	float bgScroll[4]{ 0, 0, 0, 0 };
+
+	/// <summary>
+	/// Background scroll positions at the previous fixed update
+	/// </summary>
+	float prevBGScroll[4]{ 0, 0, 0, 0 };
+
 };
 
 #endif // VIOLET_TEST_APP_HPP
@@ -1,6 +1,8 @@
+#ifdef _MSC_VER
 #define _CRTDBG_MAP_ALLOC
 #include <stdlib.h>
 #include <crtdbg.h>
+#endif
 
 #include "App.hpp"
 
@@ -114,7 +116,11 @@ void TestApp::OnFixedUpdateStart() {
 /// On fixed update end event
 /// </summary>
 void TestApp::OnFixedUpdateEnd() {
-
+	static const float speeds[4] = { 2, 1, 0.75f, 0.5f };
+	for (int i = 0; i < 4; ++i) {
+		prevBGScroll[i] = bgScroll[i];
+		bgScroll[i] += speeds[i];
+	}
 }
 
 /// <summary>
@@ -123,10 +129,12 @@ void TestApp::OnFixedUpdateEnd() {
 void TestApp::OnDrawStart() {
 	Size2D<int> viewSize = Graphics::GetViewSize();
 
-	static float clouds1X = 0;
-	static float clouds2X = 0;
-	static float clouds3X = 0;
-	static float cameraBG = 0;
+	// Interpolate between fixed updates
+	float alpha = Engine::GetFixedAlpha();
+	float cameraBG = Math::Lerp(prevBGScroll[0], bgScroll[0], alpha);
+	float clouds1X = Math::Lerp(prevBGScroll[1], bgScroll[1], alpha);
+	float clouds2X = Math::Lerp(prevBGScroll[2], bgScroll[2], alpha);
+	float clouds3X = Math::Lerp(prevBGScroll[3], bgScroll[3], alpha);
 	float cameraBG1 = 0.375f * cameraBG;
 	float cameraBG2 = 0.5f * cameraBG;
 
@@ -158,11 +166,6 @@ void TestApp::OnDrawStart() {
 		x -= xDelta;
 	}
 
-	cameraBG += 2 * Engine::GetDrawUpdateDelta();
-	clouds1X += 1 * Engine::GetDrawUpdateDelta();
-	clouds2X += 0.75f * Engine::GetDrawUpdateDelta();
-	clouds3X += 0.5f * Engine::GetDrawUpdateDelta();
-
 	static float angle = 0;
 	float intensity = 32 + (((Math::SinDeg(angle * 7) + 1) / 2) * 32);
 
@@ -214,9 +217,11 @@ int main() {
 		std::make_shared<TestApp>()->Run();
 	}
 
+#ifdef _MSC_VER
 	if (_CrtDumpMemoryLeaks()) {
 		printf("Memory leaks!\n");
 	}
+#endif
 
 	return 0;
 }
\ No newline at end of file
@@ -48,6 +48,7 @@ namespace Violet {
 	/// </summary>
 	/// <param name="mode">Update mode</param>
 	void Actor::Update(UpdateMode mode) {
+		AllocScope allocScope(AllocTag::Actor);
 		for (int i = 0; i < pool->size(); ++i) {
 			std::shared_ptr<Actor> actor = pool->at(i);
 
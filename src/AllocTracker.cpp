@@ -0,0 +1,427 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+namespace Violet {
+
+	/// <summary>
+	/// Allocation statistics
+	/// </summary>
+	AllocStats AllocTracker::stats;
+
+	/// <summary>
+	/// Strict mode flag
+	/// </summary>
+	bool AllocTracker::strict{ false };
+
+	/// <summary>
+	/// Allocation tag names
+	/// </summary>
+	static const char* tagNames[AllocTagCount] = {
+		"general",
+		"input",
+		"actor",
+		"map",
+		"graphics",
+		"sound",
+		"asset",
+		"message"
+	};
+
+#ifdef VIOLET_ALLOC_TRACKING
+	// The counters below are used by the global allocation functions, which can run on any thread
+	// (and before the engine starts), so they're kept to atomics and constant initialized thread locals
+
+	/// <summary>
+	/// Allocations made in the current frame, per tag
+	/// </summary>
+	static std::atomic<U64> frameAllocs[AllocTagCount];
+
+	/// <summary>
+	/// Bytes allocated in the current frame, per tag
+	/// </summary>
+	static std::atomic<U64> frameBytes[AllocTagCount];
+
+	/// <summary>
+	/// Number of heap allocations made so far
+	/// </summary>
+	static std::atomic<U64> allocCount{ 0 };
+
+	/// <summary>
+	/// Allocations made inside of no allocation scopes in the current frame
+	/// </summary>
+	static std::atomic<U64> frameViolations{ 0 };
+
+	/// <summary>
+	/// Name of the last no allocation scope that was allocated in
+	/// </summary>
+	static std::atomic<const char*> violationScope{ nullptr };
+
+	/// <summary>
+	/// Allocation tag of the calling thread
+	/// </summary>
+	static thread_local AllocTag curTag{ AllocTag::General };
+
+	/// <summary>
+	/// No allocation scope of the calling thread
+	/// </summary>
+	static thread_local const char* curNoAllocScope{ nullptr };
+
+	/// <summary>
+	/// Count a heap allocation
+	/// </summary>
+	/// <param name="size">Allocation size</param>
+	static inline void CountAllocation(const size_t size) {
+		int tag = static_cast<int>(curTag);
+		frameAllocs[tag].fetch_add(1, std::memory_order_relaxed);
+		frameBytes[tag].fetch_add(size, std::memory_order_relaxed);
+		allocCount.fetch_add(1, std::memory_order_relaxed);
+
+		if (curNoAllocScope) {
+			frameViolations.fetch_add(1, std::memory_order_relaxed);
+			violationScope.store(curNoAllocScope, std::memory_order_relaxed);
+		}
+	}
+
+#ifdef __cpp_aligned_new
+	/// <summary>
+	/// Allocate aligned memory
+	/// </summary>
+	/// <param name="size">Size</param>
+	/// <param name="alignment">Alignment (a power of 2)</param>
+	/// <returns>Allocated memory (nullptr if it failed)</returns>
+	static inline void* AllocAligned(const size_t size, const size_t alignment) {
+#ifdef _MSC_VER
+		return _aligned_malloc((size > 0) ? size : 1, alignment);
+#else
+		void* memory = nullptr;
+		if (posix_memalign(&memory, (alignment > sizeof(void*)) ? alignment : sizeof(void*), (size > 0) ? size : 1) != 0) {
+			return nullptr;
+		}
+		return memory;
+#endif
+	}
+
+	/// <summary>
+	/// Free aligned memory
+	/// </summary>
+	/// <param name="memory">Memory</param>
+	static inline void FreeAligned(void* memory) {
+#ifdef _MSC_VER
+		_aligned_free(memory);
+#else
+		free(memory);
+#endif
+	}
+#endif
+
+	/// <summary>
+	/// Allocation scope constructor
+	/// </summary>
+	/// <param name="tag">Allocation tag</param>
+	AllocScope::AllocScope(const AllocTag tag) : prevTag(curTag) {
+		curTag = tag;
+	}
+
+	/// <summary>
+	/// Allocation scope destructor
+	/// </summary>
+	AllocScope::~AllocScope() {
+		curTag = prevTag;
+	}
+
+	/// <summary>
+	/// No allocation scope constructor
+	/// </summary>
+	/// <param name="name">Scope name (must outlive the scope)</param>
+	NoAllocScope::NoAllocScope(const char* name) : prevName(curNoAllocScope) {
+		curNoAllocScope = name;
+	}
+
+	/// <summary>
+	/// No allocation scope destructor
+	/// </summary>
+	NoAllocScope::~NoAllocScope() {
+		curNoAllocScope = prevName;
+	}
+#endif
+
+	/// <summary>
+	/// End frame (moves the frame's counts into the statistics)
+	/// </summary>
+	void AllocTracker::EndFrame() {
+#ifdef VIOLET_ALLOC_TRACKING
+		++stats.frames;
+		for (int i = 0; i < AllocTagCount; ++i) {
+			AllocCounts counts;
+			counts.allocations = frameAllocs[i].exchange(0, std::memory_order_relaxed);
+			counts.bytes = frameBytes[i].exchange(0, std::memory_order_relaxed);
+
+			stats.lastFrame[i] = counts;
+			stats.total[i].allocations += counts.allocations;
+			stats.total[i].bytes += counts.bytes;
+			stats.peakFrame[i].allocations = Math::Max(stats.peakFrame[i].allocations, counts.allocations);
+			stats.peakFrame[i].bytes = Math::Max(stats.peakFrame[i].bytes, counts.bytes);
+		}
+
+		U64 violations = frameViolations.exchange(0, std::memory_order_relaxed);
+		if (violations > 0) {
+			stats.violations += violations;
+			stats.violationScope = violationScope.load(std::memory_order_relaxed);
+			if (strict) {
+				Engine::Error(std::to_string(violations) + " allocation(s) made in no allocation scope \"" +
+					stats.violationScope + "\".");
+			}
+		}
+#endif
+	}
+
+	/// <summary>
+	/// Get allocation statistics
+	/// </summary>
+	/// <returns>Allocation statistics</returns>
+	AllocStats AllocTracker::GetStats() {
+		return stats;
+	}
+
+	/// <summary>
+	/// Reset allocation statistics
+	/// </summary>
+	void AllocTracker::ResetStats() {
+		stats = {};
+	}
+
+	/// <summary>
+	/// Get the number of heap allocations made so far
+	/// </summary>
+	/// <returns>Number of allocations</returns>
+	U64 AllocTracker::GetAllocationCount() {
+#ifdef VIOLET_ALLOC_TRACKING
+		return allocCount.load(std::memory_order_relaxed);
+#else
+		return 0;
+#endif
+	}
+
+	/// <summary>
+	/// Set strict mode (allocating inside of a no allocation scope is an error at the end of the frame)
+	/// </summary>
+	/// <param name="enable">Strict mode enable flag</param>
+	void AllocTracker::SetStrict(const bool enable) {
+		strict = enable;
+	}
+
+	/// <summary>
+	/// Get allocation tag name
+	/// </summary>
+	/// <param name="tag">Allocation tag</param>
+	/// <returns>Allocation tag name</returns>
+	const char* AllocTracker::GetTagName(const AllocTag tag) {
+		if (tag < AllocTag::General || tag >= AllocTag::Count) {
+			Engine::Error("Invalid allocation tag \"" + std::to_string(static_cast<int>(tag)) + "\".");
+		}
+		return tagNames[static_cast<int>(tag)];
+	}
+
+}
+
+#ifdef VIOLET_ALLOC_TRACKING
+/// <summary>
+/// Allocate memory (tracked)
+/// </summary>
+/// <param name="size">Size</param>
+/// <returns>Allocated memory</returns>
+void* operator new(size_t size) {
+	Violet::CountAllocation(size);
+	void* memory = malloc((size > 0) ? size : 1);
+	if (!memory) {
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+/// <summary>
+/// Allocate memory (tracked)
+/// </summary>
+/// <param name="size">Size</param>
+/// <returns>Allocated memory</returns>
+void* operator new[](size_t size) {
+	return operator new(size);
+}
+
+/// <summary>
+/// Allocate memory without throwing (tracked)
+/// </summary>
+/// <param name="size">Size</param>
+/// <returns>Allocated memory (nullptr if it failed)</returns>
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+	Violet::CountAllocation(size);
+	return malloc((size > 0) ? size : 1);
+}
+
+/// <summary>
+/// Allocate memory without throwing (tracked)
+/// </summary>
+/// <param name="size">Size</param>
+/// <returns>Allocated memory (nullptr if it failed)</returns>
+void* operator new[](size_t size, const std::nothrow_t& nothrow) noexcept {
+	return operator new(size, nothrow);
+}
+
+/// <summary>
+/// Free memory
+/// </summary>
+/// <param name="memory">Memory</param>
+void operator delete(void* memory) noexcept {
+	free(memory);
+}
+
+/// <summary>
+/// Free memory
+/// </summary>
+/// <param name="memory">Memory</param>
+void operator delete[](void* memory) noexcept {
+	free(memory);
+}
+
+/// <summary>
+/// Free memory
+/// </summary>
+/// <param name="memory">Memory</param>
+/// <param name="size">Size</param>
+void operator delete(void* memory, size_t size) noexcept {
+	free(memory);
+}
+
+/// <summary>
+/// Free memory
+/// </summary>
+/// <param name="memory">Memory</param>
+/// <param name="size">Size</param>
+void operator delete[](void* memory, size_t size) noexcept {
+	free(memory);
+}
+
+/// <summary>
+/// Free memory
+/// </summary>
+/// <param name="memory">Memory</param>
+void operator delete(void* memory, const std::nothrow_t&) noexcept {
+	free(memory);
+}
+
+/// <summary>
+/// Free memory
+/// </summary>
+/// <param name="memory">Memory</param>
+void operator delete[](void* memory, const std::nothrow_t&) noexcept {
+	free(memory);
+}
+
+#ifdef __cpp_aligned_new
+/// <summary>
+/// Allocate aligned memory (tracked)
+/// </summary>
+/// <param name="size">Size</param>
+/// <param name="alignment">Alignment</param>
+/// <returns>Allocated memory</returns>
+void* operator new(size_t size, std::align_val_t alignment) {
+	Violet::CountAllocation(size);
+	void* memory = Violet::AllocAligned(size, static_cast<size_t>(alignment));
+	if (!memory) {
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+/// <summary>
+/// Allocate aligned memory (tracked)
+/// </summary>
+/// <param name="size">Size</param>
+/// <param name="alignment">Alignment</param>
+/// <returns>Allocated memory</returns>
+void* operator new[](size_t size, std::align_val_t alignment) {
+	return operator new(size, alignment);
+}
+
+/// <summary>
+/// Allocate aligned memory without throwing (tracked)
+/// </summary>
+/// <param name="size">Size</param>
+/// <param name="alignment">Alignment</param>
+/// <returns>Allocated memory (nullptr if it failed)</returns>
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+	Violet::CountAllocation(size);
+	return Violet::AllocAligned(size, static_cast<size_t>(alignment));
+}
+
+/// <summary>
+/// Allocate aligned memory without throwing (tracked)
+/// </summary>
+/// <param name="size">Size</param>
+/// <param name="alignment">Alignment</param>
+/// <returns>Allocated memory (nullptr if it failed)</returns>
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t& nothrow) noexcept {
+	return operator new(size, alignment, nothrow);
+}
+
+/// <summary>
+/// Free aligned memory
+/// </summary>
+/// <param name="memory">Memory</param>
+/// <param name="alignment">Alignment</param>
+void operator delete(void* memory, std::align_val_t alignment) noexcept {
+	Violet::FreeAligned(memory);
+}
+
+/// <summary>
+/// Free aligned memory
+/// </summary>
+/// <param name="memory">Memory</param>
+/// <param name="alignment">Alignment</param>
+void operator delete[](void* memory, std::align_val_t alignment) noexcept {
+	Violet::FreeAligned(memory);
+}
+
+/// <summary>
+/// Free aligned memory
+/// </summary>
+/// <param name="memory">Memory</param>
+/// <param name="size">Size</param>
+/// <param name="alignment">Alignment</param>
+void operator delete(void* memory, size_t size, std::align_val_t alignment) noexcept {
+	Violet::FreeAligned(memory);
+}
+
+/// <summary>
+/// Free aligned memory
+/// </summary>
+/// <param name="memory">Memory</param>
+/// <param name="size">Size</param>
+/// <param name="alignment">Alignment</param>
+void operator delete[](void* memory, size_t size, std::align_val_t alignment) noexcept {
+	Violet::FreeAligned(memory);
+}
+
+/// <summary>
+/// Free aligned memory
+/// </summary>
+/// <param name="memory">Memory</param>
+/// <param name="alignment">Alignment</param>
+void operator delete(void* memory, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+	Violet::FreeAligned(memory);
+}
+
+/// <summary>
+/// Free aligned memory
+/// </summary>
+/// <param name="memory">Memory</param>
+/// <param name="alignment">Alignment</param>
+void operator delete[](void* memory, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+	Violet::FreeAligned(memory);
+}
+#endif
+#endif
@@ -0,0 +1,247 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#ifndef VIOLET_ALLOC_TRACKER_HPP
+#define VIOLET_ALLOC_TRACKER_HPP
+
+namespace Violet {
+
+	/// <summary>
+	/// Allocation tag (subsystem that heap allocations are counted towards)
+	/// </summary>
+	enum class AllocTag {
+		/// <summary>
+		/// General (application and scene code, and anything untagged)
+		/// </summary>
+		General = 0,
+
+		/// <summary>
+		/// Input
+		/// </summary>
+		Input,
+
+		/// <summary>
+		/// Actor
+		/// </summary>
+		Actor,
+
+		/// <summary>
+		/// Map
+		/// </summary>
+		Map,
+
+		/// <summary>
+		/// Graphics
+		/// </summary>
+		Graphics,
+
+		/// <summary>
+		/// Sound
+		/// </summary>
+		Sound,
+
+		/// <summary>
+		/// Asset loading
+		/// </summary>
+		Asset,
+
+		/// <summary>
+		/// Message
+		/// </summary>
+		Message,
+
+		/// <summary>
+		/// Tag count
+		/// </summary>
+		Count
+	};
+
+	/// <summary>
+	/// Allocation tag count
+	/// </summary>
+	constexpr int AllocTagCount = static_cast<int>(AllocTag::Count);
+
+	/// <summary>
+	/// Allocation counts
+	/// </summary>
+	struct AllocCounts {
+		/// <summary>
+		/// Number of allocations
+		/// </summary>
+		U64 allocations{ 0 };
+
+		/// <summary>
+		/// Number of bytes allocated
+		/// </summary>
+		U64 bytes{ 0 };
+	};
+
+	/// <summary>
+	/// Allocation statistics
+	/// </summary>
+	struct AllocStats {
+		/// <summary>
+		/// Number of frames measured
+		/// </summary>
+		U64 frames{ 0 };
+
+		/// <summary>
+		/// Allocations made in the last frame, per tag
+		/// </summary>
+		AllocCounts lastFrame[AllocTagCount];
+
+		/// <summary>
+		/// Allocations made in all measured frames, per tag
+		/// </summary>
+		AllocCounts total[AllocTagCount];
+
+		/// <summary>
+		/// Most allocations made in a single frame, per tag
+		/// </summary>
+		AllocCounts peakFrame[AllocTagCount];
+
+		/// <summary>
+		/// Number of allocations made inside of no allocation scopes
+		/// </summary>
+		U64 violations{ 0 };
+
+		/// <summary>
+		/// Name of the last no allocation scope that was allocated in
+		/// </summary>
+		const char* violationScope{ nullptr };
+	};
+
+	/// <summary>
+	/// Allocation tracker (counts heap allocations per frame and per tag if built with VIOLET_ALLOC_TRACKING)
+	/// </summary>
+	class AllocTracker {
+	public:
+		/// <summary>
+		/// Check if allocation tracking is built in
+		/// </summary>
+		/// <returns>True if allocations are tracked, false if not</returns>
+		static constexpr bool IsEnabled() {
+#ifdef VIOLET_ALLOC_TRACKING
+			return true;
+#else
+			return false;
+#endif
+		}
+
+		/// <summary>
+		/// Get allocation statistics
+		/// </summary>
+		/// <returns>Allocation statistics</returns>
+		static AllocStats GetStats();
+
+		/// <summary>
+		/// Reset allocation statistics
+		/// </summary>
+		static void ResetStats();
+
+		/// <summary>
+		/// Get the number of heap allocations made so far
+		/// </summary>
+		/// <returns>Number of allocations</returns>
+		static U64 GetAllocationCount();
+
+		/// <summary>
+		/// Set strict mode (allocating inside of a no allocation scope is an error at the end of the frame)
+		/// </summary>
+		/// <param name="enable">Strict mode enable flag</param>
+		static void SetStrict(const bool enable);
+
+		/// <summary>
+		/// Get allocation tag name
+		/// </summary>
+		/// <param name="tag">Allocation tag</param>
+		/// <returns>Allocation tag name</returns>
+		static const char* GetTagName(const AllocTag tag);
+
+		// Friend classes
+		friend class Engine;
+
+	private:
+		/// <summary>
+		/// End frame (moves the frame's counts into the statistics)
+		/// </summary>
+		static void EndFrame();
+
+		/// <summary>
+		/// Allocation statistics
+		/// </summary>
+		static AllocStats stats;
+
+		/// <summary>
+		/// Strict mode flag
+		/// </summary>
+		static bool strict;
+	};
+
+	/// <summary>
+	/// Allocation scope (counts allocations made on this thread towards a tag until it goes out of scope)
+	/// </summary>
+	class AllocScope {
+	public:
+#ifdef VIOLET_ALLOC_TRACKING
+		/// <summary>
+		/// Allocation scope constructor
+		/// </summary>
+		/// <param name="tag">Allocation tag</param>
+		AllocScope(const AllocTag tag);
+
+		/// <summary>
+		/// Allocation scope destructor
+		/// </summary>
+		~AllocScope();
+
+	private:
+		/// <summary>
+		/// Tag of the enclosing scope
+		/// </summary>
+		AllocTag prevTag;
+#else
+		/// <summary>
+		/// Allocation scope constructor (does nothing without allocation tracking)
+		/// </summary>
+		/// <param name="tag">Allocation tag</param>
+		AllocScope(const AllocTag tag) { }
+#endif
+	};
+
+	/// <summary>
+	/// No allocation scope (allocations made on this thread until it goes out of scope count as violations)
+	/// </summary>
+	class NoAllocScope {
+	public:
+#ifdef VIOLET_ALLOC_TRACKING
+		/// <summary>
+		/// No allocation scope constructor
+		/// </summary>
+		/// <param name="name">Scope name (must outlive the scope)</param>
+		NoAllocScope(const char* name);
+
+		/// <summary>
+		/// No allocation scope destructor
+		/// </summary>
+		~NoAllocScope();
+
+	private:
+		/// <summary>
+		/// Name of the enclosing no allocation scope
+		/// </summary>
+		const char* prevName;
+#else
+		/// <summary>
+		/// No allocation scope constructor (does nothing without allocation tracking)
+		/// </summary>
+		/// <param name="name">Scope name</param>
+		NoAllocScope(const char* name) { }
+#endif
+	};
+
+}
+
+#endif // VIOLET_ALLOC_TRACKER_HPP
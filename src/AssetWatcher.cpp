@@ -0,0 +1,179 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+namespace Violet {
+
+	/// <summary>
+	/// Watched assets
+	/// </summary>
+	std::vector<AssetWatcher::Watch> AssetWatcher::watches;
+
+	/// <summary>
+	/// Changed files found in the last update
+	/// </summary>
+	std::vector<std::string> AssetWatcher::changedFiles;
+
+	/// <summary>
+	/// Watching started flag
+	/// </summary>
+	bool AssetWatcher::watching{ false };
+
+	/// <summary>
+	/// Watch a texture's image file
+	/// </summary>
+	/// <param name="texture">Texture (must have been opened from a file)</param>
+	void AssetWatcher::WatchTexture(std::shared_ptr<Texture> texture) {
+		if (texture->fileName.empty()) {
+			Engine::Error("Can't watch a texture that wasn't opened from a file.");
+		}
+
+		Watch watch;
+		watch.texture = texture;
+		watch.files[0] = texture->fileName;
+		AddWatch(watch);
+	}
+
+	/// <summary>
+	/// Watch a shader's code files
+	/// </summary>
+	/// <param name="shader">Shader</param>
+	/// <param name="vertexFile">Vertex shader file name (empty = no vertex shader)</param>
+	/// <param name="fragFile">Fragment shader file name (empty = no fragment shader)</param>
+	void AssetWatcher::WatchShader(std::shared_ptr<Shader> shader, std::string vertexFile, std::string fragFile) {
+		Watch watch;
+		watch.shader = shader;
+		watch.files[0] = vertexFile;
+		watch.files[1] = fragFile;
+		AddWatch(watch);
+	}
+
+	/// <summary>
+	/// Stop watching everything
+	/// </summary>
+	void AssetWatcher::Clear() {
+		if (watching) {
+			StopWatching();
+			watching = false;
+		}
+		watches.clear();
+		changedFiles.clear();
+	}
+
+	/// <summary>
+	/// Add a watched asset
+	/// </summary>
+	/// <param name="watch">Watched asset</param>
+	void AssetWatcher::AddWatch(Watch& watch) {
+		if (!watching) {
+			StartWatching();
+			watching = true;
+		}
+		for (const std::string& file : watch.files) {
+			if (!file.empty()) {
+				AddFile(file);
+				Engine::DebugMessage("ASSET WATCH:         " + file);
+			}
+		}
+		watches.push_back(watch);
+	}
+
+	/// <summary>
+	/// Reload assets whose files changed (called between frames)
+	/// </summary>
+	void AssetWatcher::Update() {
+		if (watches.empty()) {
+			return;
+		}
+
+		RemoveExpired();
+		changedFiles.clear();
+		GetChanges(changedFiles);
+		if (changedFiles.empty()) {
+			return;
+		}
+
+		bool renderIdle = false;
+		for (Watch& watch : watches) {
+			bool changed = false;
+			for (const std::string& file : watch.files) {
+				if (!file.empty() && std::find(changedFiles.begin(), changedFiles.end(), file) != changedFiles.end()) {
+					changed = true;
+				}
+			}
+
+			if (changed) {
+				// The render thread may still be drawing with the asset
+				if (!renderIdle) {
+					Graphics::WaitRenderIdle();
+					renderIdle = true;
+				}
+				Reload(watch);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Stop watching assets that nothing else holds anymore, and the files only they used
+	/// </summary>
+	void AssetWatcher::RemoveExpired() {
+		// Assets are only watched for as long as something else holds them
+		for (size_t i = 0; i < watches.size();) {
+			if (!watches[i].texture.expired() || !watches[i].shader.expired()) {
+				++i;
+				continue;
+			}
+
+			Watch watch = std::move(watches[i]);
+			watches.erase(watches.begin() + i);
+			for (const std::string& file : watch.files) {
+				if (file.empty()) {
+					continue;
+				}
+
+				bool used = false;
+				for (const Watch& other : watches) {
+					if (other.files[0] == file || other.files[1] == file) {
+						used = true;
+						break;
+					}
+				}
+				if (!used) {
+					RemoveFile(file);
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// Reload a watched asset
+	/// </summary>
+	/// <param name="watch">Watched asset</param>
+	void AssetWatcher::Reload(Watch& watch) {
+		AllocScope allocScope(AllocTag::Asset);
+
+		// A file that can't be read yet (or has errors) keeps the asset as it is until it's changed again
+		try {
+			std::shared_ptr<Texture> texture = watch.texture.lock();
+			if (texture) {
+				texture->Reload(Engine::OpenImage(watch.files[0]));
+			}
+
+			std::shared_ptr<Shader> shader = watch.shader.lock();
+			if (shader) {
+				std::string vertexCode = watch.files[0].empty() ? "" : Shader::ReadCode(watch.files[0]);
+				std::string fragCode = watch.files[1].empty() ? "" : Shader::ReadCode(watch.files[1]);
+				if (shader->Reload(vertexCode, fragCode)) {
+					Engine::DebugMessage("SHADER RELOAD:       " + (watch.files[0].empty() ? watch.files[1] : watch.files[0]));
+				}
+			}
+		}
+		catch (const std::exception& e) {
+			Engine::DebugMessage("ASSET RELOAD FAIL:   " + std::string(e.what()));
+		}
+	}
+
+}
@@ -0,0 +1,127 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#ifndef VIOLET_ASSET_WATCHER_HPP
+#define VIOLET_ASSET_WATCHER_HPP
+
+namespace Violet {
+
+	/// <summary>
+	/// Asset watcher (reloads textures and shaders in place when their files change)
+	/// </summary>
+	class AssetWatcher {
+	public:
+		/// <summary>
+		/// Watch a texture's image file
+		/// </summary>
+		/// <param name="texture">Texture (must have been opened from a file)</param>
+		static void WatchTexture(std::shared_ptr<Texture> texture);
+
+		/// <summary>
+		/// Watch a shader's code files
+		/// </summary>
+		/// <param name="shader">Shader</param>
+		/// <param name="vertexFile">Vertex shader file name (empty = no vertex shader)</param>
+		/// <param name="fragFile">Fragment shader file name (empty = no fragment shader)</param>
+		static void WatchShader(std::shared_ptr<Shader> shader, std::string vertexFile, std::string fragFile);
+
+		/// <summary>
+		/// Stop watching everything
+		/// </summary>
+		static void Clear();
+
+		// Friend classes
+		friend class Engine;
+
+	private:
+		/// <summary>
+		/// Watched asset
+		/// </summary>
+		struct Watch {
+			/// <summary>
+			/// Texture
+			/// </summary>
+			std::weak_ptr<Texture> texture;
+
+			/// <summary>
+			/// Shader
+			/// </summary>
+			std::weak_ptr<Shader> shader;
+
+			/// <summary>
+			/// Files (for shaders, the vertex and then the fragment shader file)
+			/// </summary>
+			std::string files[2];
+		};
+
+		/// <summary>
+		/// Add a watched asset
+		/// </summary>
+		/// <param name="watch">Watched asset</param>
+		static void AddWatch(Watch& watch);
+
+		/// <summary>
+		/// Reload assets whose files changed (called between frames)
+		/// </summary>
+		static void Update();
+
+		/// <summary>
+		/// Stop watching assets that nothing else holds anymore, and the files only they used
+		/// </summary>
+		static void RemoveExpired();
+
+		/// <summary>
+		/// Reload a watched asset
+		/// </summary>
+		/// <param name="watch">Watched asset</param>
+		static void Reload(Watch& watch);
+
+		/// <summary>
+		/// Start watching for file changes
+		/// </summary>
+		static void StartWatching();
+
+		/// <summary>
+		/// Watch a file for changes
+		/// </summary>
+		/// <param name="fileName">File name</param>
+		static void AddFile(const std::string& fileName);
+
+		/// <summary>
+		/// Stop watching a file
+		/// </summary>
+		/// <param name="fileName">File name (as it was added)</param>
+		static void RemoveFile(const std::string& fileName);
+
+		/// <summary>
+		/// Get files that changed since the last check (never blocks)
+		/// </summary>
+		/// <param name="changed">List to add the changed file names to (as they were added)</param>
+		static void GetChanges(std::vector<std::string>& changed);
+
+		/// <summary>
+		/// Stop watching for file changes
+		/// </summary>
+		static void StopWatching();
+
+		/// <summary>
+		/// Watched assets
+		/// </summary>
+		static std::vector<Watch> watches;
+
+		/// <summary>
+		/// Changed files found in the last update
+		/// </summary>
+		static std::vector<std::string> changedFiles;
+
+		/// <summary>
+		/// Watching started flag
+		/// </summary>
+		static bool watching;
+	};
+
+}
+
+#endif // VIOLET_ASSET_WATCHER_HPP
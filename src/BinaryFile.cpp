@@ -59,6 +59,29 @@ namespace Violet {
 		return value;
 	}
 
+	/// <summary>
+	/// Write value
+	/// </summary>
+	/// <typeparam name="T">Value type</typeparam>
+	/// <param name="fp">File handler</param>
+	/// <param name="fileName">File name</param>
+	/// <param name="read">Read flag</param>
+	/// <param name="value">Value</param>
+	template<typename T>
+	void WriteValue(FILE* fp, std::string fileName, bool read, const T value) {
+		if (fp) {
+			if (read) {
+				Engine::Error("File \"" + fileName + "\" isn't open for writing.");
+			}
+			else if (fwrite(&value, sizeof(T), 1, fp) != 1) {
+				Engine::Error("Failed to write value to file \"" + fileName + "\".");
+			}
+		}
+		else {
+			Engine::Error("File \"" + fileName + "\" isn't open.");
+		}
+	}
+
 	/// <summary>
 	/// Check if the file is at the end
 	/// </summary>
@@ -196,6 +219,147 @@ namespace Violet {
 		return "";
 	}
 
+	/// <summary>
+	/// Write signed 8-bit integer
+	/// </summary>
+	/// <param name="value">Value</param>
+	void BinaryFile::WriteInt8(const S8 value) {
+		WriteValue<S8>(fp, fileName, read, value);
+	}
+
+	/// <summary>
+	/// Write unsigned 8-bit integer
+	/// </summary>
+	/// <param name="value">Value</param>
+	void BinaryFile::WriteUInt8(const U8 value) {
+		WriteValue<U8>(fp, fileName, read, value);
+	}
+
+	/// <summary>
+	/// Write signed 16-bit integer
+	/// </summary>
+	/// <param name="value">Value</param>
+	void BinaryFile::WriteInt16(const S16 value) {
+		WriteValue<S16>(fp, fileName, read, value);
+	}
+
+	/// <summary>
+	/// Write unsigned 16-bit integer
+	/// </summary>
+	/// <param name="value">Value</param>
+	void BinaryFile::WriteUInt16(const U16 value) {
+		WriteValue<U16>(fp, fileName, read, value);
+	}
+
+	/// <summary>
+	/// Write signed 32-bit integer
+	/// </summary>
+	/// <param name="value">Value</param>
+	void BinaryFile::WriteInt32(const S32 value) {
+		WriteValue<S32>(fp, fileName, read, value);
+	}
+
+	/// <summary>
+	/// Write unsigned 32-bit integer
+	/// </summary>
+	/// <param name="value">Value</param>
+	void BinaryFile::WriteUInt32(const U32 value) {
+		WriteValue<U32>(fp, fileName, read, value);
+	}
+
+	/// <summary>
+	/// Write signed 64-bit integer
+	/// </summary>
+	/// <param name="value">Value</param>
+	void BinaryFile::WriteInt64(const S64 value) {
+		WriteValue<S64>(fp, fileName, read, value);
+	}
+
+	/// <summary>
+	/// Write unsigned 64-bit integer
+	/// </summary>
+	/// <param name="value">Value</param>
+	void BinaryFile::WriteUInt64(const U64 value) {
+		WriteValue<U64>(fp, fileName, read, value);
+	}
+
+	/// <summary>
+	/// Write float
+	/// </summary>
+	/// <param name="value">Value</param>
+	void BinaryFile::WriteFloat(const float value) {
+		WriteValue<float>(fp, fileName, read, value);
+	}
+
+	/// <summary>
+	/// Write double
+	/// </summary>
+	/// <param name="value">Value</param>
+	void BinaryFile::WriteDouble(const double value) {
+		WriteValue<double>(fp, fileName, read, value);
+	}
+
+	/// <summary>
+	/// Write string
+	/// </summary>
+	/// <param name="str">String</param>
+	/// <param name="terminate">Write null terminator flag</param>
+	void BinaryFile::WriteString(std::string str, const bool terminate) {
+		WriteData(str.c_str(), str.length() + (terminate ? 1 : 0));
+	}
+
+	/// <summary>
+	/// Read raw data
+	/// </summary>
+	/// <param name="data">Data buffer</param>
+	/// <param name="size">Data size</param>
+	void BinaryFile::ReadData(void* const data, const size_t size) {
+		if (!fp) {
+			Engine::Error("File \"" + fileName + "\" isn't open.");
+		}
+		else if (!read) {
+			Engine::Error("File \"" + fileName + "\" isn't open for reading.");
+		}
+		else if (size > 0 && fread(data, 1, size, fp) != size) {
+			Engine::Error("Failed to read data from file \"" + fileName + "\".");
+		}
+	}
+
+	/// <summary>
+	/// Write raw data
+	/// </summary>
+	/// <param name="data">Data</param>
+	/// <param name="size">Data size</param>
+	void BinaryFile::WriteData(const void* const data, const size_t size) {
+		if (!fp) {
+			Engine::Error("File \"" + fileName + "\" isn't open.");
+		}
+		else if (read) {
+			Engine::Error("File \"" + fileName + "\" isn't open for writing.");
+		}
+		else if (size > 0 && fwrite(data, 1, size, fp) != size) {
+			Engine::Error("Failed to write data to file \"" + fileName + "\".");
+		}
+	}
+
+	/// <summary>
+	/// Seek to a position in the file
+	/// </summary>
+	/// <param name="pos">Position from the start of the file</param>
+	void BinaryFile::Seek(const long pos) {
+		if (!fp || fseek(fp, pos, SEEK_SET) != 0) {
+			Engine::Error("Failed to seek in file \"" + fileName + "\".");
+		}
+	}
+
+	/// <summary>
+	/// Get the current position in the file
+	/// </summary>
+	/// <returns>Position from the start of the file</returns>
+	long BinaryFile::GetPosition() {
+		return fp ? ftell(fp) : 0;
+	}
+
 	/// <summary>
 	/// Open binary file for reading
 	/// </summary>
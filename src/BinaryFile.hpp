@@ -91,6 +91,99 @@ namespace Violet {
 		/// <returns>Read string</returns>
 		std::string ReadString(int length = 0);
 
+		/// <summary>
+		/// Write signed 8-bit integer
+		/// </summary>
+		/// <param name="value">Value</param>
+		void WriteInt8(const S8 value);
+
+		/// <summary>
+		/// Write unsigned 8-bit integer
+		/// </summary>
+		/// <param name="value">Value</param>
+		void WriteUInt8(const U8 value);
+
+		/// <summary>
+		/// Write signed 16-bit integer
+		/// </summary>
+		/// <param name="value">Value</param>
+		void WriteInt16(const S16 value);
+
+		/// <summary>
+		/// Write unsigned 16-bit integer
+		/// </summary>
+		/// <param name="value">Value</param>
+		void WriteUInt16(const U16 value);
+
+		/// <summary>
+		/// Write signed 32-bit integer
+		/// </summary>
+		/// <param name="value">Value</param>
+		void WriteInt32(const S32 value);
+
+		/// <summary>
+		/// Write unsigned 32-bit integer
+		/// </summary>
+		/// <param name="value">Value</param>
+		void WriteUInt32(const U32 value);
+
+		/// <summary>
+		/// Write signed 64-bit integer
+		/// </summary>
+		/// <param name="value">Value</param>
+		void WriteInt64(const S64 value);
+
+		/// <summary>
+		/// Write unsigned 64-bit integer
+		/// </summary>
+		/// <param name="value">Value</param>
+		void WriteUInt64(const U64 value);
+
+		/// <summary>
+		/// Write float
+		/// </summary>
+		/// <param name="value">Value</param>
+		void WriteFloat(const float value);
+
+		/// <summary>
+		/// Write double
+		/// </summary>
+		/// <param name="value">Value</param>
+		void WriteDouble(const double value);
+
+		/// <summary>
+		/// Write string
+		/// </summary>
+		/// <param name="str">String</param>
+		/// <param name="terminate">Write null terminator flag</param>
+		void WriteString(std::string str, const bool terminate = true);
+
+		/// <summary>
+		/// Read raw data
+		/// </summary>
+		/// <param name="data">Data buffer</param>
+		/// <param name="size">Data size</param>
+		void ReadData(void* const data, const size_t size);
+
+		/// <summary>
+		/// Write raw data
+		/// </summary>
+		/// <param name="data">Data</param>
+		/// <param name="size">Data size</param>
+		void WriteData(const void* const data, const size_t size);
+
+		/// <summary>
+		/// Seek to a position in the file
+		/// </summary>
+		/// <param name="pos">Position from the start of the file</param>
+		void Seek(const long pos);
+
+		/// <summary>
+		/// Get the current position in the file
+		/// </summary>
+		/// <returns>Position from the start of the file</returns>
+		long GetPosition();
+
 		// Friend classes
 		friend class Engine;
 
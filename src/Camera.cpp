@@ -0,0 +1,120 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+namespace Violet {
+
+	/// <summary>
+	/// Set position (the point shown at the top left of the view, before zooming and rotating)
+	/// </summary>
+	/// <param name="pos">Position</param>
+	void Camera::SetPosition(const Vec2D<float> pos) {
+		this->pos = pos;
+		visibleDirty = true;
+	}
+
+	/// <summary>
+	/// Move position
+	/// </summary>
+	/// <param name="offset">Offset</param>
+	void Camera::Move(const Vec2D<float> offset) {
+		pos.x += offset.x;
+		pos.y += offset.y;
+		visibleDirty = true;
+	}
+
+	/// <summary>
+	/// Get position
+	/// </summary>
+	/// <returns>Position</returns>
+	Vec2D<float> Camera::GetPosition() const {
+		return pos;
+	}
+
+	/// <summary>
+	/// Set zoom (around the center of the view)
+	/// </summary>
+	/// <param name="zoom">Zoom (1 = no zoom)</param>
+	void Camera::SetZoom(const float zoom) {
+		if (zoom <= 0) {
+			Engine::Error("Invalid camera zoom \"" + std::to_string(zoom) + "\".");
+		}
+		this->zoom = zoom;
+		visibleDirty = true;
+	}
+
+	/// <summary>
+	/// Get zoom
+	/// </summary>
+	/// <returns>Zoom</returns>
+	float Camera::GetZoom() const {
+		return zoom;
+	}
+
+	/// <summary>
+	/// Set angle (around the center of the view)
+	/// </summary>
+	/// <param name="angle">Angle (in degrees)</param>
+	void Camera::SetAngle(const float angle) {
+		this->angle = angle;
+		visibleDirty = true;
+	}
+
+	/// <summary>
+	/// Get angle
+	/// </summary>
+	/// <returns>Angle (in degrees)</returns>
+	float Camera::GetAngle() const {
+		return angle;
+	}
+
+	/// <summary>
+	/// Get the area that the camera can see
+	/// </summary>
+	/// <param name="viewSize">View size</param>
+	/// <returns>Visible area (bounding box if rotated)</returns>
+	Rect<float> Camera::GetVisibleRect(const Size2D<int> viewSize) {
+		if (visibleDirty || viewSize.w != visibleViewSize.w || viewSize.h != visibleViewSize.h) {
+			// The view's corners are rotated and scaled around its center, so the box only depends on the extents
+			float cos = Math::Abs(Math::CosDeg(angle));
+			float sin = Math::Abs(Math::SinDeg(angle));
+			float halfW = viewSize.w / 2.0f;
+			float halfH = viewSize.h / 2.0f;
+			float extentX = ((cos * halfW) + (sin * halfH)) / zoom;
+			float extentY = ((sin * halfW) + (cos * halfH)) / zoom;
+
+			visibleRect = { pos.x + halfW - extentX, pos.y + halfH - extentY, extentX * 2, extentY * 2 };
+			visibleViewSize = viewSize;
+			visibleDirty = false;
+		}
+		return visibleRect;
+	}
+
+	/// <summary>
+	/// Get view matrix
+	/// </summary>
+	/// <param name="viewSize">View size</param>
+	/// <returns>View matrix</returns>
+	Matrix4x4<float> Camera::GetViewMat(const Size2D<int> viewSize) const {
+		// Move the camera's center to the origin, zoom and rotate around it, and then move it back to the view's center
+		float centerX = viewSize.w / 2.0f;
+		float centerY = viewSize.h / 2.0f;
+		glm::mat4 view = glm::translate(glm::mat4(1.0f), glm::vec3(centerX, centerY, 0.0f));
+		view = glm::rotate(view, Math::DegToRad(-angle), glm::vec3(0, 0, 1));
+		view = glm::scale(view, glm::vec3(zoom, zoom, 1));
+		view = glm::translate(view, glm::vec3(-(pos.x + centerX), -(pos.y + centerY), 0.0f));
+		return view;
+	}
+
+	/// <summary>
+	/// Create camera
+	/// </summary>
+	/// <returns>Created camera</returns>
+	std::shared_ptr<Camera> Engine::CreateCamera() {
+		return std::shared_ptr<Camera>(new Camera());
+	}
+
+}
@@ -0,0 +1,115 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#ifndef VIOLET_CAMERA_HPP
+#define VIOLET_CAMERA_HPP
+
+namespace Violet {
+
+	/// <summary>
+	/// Camera (view transform for the layers that it's assigned to with Graphics::SetCamera)
+	/// </summary>
+	class Camera {
+	public:
+		// Friend classes
+		friend class Engine;
+		friend class Graphics;
+
+		/// <summary>
+		/// Set position (the point shown at the top left of the view, before zooming and rotating)
+		/// </summary>
+		/// <param name="pos">Position</param>
+		void SetPosition(const Vec2D<float> pos);
+
+		/// <summary>
+		/// Move position
+		/// </summary>
+		/// <param name="offset">Offset</param>
+		void Move(const Vec2D<float> offset);
+
+		/// <summary>
+		/// Get position
+		/// </summary>
+		/// <returns>Position</returns>
+		Vec2D<float> GetPosition() const;
+
+		/// <summary>
+		/// Set zoom (around the center of the view)
+		/// </summary>
+		/// <param name="zoom">Zoom (1 = no zoom)</param>
+		void SetZoom(const float zoom);
+
+		/// <summary>
+		/// Get zoom
+		/// </summary>
+		/// <returns>Zoom</returns>
+		float GetZoom() const;
+
+		/// <summary>
+		/// Set angle (around the center of the view)
+		/// </summary>
+		/// <param name="angle">Angle (in degrees)</param>
+		void SetAngle(const float angle);
+
+		/// <summary>
+		/// Get angle
+		/// </summary>
+		/// <returns>Angle (in degrees)</returns>
+		float GetAngle() const;
+
+		/// <summary>
+		/// Get the area that the camera can see
+		/// </summary>
+		/// <param name="viewSize">View size</param>
+		/// <returns>Visible area (bounding box if rotated)</returns>
+		Rect<float> GetVisibleRect(const Size2D<int> viewSize);
+
+		/// <summary>
+		/// Get view matrix
+		/// </summary>
+		/// <param name="viewSize">View size</param>
+		/// <returns>View matrix</returns>
+		Matrix4x4<float> GetViewMat(const Size2D<int> viewSize) const;
+
+	private:
+		/// <summary>
+		/// Camera constructor
+		/// </summary>
+		Camera() = default;
+
+		/// <summary>
+		/// Position
+		/// </summary>
+		Vec2D<float> pos{ Vec2D<float>(0, 0) };
+
+		/// <summary>
+		/// Zoom
+		/// </summary>
+		float zoom{ 1 };
+
+		/// <summary>
+		/// Angle
+		/// </summary>
+		float angle{ 0 };
+
+		/// <summary>
+		/// Visible area (cached, as it's checked for every sprite)
+		/// </summary>
+		Rect<float> visibleRect;
+
+		/// <summary>
+		/// View size that the visible area was found for
+		/// </summary>
+		Size2D<int> visibleViewSize{ Size2D<int>(0, 0) };
+
+		/// <summary>
+		/// Visible area out of date flag
+		/// </summary>
+		bool visibleDirty{ true };
+	};
+
+}
+
+#endif // VIOLET_CAMERA_HPP
@@ -27,6 +27,29 @@ namespace Violet {
 	/// </summary>
 	double Engine::startTick{ 0 };
 
+	/// <summary>
+	/// Number of frames to run for before exiting
+	/// </summary>
+	U64 Engine::maxFrames{ 0 };
+
+	/// <summary>
+	/// Exit requested flag
+	/// </summary>
+	bool Engine::exitRequested{ false };
+
+	/// <summary>
+	/// Get time elapsed since a startup step began, and start the next one
+	/// </summary>
+	/// <param name="stepStart">Time that the step began at (set to the current time)</param>
+	/// <returns>Time elapsed (in milliseconds)</returns>
+	static double EndStartupStep(std::chrono::steady_clock::time_point& stepStart) {
+		// The shell's timer isn't available until the shell is initialized, so use the standard clock
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		double time = std::chrono::duration<double, std::milli>(now - stepStart).count();
+		stepStart = now;
+		return time;
+	}
+
 	/// <summary>
 	/// Run engine
 	/// </summary>
@@ -34,9 +57,19 @@ namespace Violet {
 		try
 		{
 			// Initialize
+			StartupStats& startup = EngineTimer::startupStats;
+			std::chrono::steady_clock::time_point runStart = std::chrono::steady_clock::now();
+			std::chrono::steady_clock::time_point stepStart = runStart;
+			startup = {};
+
 			Shell::Initialize();
+			startup.shellTime = EndStartupStep(stepStart);
 			Graphics::Initialize();
+			Graphics::StartRenderThread();
+			startup.graphicsTime = EndStartupStep(stepStart);
 			Sound::Initialize();
+			Sound::StartDevice();
+			startup.soundTime = EndStartupStep(stepStart);
 			startTick = Shell::GetTick();
 			SetVSync(GetVSync());
 			EngineTimer::Start();
@@ -44,17 +77,35 @@ namespace Violet {
 
 			// Start
 			DebugMessage("APPLICATION START:   " + GetAppName());
+			EndStartupStep(stepStart);
 			app->OnStart();
 			SetScene<StartupScene>();
+			startup.appTime = EndStartupStep(stepStart);
+			startup.totalTime = EndStartupStep(runStart);
+			startup.shaders = ShaderCache::GetStats();
+
+			DebugMessage("STARTUP:             shell " + std::to_string(startup.shellTime) + " ms, graphics " + std::to_string(startup.graphicsTime) +
+				" ms, sound " + std::to_string(startup.soundTime) + " ms, app " + std::to_string(startup.appTime) +
+				" ms, total " + std::to_string(startup.totalTime) + " ms");
+			DebugMessage("STARTUP SHADERS:     " + std::to_string(startup.shaders.shaders) + " (" + std::to_string(startup.shaders.cached) +
+				" from cache), " + std::to_string(startup.shaders.time) + " ms");
 
 			// Update loop
 			bool running = true;
+			U64 frames = 0;
+			exitRequested = false;
 			while (running) {
-				Input::NewFrame();
+				// Reload changed assets
+				AssetWatcher::Update();
 
 				// Update start
-				if (!Shell::UpdateEvents()) {
-					running = false;
+				{
+					AllocScope allocScope(AllocTag::Input);
+					Input::NewFrame();
+					if (!Shell::UpdateEvents()) {
+						running = false;
+					}
+					Input::LatchFrame();
 				}
 				EngineTimer::UpdateStart();
 
@@ -79,7 +130,9 @@ namespace Violet {
 				app->OnUpdateEnd();
 
 				// Fixed update
-				if (EngineTimer::fixedUpdate) {
+				for (int i = 0; i < EngineTimer::fixedSteps; ++i) {
+					InputRecorder::Step();
+
 					Graphics::curLayerType = LayerType::UpdateStart;
 					app->OnFixedUpdateStart();
 					scene->OnFixedUpdateStart();
@@ -94,6 +147,12 @@ namespace Violet {
 
 				// Draw update
 				if (EngineTimer::drawUpdate) {
+					// Sample input again so that the draw phase sees the latest state
+					if (EngineTimer::lowLatency) {
+						Shell::UpdateInput();
+						Input::LatchLate();
+					}
+
 					Graphics::curLayerType = LayerType::UpdateStart;
 					app->OnDrawStart();
 					scene->OnDrawStart();
@@ -106,9 +165,7 @@ namespace Violet {
 					app->OnDrawEnd();
 
 					Shell::UpdateGraphicsStart();
-					Graphics::Update();
-					Graphics::DrawSprites();
-					Shell::UpdateGraphicsEnd();
+					Graphics::SubmitFrame();
 				}
 
 				// Scene end
@@ -120,8 +177,19 @@ namespace Violet {
 				}
 
 				// Update end
+				Sound::UpdatePositions();
 				EngineTimer::UpdateEnd();
+				AllocTracker::EndFrame();
+				EngineTimer::WaitNextFrame();
+
+				if (exitRequested || (maxFrames > 0 && ++frames >= maxFrames)) {
+					running = false;
+				}
 			}
+
+			FrameTimeStats stats = GetFrameTimeStats();
+			DebugMessage("FRAME TIME:          " + std::to_string(stats.frames) + " frames, avg " + std::to_string(stats.average) +
+				" ms, p50 " + std::to_string(stats.p50) + " ms, p99 " + std::to_string(stats.p99) + " ms, max " + std::to_string(stats.maximum) + " ms");
 		}
 		catch (const std::exception& e) {
 			Message(MessageType::Error, e.what());
@@ -144,15 +212,35 @@ namespace Violet {
 	}
 
 
+	/// <summary>
+	/// Exit the engine at the end of the current frame
+	/// </summary>
+	void Engine::Exit() {
+		exitRequested = true;
+	}
+
+	/// <summary>
+	/// Set the number of frames to run for before exiting
+	/// </summary>
+	/// <param name="frames">Number of frames (0 = no limit)</param>
+	void Engine::SetMaxFrames(const U64 frames) {
+		maxFrames = frames;
+	}
+
 	/// <summary>
 	/// Close engine
 	/// </summary>
 	void Engine::Close() {
 		app = nullptr;
+		InputRecorder::Stop();
+		AssetWatcher::Clear();
+		Graphics::StopRenderThread();
+		Sound::StopDevice();
 		Shell::Dispose();
 		Texture::Unset();
 		VertexBuffer::Unset();
 		Shader::Unset();
+		RenderTarget::Unset();
 		Graphics::Dispose();
 		Sound::Dispose();
 		Actor::DisposePool();
@@ -18,6 +18,17 @@ namespace Violet {
 		/// </summary>
 		static void Run();
 
+		/// <summary>
+		/// Exit the engine at the end of the current frame
+		/// </summary>
+		static void Exit();
+
+		/// <summary>
+		/// Set the number of frames to run for before exiting
+		/// </summary>
+		/// <param name="frames">Number of frames (0 = no limit)</param>
+		static void SetMaxFrames(const U64 frames);
+
 		/***************/
 		/* APPLICATION */
 		/***************/
@@ -57,6 +68,13 @@ namespace Violet {
 		/// <returns>Opened image</returns>
 		static std::shared_ptr<Image> OpenImage(std::string fileName);
 
+		/// <summary>
+		/// Create blank image
+		/// </summary>
+		/// <param name="size">Image size</param>
+		/// <returns>Created image</returns>
+		static std::shared_ptr<Image> CreateImage(Size2D<int> size);
+
 		/// <summary>
 		/// Open texture
 		/// </summary>
@@ -65,6 +83,52 @@ namespace Violet {
 		/// <returns>Opened texture</returns>
 		static std::shared_ptr<Texture> OpenTexture(std::string fileName, TextureWrap wrap = TextureWrap::Repeat);
 
+		/// <summary>
+		/// Create texture from an image
+		/// </summary>
+		/// <param name="image">Image</param>
+		/// <param name="wrap">Wrap mode</param>
+		/// <returns>Created texture</returns>
+		static std::shared_ptr<Texture> CreateTexture(std::shared_ptr<Image> image, TextureWrap wrap = TextureWrap::Repeat);
+
+		/// <summary>
+		/// Open texture array
+		/// </summary>
+		/// <param name="fileNames">File names (1 per layer, all the same size)</param>
+		/// <param name="wrap">Wrap mode</param>
+		/// <returns>Opened texture array</returns>
+		static std::shared_ptr<Texture> OpenTextureArray(std::vector<std::string> fileNames, TextureWrap wrap = TextureWrap::Repeat);
+
+		/// <summary>
+		/// Create texture array from images
+		/// </summary>
+		/// <param name="images">Images (1 per layer, all the same size)</param>
+		/// <param name="wrap">Wrap mode</param>
+		/// <returns>Created texture array</returns>
+		static std::shared_ptr<Texture> CreateTextureArray(std::vector<std::shared_ptr<Image>> images, TextureWrap wrap = TextureWrap::Repeat);
+
+		/// <summary>
+		/// Create uniform buffer
+		/// </summary>
+		/// <param name="size">Size</param>
+		/// <param name="binding">Binding point</param>
+		/// <returns>Created uniform buffer</returns>
+		static std::shared_ptr<UniformBuffer> CreateUniformBuffer(const int size, const int binding);
+
+		/// <summary>
+		/// Create render target
+		/// </summary>
+		/// <param name="size">Size</param>
+		/// <param name="depth">Depth buffer flag</param>
+		/// <returns>Created render target</returns>
+		static std::shared_ptr<RenderTarget> CreateRenderTarget(const Size2D<int> size, const bool depth = false);
+
+		/// <summary>
+		/// Create camera
+		/// </summary>
+		/// <returns>Created camera</returns>
+		static std::shared_ptr<Camera> CreateCamera();
+
 		/// <summary>
 		/// Open sheet
 		/// </summary>
@@ -180,6 +244,78 @@ namespace Violet {
 		/// <returns>Draw update delta</returns>
 		static float GetDrawUpdateDelta();
 
+		/// <summary>
+		/// Get fixed update interpolation alpha
+		/// </summary>
+		/// <returns>Fraction of a fixed update elapsed since the last one (0 to 1)</returns>
+		static float GetFixedAlpha();
+
+		/// <summary>
+		/// Get number of fixed updates run this update
+		/// </summary>
+		/// <returns>Number of fixed updates</returns>
+		static int GetFixedSteps();
+
+		/// <summary>
+		/// Set maximum number of fixed updates per update
+		/// </summary>
+		/// <param name="steps">Maximum number of fixed updates</param>
+		static void SetMaxFixedSteps(const int steps);
+
+		/// <summary>
+		/// Set frame rate limit (used if VSync is disabled)
+		/// </summary>
+		/// <param name="fps">Frames per second (0 = display refresh rate, UnlimitedFrameRate = no limit)</param>
+		static void SetFrameLimit(const float fps);
+
+		/// <summary>
+		/// Set frame pacing spin margin
+		/// </summary>
+		/// <param name="time">Time to spin before a frame deadline instead of sleeping (in milliseconds)</param>
+		static void SetFrameSpinMargin(const double time);
+
+		/// <summary>
+		/// Set low latency mode (samples input again right before drawing, throttles queued frames
+		/// and, with VSync, delays the frame start towards the next vertical blank)
+		/// </summary>
+		/// <param name="enable">Low latency mode enable flag</param>
+		static void SetLowLatency(const bool enable);
+
+		/// <summary>
+		/// Get low latency mode
+		/// </summary>
+		/// <returns>Low latency mode enable flag</returns>
+		static bool GetLowLatency();
+
+		/// <summary>
+		/// Get latency statistics (low latency mode only)
+		/// </summary>
+		/// <returns>Latency statistics</returns>
+		static LatencyStats GetLatencyStats();
+
+		/// <summary>
+		/// Get startup statistics
+		/// </summary>
+		/// <returns>Startup statistics</returns>
+		static StartupStats GetStartupStats();
+
+		/// <summary>
+		/// Get frame pacing statistics
+		/// </summary>
+		/// <returns>Frame pacing statistics</returns>
+		static FramePaceStats GetFramePaceStats();
+
+		/// <summary>
+		/// Get frame time statistics
+		/// </summary>
+		/// <returns>Frame time statistics</returns>
+		static FrameTimeStats GetFrameTimeStats();
+
+		/// <summary>
+		/// Reset frame time statistics
+		/// </summary>
+		static void ResetFrameTimeStats();
+
 		/// <summary>
 		/// Get game frames per second
 		/// </summary>
@@ -244,6 +380,16 @@ namespace Violet {
 		/// Start tick
 		/// </summary>
 		static double startTick;
+
+		/// <summary>
+		/// Number of frames to run for before exiting
+		/// </summary>
+		static U64 maxFrames;
+
+		/// <summary>
+		/// Exit requested flag
+		/// </summary>
+		static bool exitRequested;
 	};
 
 }
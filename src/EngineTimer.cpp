@@ -33,14 +33,24 @@ namespace Violet {
 	float EngineTimer::updateDelta{ 0 };
 
 	/// <summary>
-	/// Fixed update tick
+	/// Fixed update time accumulator (in milliseconds)
 	/// </summary>
-	double EngineTimer::fixedUpdateTick{ 0 };
+	double EngineTimer::fixedAccum{ 0 };
 
 	/// <summary>
-	/// Fixed update flag
+	/// Number of fixed updates to run this update
 	/// </summary>
-	bool EngineTimer::fixedUpdate{ false };
+	int EngineTimer::fixedSteps{ 0 };
+
+	/// <summary>
+	/// Maximum number of fixed updates per update
+	/// </summary>
+	int EngineTimer::maxFixedSteps{ 5 };
+
+	/// <summary>
+	/// Fixed update interpolation alpha
+	/// </summary>
+	float EngineTimer::fixedAlpha{ 0 };
 
 	/// <summary>
 	/// Draw update tick
@@ -72,6 +82,66 @@ namespace Violet {
 	/// </summary>
 	bool EngineTimer::drawUpdate{ false };
 
+	/// <summary>
+	/// Next draw update deadline tick
+	/// </summary>
+	double EngineTimer::nextDrawTick{ 0 };
+
+	/// <summary>
+	/// Frame rate limit (0 = display refresh rate)
+	/// </summary>
+	float EngineTimer::frameLimit{ 0 };
+
+	/// <summary>
+	/// Time to spin before a deadline instead of sleeping (in milliseconds)
+	/// </summary>
+	double EngineTimer::spinMargin{ 2 };
+
+	/// <summary>
+	/// Frame pacing statistics
+	/// </summary>
+	FramePaceStats EngineTimer::paceStats;
+
+	/// <summary>
+	/// Low latency mode flag
+	/// </summary>
+	bool EngineTimer::lowLatency{ false };
+
+	/// <summary>
+	/// Average time from frame start until the draw commands are submitted (in milliseconds)
+	/// </summary>
+	double EngineTimer::workTime{ 0 };
+
+	/// <summary>
+	/// Tick that the last frame was presented at
+	/// </summary>
+	double EngineTimer::presentTick{ 0 };
+
+	/// <summary>
+	/// Latency statistics
+	/// </summary>
+	LatencyStats EngineTimer::latencyStats;
+
+	/// <summary>
+	/// Latency statistics mutex (frames may be presented by the render thread)
+	/// </summary>
+	std::mutex EngineTimer::latencyMutex;
+
+	/// <summary>
+	/// Frame time statistics
+	/// </summary>
+	FrameTimeStats EngineTimer::frameTimeStats;
+
+	/// <summary>
+	/// Frame time histogram (the last bucket also counts all longer frames)
+	/// </summary>
+	std::vector<U32> EngineTimer::frameTimeHistogram;
+
+	/// <summary>
+	/// Startup statistics
+	/// </summary>
+	StartupStats EngineTimer::startupStats;
+
 	/// <summary>
 	/// Game frames per second
 	/// </summary>
@@ -82,8 +152,16 @@ namespace Violet {
 	/// </summary>
 	void EngineTimer::Start() {
 		updateTick = Engine::GetTicks();
-		fixedUpdateTick = updateTick;
 		drawUpdateTick = updateTick;
+		nextDrawTick = updateTick;
+		paceStats = {};
+		latencyStats = {};
+		Engine::ResetFrameTimeStats();
+		workTime = 0;
+		presentTick = 0;
+		fixedAccum = 0;
+		fixedSteps = 0;
+		fixedAlpha = 0;
 	}
 
 	/// <summary>
@@ -91,38 +169,186 @@ namespace Violet {
 	/// </summary>
 	void EngineTimer::UpdateStart() {
 		currentTick = Engine::GetTicks();
-		fixedUpdate = (currentTick - fixedUpdateTick) >= 1000 / gameFPS;
 
-		drawUpdate = false;
-		if (!Engine::GetVSync()) {
-			if ((currentTick - drawUpdateTick) >= 1000 / drawFPS) {
-				drawUpdate = true;
-			}
-		}
-		else {
-			drawUpdate = true;
+		// Accumulate elapsed time and run as many fixed updates as it covers
+		double fixedStep = 1000.0 / gameFPS;
+		fixedAccum += currentTick - updateTick;
+		fixedSteps = static_cast<int>(fixedAccum / fixedStep);
+		if (fixedSteps > maxFixedSteps) {
+			// Too far behind to catch up, drop the extra time instead of spiraling
+			fixedAccum -= (fixedSteps - maxFixedSteps) * fixedStep;
+			fixedSteps = maxFixedSteps;
 		}
+		fixedAccum -= fixedSteps * fixedStep;
+		fixedAlpha = static_cast<float>(fixedAccum / fixedStep);
+
+		drawUpdate = Engine::GetVSync() || currentTick >= nextDrawTick;
 	}
 
 	/// <summary>
 	/// End engine timer update
 	/// </summary>
 	void EngineTimer::UpdateEnd() {
+		AddFrameTime(currentTick - updateTick);
 		updateFreq = static_cast<float>(currentTick - updateTick);
 		updateFPS = 1000 / updateFreq;
 		updateDelta = updateFreq * (gameFPS / 1000);
 		updateTick = currentTick;
 
-		if (fixedUpdate) {
-			fixedUpdateTick = currentTick;
-		}
-
 		if (drawUpdate) {
 			drawUpdateFreq = static_cast<float>(currentTick - drawUpdateTick);
 			drawUpdateDelta = drawUpdateFreq * (gameFPS / 1000);
 			drawUpdateTick = currentTick;
+
+			// Advance the deadline by a whole frame so that wake up error doesn't add up,
+			// unless we fell behind by more than a frame
+			if (frameLimit < 0) {
+				nextDrawTick = currentTick;
+			}
+			else {
+				double frameTime = 1000.0 / GetFrameRate();
+				nextDrawTick += frameTime;
+				if (nextDrawTick < currentTick) {
+					nextDrawTick = currentTick + frameTime;
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// Wait until the next frame is due
+	/// </summary>
+	void EngineTimer::WaitNextFrame() {
+		if (Engine::GetVSync()) {
+			// In low latency mode, start the frame as late as possible before the next vertical blank.
+			// This only works if the last present time is known to be right after a vertical blank.
+			if (lowLatency && presentTick > 0 && Graphics::maxQueuedFrames == 0 && !Graphics::renderThreaded) {
+				double start = Engine::GetTicks();
+				double target = presentTick + (1000.0 / drawFPS) - workTime - spinMargin;
+				if (target > start) {
+					WaitUntil(target);
+				}
+
+				std::lock_guard<std::mutex> lock(latencyMutex);
+				double delay = Engine::GetTicks() - start;
+				latencyStats.startDelay += (delay - latencyStats.startDelay) * 0.1;
+			}
+			return;
+		}
+		if (frameLimit < 0) {
+			// Unlimited
+			return;
+		}
+
+		double start = Engine::GetTicks();
+		double spinStart = WaitUntil(nextDrawTick);
+		double now = Engine::GetTicks();
+
+		// Only count frames that actually waited
+		if (now > start) {
+			double jitter = now - nextDrawTick;
+			if (spinStart > nextDrawTick) {
+				++paceStats.oversleeps;
+			}
+			++paceStats.frames;
+			paceStats.sleepTime += spinStart - start;
+			paceStats.spinTime += now - spinStart;
+			paceStats.jitter += (jitter - paceStats.jitter) / paceStats.frames;
+			paceStats.maxJitter = Math::Max(paceStats.maxJitter, jitter);
+		}
+	}
+
+	/// <summary>
+	/// Wait until a tick, sleeping first and spinning for the rest
+	/// </summary>
+	/// <param name="tick">Tick to wait for</param>
+	/// <returns>Tick that spinning started at</returns>
+	double EngineTimer::WaitUntil(const double tick) {
+		// Sleep for most of the wait, leaving the last bit to spin since sleeping isn't precise
+		double now = Engine::GetTicks();
+		if (tick - now > spinMargin) {
+			Shell::Sleep(tick - now - spinMargin);
+		}
+
+		double spinStart = Engine::GetTicks();
+		now = spinStart;
+		while (now < tick) {
+			std::this_thread::yield();
+			now = Engine::GetTicks();
+		}
+		return spinStart;
+	}
+
+	/// <summary>
+	/// Mark the frame's draw commands as submitted
+	/// </summary>
+	void EngineTimer::FrameSubmitted() {
+		double time = Engine::GetTicks() - currentTick;
+		workTime = (workTime == 0) ? time : workTime + (time - workTime) * 0.1;
+	}
+
+	/// <summary>
+	/// Mark a frame as presented
+	/// </summary>
+	/// <param name="inputTick">Tick that the frame's input was sampled at</param>
+	/// <param name="presentTick">Tick that the frame was found to be presented at</param>
+	void EngineTimer::FramePresented(const double inputTick, const double presentTick) {
+		std::lock_guard<std::mutex> lock(latencyMutex);
+		EngineTimer::presentTick = presentTick;
+
+		// Assume the frame takes half a refresh on average to scan out to where the player is looking
+		double latency = presentTick - inputTick + (500.0 / drawFPS);
+		++latencyStats.frames;
+		latencyStats.inputToPhoton += (latency - latencyStats.inputToPhoton) / Math::Min(latencyStats.frames, static_cast<U64>(60));
+		latencyStats.maxInputToPhoton = Math::Max(latencyStats.maxInputToPhoton, latency);
+	}
+
+	/// <summary>
+	/// Add a frame time to the statistics
+	/// </summary>
+	/// <param name="time">Frame time (in milliseconds)</param>
+	void EngineTimer::AddFrameTime(const double time) {
+		FrameTimeStats& stats = frameTimeStats;
+		if (stats.frames == 0) {
+			stats.minimum = time;
+			stats.maximum = time;
 		}
+		else {
+			stats.minimum = Math::Min(stats.minimum, time);
+			stats.maximum = Math::Max(stats.maximum, time);
+		}
+		++stats.frames;
+		stats.average += (time - stats.average) / stats.frames;
+
+		int bucket = Math::Min(static_cast<int>(time / FrameTimeBucketSize), FrameTimeBuckets - 1);
+		++frameTimeHistogram[Math::Max(bucket, 0)];
+	}
+
+	/// <summary>
+	/// Get a frame time percentile from the histogram
+	/// </summary>
+	/// <param name="percentile">Percentile (0-1)</param>
+	/// <returns>Frame time (in milliseconds)</returns>
+	double EngineTimer::GetFrameTimePercentile(const double percentile) {
+		U64 target = static_cast<U64>(Math::Ceil(frameTimeStats.frames * percentile));
+		U64 count = 0;
+		for (int i = 0; i < FrameTimeBuckets; ++i) {
+			count += frameTimeHistogram[i];
+			if (count >= target && count > 0) {
+				// Report the middle of the bucket, kept within the measured range
+				double time = (i + 0.5) * FrameTimeBucketSize;
+				return Math::Max(Math::Min(time, frameTimeStats.maximum), frameTimeStats.minimum);
+			}
+		}
+		return frameTimeStats.maximum;
+	}
 
+	/// <summary>
+	/// Get frame rate to pace to
+	/// </summary>
+	/// <returns>Frame rate</returns>
+	float EngineTimer::GetFrameRate() {
+		return (frameLimit > 0) ? frameLimit : drawFPS;
 	}
 
 	/// <summary>
@@ -141,6 +367,118 @@ namespace Violet {
 		return EngineTimer::drawUpdateDelta;
 	}
 
+	/// <summary>
+	/// Get fixed update interpolation alpha
+	/// </summary>
+	/// <returns>Fraction of a fixed update elapsed since the last one (0 to 1)</returns>
+	float Engine::GetFixedAlpha() {
+		return EngineTimer::fixedAlpha;
+	}
+
+	/// <summary>
+	/// Get number of fixed updates run this update
+	/// </summary>
+	/// <returns>Number of fixed updates</returns>
+	int Engine::GetFixedSteps() {
+		return EngineTimer::fixedSteps;
+	}
+
+	/// <summary>
+	/// Set maximum number of fixed updates per update
+	/// </summary>
+	/// <param name="steps">Maximum number of fixed updates</param>
+	void Engine::SetMaxFixedSteps(const int steps) {
+		if (steps <= 0) {
+			Error("Invalid fixed update step count \"" + std::to_string(steps) + "\".");
+		}
+		EngineTimer::maxFixedSteps = steps;
+	}
+
+	/// <summary>
+	/// Set frame rate limit (used if VSync is disabled)
+	/// </summary>
+	/// <param name="fps">Frames per second (0 = display refresh rate, UnlimitedFrameRate = no limit)</param>
+	void Engine::SetFrameLimit(const float fps) {
+		if (fps < 0 && fps != UnlimitedFrameRate) {
+			Error("Invalid FPS value \"" + std::to_string(fps) + "\".");
+		}
+		EngineTimer::frameLimit = fps;
+	}
+
+	/// <summary>
+	/// Set frame pacing spin margin
+	/// </summary>
+	/// <param name="time">Time to spin before a frame deadline instead of sleeping (in milliseconds)</param>
+	void Engine::SetFrameSpinMargin(const double time) {
+		if (time < 0) {
+			Error("Invalid spin margin \"" + std::to_string(time) + "\".");
+		}
+		EngineTimer::spinMargin = time;
+	}
+
+	/// <summary>
+	/// Set low latency mode
+	/// </summary>
+	/// <param name="enable">Low latency mode enable flag</param>
+	void Engine::SetLowLatency(const bool enable) {
+		EngineTimer::lowLatency = enable;
+	}
+
+	/// <summary>
+	/// Get low latency mode
+	/// </summary>
+	/// <returns>Low latency mode enable flag</returns>
+	bool Engine::GetLowLatency() {
+		return EngineTimer::lowLatency;
+	}
+
+	/// <summary>
+	/// Get latency statistics (low latency mode only)
+	/// </summary>
+	/// <returns>Latency statistics</returns>
+	LatencyStats Engine::GetLatencyStats() {
+		std::lock_guard<std::mutex> lock(EngineTimer::latencyMutex);
+		return EngineTimer::latencyStats;
+	}
+
+	/// <summary>
+	/// Get frame time statistics
+	/// </summary>
+	/// <returns>Frame time statistics</returns>
+	FrameTimeStats Engine::GetFrameTimeStats() {
+		FrameTimeStats stats = EngineTimer::frameTimeStats;
+		if (stats.frames > 0) {
+			stats.p50 = EngineTimer::GetFrameTimePercentile(0.5);
+			stats.p95 = EngineTimer::GetFrameTimePercentile(0.95);
+			stats.p99 = EngineTimer::GetFrameTimePercentile(0.99);
+		}
+		return stats;
+	}
+
+	/// <summary>
+	/// Reset frame time statistics
+	/// </summary>
+	void Engine::ResetFrameTimeStats() {
+		EngineTimer::frameTimeStats = {};
+		EngineTimer::frameTimeHistogram.assign(FrameTimeBuckets, 0);
+	}
+
+	/// <summary>
+	/// Get startup statistics
+	/// </summary>
+	/// <returns>Startup statistics</returns>
+	StartupStats Engine::GetStartupStats() {
+		return EngineTimer::startupStats;
+	}
+
+	/// <summary>
+	/// Get frame pacing statistics
+	/// </summary>
+	/// <returns>Frame pacing statistics</returns>
+	FramePaceStats Engine::GetFramePaceStats() {
+		return EngineTimer::paceStats;
+	}
+
 	/// <summary>
 	/// Get game frames per second
 	/// </summary>
@@ -162,7 +500,11 @@ namespace Violet {
 	/// </summary>
 	/// <returns>Draw frames per second</returns>
 	float Engine::GetDrawFPS() {
-		return EngineTimer::drawFPS;
+		if (!Engine::GetVSync() && EngineTimer::frameLimit < 0) {
+			// Nothing to pace to, so go by how long the last frame actually took
+			return (EngineTimer::drawUpdateFreq > 0) ? (1000 / EngineTimer::drawUpdateFreq) : EngineTimer::drawFPS;
+		}
+		return Engine::GetVSync() ? EngineTimer::drawFPS : EngineTimer::GetFrameRate();
 	}
 
 	/// <summary>
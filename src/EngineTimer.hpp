@@ -8,6 +8,156 @@
 
 namespace Violet {
 
+	/// <summary>
+	/// Frame pacing statistics
+	/// </summary>
+	struct FramePaceStats {
+		/// <summary>
+		/// Number of frames waited for
+		/// </summary>
+		U64 frames{ 0 };
+
+		/// <summary>
+		/// Number of frames where sleeping overshot the deadline
+		/// </summary>
+		U64 oversleeps{ 0 };
+
+		/// <summary>
+		/// Time spent sleeping (in milliseconds)
+		/// </summary>
+		double sleepTime{ 0 };
+
+		/// <summary>
+		/// Time spent spinning (in milliseconds)
+		/// </summary>
+		double spinTime{ 0 };
+
+		/// <summary>
+		/// Average time woken up past the deadline (in milliseconds)
+		/// </summary>
+		double jitter{ 0 };
+
+		/// <summary>
+		/// Maximum time woken up past the deadline (in milliseconds)
+		/// </summary>
+		double maxJitter{ 0 };
+	};
+
+	/// <summary>
+	/// Frame limit that turns frame pacing off, so frames run as fast as possible when VSync is disabled
+	/// </summary>
+	constexpr float UnlimitedFrameRate = -1;
+
+	/// <summary>
+	/// Frame time histogram bucket count
+	/// </summary>
+	constexpr int FrameTimeBuckets = 10000;
+
+	/// <summary>
+	/// Frame time histogram bucket size (in milliseconds)
+	/// </summary>
+	constexpr double FrameTimeBucketSize = 0.01;
+
+	/// <summary>
+	/// Frame time statistics
+	/// </summary>
+	struct FrameTimeStats {
+		/// <summary>
+		/// Number of frames measured
+		/// </summary>
+		U64 frames{ 0 };
+
+		/// <summary>
+		/// Average frame time (in milliseconds)
+		/// </summary>
+		double average{ 0 };
+
+		/// <summary>
+		/// Minimum frame time (in milliseconds)
+		/// </summary>
+		double minimum{ 0 };
+
+		/// <summary>
+		/// Maximum frame time (in milliseconds)
+		/// </summary>
+		double maximum{ 0 };
+
+		/// <summary>
+		/// Median frame time (in milliseconds)
+		/// </summary>
+		double p50{ 0 };
+
+		/// <summary>
+		/// 95th percentile frame time (in milliseconds)
+		/// </summary>
+		double p95{ 0 };
+
+		/// <summary>
+		/// 99th percentile frame time (in milliseconds)
+		/// </summary>
+		double p99{ 0 };
+	};
+
+	/// <summary>
+	/// Latency statistics (low latency mode only)
+	/// </summary>
+	struct LatencyStats {
+		/// <summary>
+		/// Number of frames measured
+		/// </summary>
+		U64 frames{ 0 };
+
+		/// <summary>
+		/// Average estimated time from input sample to the frame reaching the screen (in milliseconds)
+		/// </summary>
+		double inputToPhoton{ 0 };
+
+		/// <summary>
+		/// Maximum estimated time from input sample to the frame reaching the screen (in milliseconds)
+		/// </summary>
+		double maxInputToPhoton{ 0 };
+
+		/// <summary>
+		/// Average time the frame start was delayed towards the next vertical blank (in milliseconds)
+		/// </summary>
+		double startDelay{ 0 };
+	};
+
+	/// <summary>
+	/// Startup statistics
+	/// </summary>
+	struct StartupStats {
+		/// <summary>
+		/// Time spent initializing the shell (in milliseconds)
+		/// </summary>
+		double shellTime{ 0 };
+
+		/// <summary>
+		/// Time spent initializing graphics, including the built-in shaders (in milliseconds)
+		/// </summary>
+		double graphicsTime{ 0 };
+
+		/// <summary>
+		/// Time spent initializing sound (in milliseconds)
+		/// </summary>
+		double soundTime{ 0 };
+
+		/// <summary>
+		/// Time spent in the application's start event (in milliseconds)
+		/// </summary>
+		double appTime{ 0 };
+
+		/// <summary>
+		/// Time from the engine being run until the first frame (in milliseconds)
+		/// </summary>
+		double totalTime{ 0 };
+
+		/// <summary>
+		/// Shaders created before the first frame
+		/// </summary>
+		ShaderCacheStats shaders;
+	};
+
 	/// <summary>
 	/// Engine timer
 	/// </summary>
@@ -15,6 +165,7 @@ namespace Violet {
 	private:
 		// Friend classes
 		friend class Engine;
+		friend class Graphics;
 		friend class Shell;
 
 		/// <summary>
@@ -32,6 +183,49 @@ namespace Violet {
 		/// </summary>
 		static void UpdateEnd();
 
+		/// <summary>
+		/// Wait until the next frame is due (only if VSync is disabled)
+		/// </summary>
+		static void WaitNextFrame();
+
+		/// <summary>
+		/// Get frame rate to pace to
+		/// </summary>
+		/// <returns>Frame rate</returns>
+		static float GetFrameRate();
+
+		/// <summary>
+		/// Wait until a tick, sleeping first and spinning for the rest
+		/// </summary>
+		/// <param name="tick">Tick to wait for</param>
+		/// <returns>Tick that spinning started at</returns>
+		static double WaitUntil(const double tick);
+
+		/// <summary>
+		/// Mark the frame's draw commands as submitted
+		/// </summary>
+		static void FrameSubmitted();
+
+		/// <summary>
+		/// Mark a frame as presented
+		/// </summary>
+		/// <param name="inputTick">Tick that the frame's input was sampled at</param>
+		/// <param name="presentTick">Tick that the frame was found to be presented at</param>
+		static void FramePresented(const double inputTick, const double presentTick);
+
+		/// <summary>
+		/// Add a frame time to the statistics
+		/// </summary>
+		/// <param name="time">Frame time (in milliseconds)</param>
+		static void AddFrameTime(const double time);
+
+		/// <summary>
+		/// Get a frame time percentile from the histogram
+		/// </summary>
+		/// <param name="percentile">Percentile (0-1)</param>
+		/// <returns>Frame time (in milliseconds)</returns>
+		static double GetFrameTimePercentile(const double percentile);
+
 		/// <summary>
 		/// Current tick
 		/// </summary>
@@ -58,14 +252,24 @@ namespace Violet {
 		static float updateDelta;
 
 		/// <summary>
-		/// Fixed update tick
+		/// Fixed update time accumulator (in milliseconds)
+		/// </summary>
+		static double fixedAccum;
+
+		/// <summary>
+		/// Number of fixed updates to run this update
+		/// </summary>
+		static int fixedSteps;
+
+		/// <summary>
+		/// Maximum number of fixed updates per update
 		/// </summary>
-		static double fixedUpdateTick;
+		static int maxFixedSteps;
 
 		/// <summary>
-		/// Fixed update flag
+		/// Fixed update interpolation alpha
 		/// </summary>
-		static bool fixedUpdate;
+		static float fixedAlpha;
 
 		/// <summary>
 		/// Draw update tick
@@ -97,6 +301,66 @@ namespace Violet {
 		/// </summary>
 		static bool drawUpdate;
 
+		/// <summary>
+		/// Next draw update deadline tick
+		/// </summary>
+		static double nextDrawTick;
+
+		/// <summary>
+		/// Frame rate limit (0 = display refresh rate)
+		/// </summary>
+		static float frameLimit;
+
+		/// <summary>
+		/// Time to spin before a deadline instead of sleeping (in milliseconds)
+		/// </summary>
+		static double spinMargin;
+
+		/// <summary>
+		/// Frame pacing statistics
+		/// </summary>
+		static FramePaceStats paceStats;
+
+		/// <summary>
+		/// Low latency mode flag
+		/// </summary>
+		static bool lowLatency;
+
+		/// <summary>
+		/// Average time from frame start until the draw commands are submitted (in milliseconds)
+		/// </summary>
+		static double workTime;
+
+		/// <summary>
+		/// Tick that the last frame was presented at
+		/// </summary>
+		static double presentTick;
+
+		/// <summary>
+		/// Latency statistics
+		/// </summary>
+		static LatencyStats latencyStats;
+
+		/// <summary>
+		/// Latency statistics mutex (frames may be presented by the render thread)
+		/// </summary>
+		static std::mutex latencyMutex;
+
+		/// <summary>
+		/// Frame time statistics
+		/// </summary>
+		static FrameTimeStats frameTimeStats;
+
+		/// <summary>
+		/// Frame time histogram (the last bucket also counts all longer frames)
+		/// </summary>
+		static std::vector<U32> frameTimeHistogram;
+
+		/// <summary>
+		/// Startup statistics
+		/// </summary>
+		static StartupStats startupStats;
+
 		/// <summary>
 		/// Game frames per second
 		/// </summary>
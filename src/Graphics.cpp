@@ -5,6 +5,11 @@
 
 #include "Violet.hpp"
 
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define VIOLET_GRAPHICS_SSE
+#include <xmmintrin.h>
+#endif
+
 namespace Violet {
 
 	/// <summary>
@@ -32,24 +37,157 @@ namespace Violet {
 	/// </summary>
 	ViewResize Graphics::viewResizeModeY{ ViewResize::Scale };
 
+	/// <summary>
+	/// Number of layers drawn at low resolution
+	/// </summary>
+	int Graphics::lowResLayers{ 0 };
+
+	/// <summary>
+	/// Upscale mode
+	/// </summary>
+	UpscaleMode Graphics::upscaleMode{ UpscaleMode::SharpBilinear };
+
+	/// <summary>
+	/// Low resolution render target
+	/// </summary>
+	std::shared_ptr<RenderTarget> Graphics::lowResTarget{ nullptr };
+
+	/// <summary>
+	/// Post processing shader chain
+	/// </summary>
+	std::vector<std::shared_ptr<PostShader>> Graphics::postShaders;
+
+	/// <summary>
+	/// Camera for each layer
+	/// </summary>
+	std::shared_ptr<Camera> Graphics::cameras[LayerCount];
+
+	/// <summary>
+	/// Depth ordering flag
+	/// </summary>
+	bool Graphics::depthOrdering{ false };
+
+	/// <summary>
+	/// Render targets that post processing passes alternate between
+	/// </summary>
+	std::shared_ptr<RenderTarget> Graphics::postTargets[2];
+
 	/// <summary>
 	/// Default sprite shader
 	/// </summary>
 	std::shared_ptr<SpriteShader> Graphics::spriteShader{ nullptr };
 
 	/// <summary>
-	/// Sprite queue
+	/// Default texture array sprite shader
+	/// </summary>
+	std::shared_ptr<SpriteShader> Graphics::arraySpriteShader{ nullptr };
+
+	/// <summary>
+	/// Copy screen shader
+	/// </summary>
+	std::shared_ptr<ScreenShader> Graphics::copyShader{ nullptr };
+
+	/// <summary>
+	/// Sharp bilinear screen shader
+	/// </summary>
+	std::shared_ptr<ScreenShader> Graphics::sharpBilinearShader{ nullptr };
+
+	/// <summary>
+	/// Per-frame shader data buffer
+	/// </summary>
+	std::shared_ptr<UniformBuffer> Graphics::frameUniforms{ nullptr };
+
+	/// <summary>
+	/// Sprite frames
+	/// </summary>
+	std::unique_ptr<SpriteFrame> Graphics::frames[2];
+
+	/// <summary>
+	/// Frame being written by the game
+	/// </summary>
+	SpriteFrame* Graphics::gameFrame{ nullptr };
+
+	/// <summary>
+	/// Frame being drawn
+	/// </summary>
+	SpriteFrame* Graphics::drawFrame{ nullptr };
+
+	/// <summary>
+	/// Statistics of the last drawn frame
+	/// </summary>
+	GraphicsStats Graphics::lastStats;
+
+	/// <summary>
+	/// Maximum number of frames queued up for the GPU in low latency mode
+	/// </summary>
+	int Graphics::maxQueuedFrames{ 1 };
+
+	/// <summary>
+	/// Render thread flag
+	/// </summary>
+	bool Graphics::renderThreaded{ false };
+
+	/// <summary>
+	/// Render thread handle
+	/// </summary>
+	std::thread Graphics::renderThread;
+
+	/// <summary>
+	/// Render thread flag for the calling thread
+	/// </summary>
+	thread_local bool Graphics::onRenderThread{ false };
+
+	/// <summary>
+	/// Render thread mutex
+	/// </summary>
+	std::mutex Graphics::renderMutex;
+
+	/// <summary>
+	/// Render thread condition
+	/// </summary>
+	std::condition_variable Graphics::renderCond;
+
+	/// <summary>
+	/// Frame submitted to the render thread, but not yet taken
+	/// </summary>
+	SpriteFrame* Graphics::pendingFrame{ nullptr };
+
+	/// <summary>
+	/// Frame being drawn by the render thread
+	/// </summary>
+	SpriteFrame* Graphics::renderingFrame{ nullptr };
+
+	/// <summary>
+	/// Render thread quit flag
 	/// </summary>
-	std::unique_ptr<SpriteQueueShaderMap> Graphics::sprites[TotalLayerCount];
+	bool Graphics::renderQuit{ false };
+
+	/// <summary>
+	/// Render thread error message
+	/// </summary>
+	std::string Graphics::renderError{ "" };
 
 	/// <summary>
 	/// Initialize graphics manager
 	/// </summary>
 	void Graphics::Initialize() {
-		for (int i = 0; i < TotalLayerCount; ++i) {
-			sprites[i] = std::make_unique<SpriteQueueShaderMap>();
+		for (int i = 0; i < 2; ++i) {
+			frames[i] = std::make_unique<SpriteFrame>();
+			for (int j = 0; j < TotalLayerCount; ++j) {
+				frames[i]->sprites[j] = std::make_unique<SpriteQueueShaderMap>();
+			}
+			for (int j = 0; j < LayerCount; ++j) {
+				frames[i]->opaqueSprites[j] = std::make_unique<SpriteQueueShaderMap>();
+			}
+			frames[i]->depthOrdering = depthOrdering;
 		}
-		spriteShader = std::shared_ptr<SpriteShader>(new SpriteShader());
+		gameFrame = frames[0].get();
+		ShaderCache::Load();
+		spriteShader = std::shared_ptr<SpriteShader>(new SpriteShader(false));
+		arraySpriteShader = std::shared_ptr<SpriteShader>(new SpriteShader(true));
+		copyShader = std::make_shared<ScreenShader>();
+		sharpBilinearShader = std::make_shared<ScreenShader>(ScreenShader::GetSharpBilinearShader());
+		frameUniforms = Engine::CreateUniformBuffer(sizeof(FrameUniforms), FrameUniformBinding);
 		InitAPI();
 	}
 
@@ -58,11 +196,340 @@ namespace Violet {
 	/// </summary>
 	void Graphics::Dispose() {
 		DisposeAPI();
-		for (int i = 0; i < TotalLayerCount; ++i) {
-			sprites[i]->clear();
-			sprites[i] = nullptr;
+		ShaderCache::Save();
+		for (int i = 0; i < 2; ++i) {
+			ClearFrame(frames[i].get());
+			frames[i] = nullptr;
 		}
+		gameFrame = nullptr;
+		drawFrame = nullptr;
 		spriteShader = nullptr;
+		arraySpriteShader = nullptr;
+		copyShader = nullptr;
+		sharpBilinearShader = nullptr;
+		lowResTarget = nullptr;
+		postTargets[0] = nullptr;
+		postTargets[1] = nullptr;
+		postShaders.clear();
+		for (int layer = 0; layer < LayerCount; ++layer) {
+			cameras[layer] = nullptr;
+		}
+		frameUniforms = nullptr;
+	}
+
+	/// <summary>
+	/// Set render thread flag (must be set before the engine is run)
+	/// </summary>
+	/// <param name="enable">Render thread enable flag</param>
+	void Graphics::SetRenderThread(const bool enable) {
+		if (renderThread.joinable()) {
+			Engine::Error("The render thread cannot be toggled while the engine is running.");
+		}
+		renderThreaded = enable;
+	}
+
+	/// <summary>
+	/// Set the maximum number of frames queued up for the GPU in low latency mode
+	/// </summary>
+	/// <param name="frames">Maximum number of queued frames (0 = wait for each frame to finish)</param>
+	void Graphics::SetMaxQueuedFrames(const int frames) {
+		if (frames < 0) {
+			Engine::Error("Invalid queued frame count \"" + std::to_string(frames) + "\".");
+		}
+		maxQueuedFrames = frames;
+	}
+
+	/// <summary>
+	/// Start render thread (if enabled)
+	/// </summary>
+	void Graphics::StartRenderThread() {
+		if (renderThreaded) {
+			pendingFrame = nullptr;
+			renderingFrame = nullptr;
+			renderQuit = false;
+			renderError = "";
+			renderThread = std::thread(RunRenderThread);
+			Engine::DebugMessage("RENDER THREAD:       STARTED");
+		}
+	}
+
+	/// <summary>
+	/// Stop render thread
+	/// </summary>
+	void Graphics::StopRenderThread() {
+		if (renderThread.joinable()) {
+			{
+				std::lock_guard<std::mutex> lock(renderMutex);
+				renderQuit = true;
+			}
+			renderCond.notify_all();
+			renderThread.join();
+			Engine::DebugMessage("RENDER THREAD:       STOPPED");
+		}
+	}
+
+	/// <summary>
+	/// Wait for the render thread to finish the frames handed to it (so that objects it uses can be changed)
+	/// </summary>
+	void Graphics::WaitRenderIdle() {
+		if (renderThread.joinable()) {
+			std::unique_lock<std::mutex> lock(renderMutex);
+			renderCond.wait(lock, [] { return (pendingFrame == nullptr && renderingFrame == nullptr) || renderQuit; });
+		}
+	}
+
+	/// <summary>
+	/// Check if shader variables set by the calling thread have to be queued for the render thread
+	/// </summary>
+	/// <returns>True if they have to be queued, false if they can be set directly</returns>
+	bool Graphics::IsShaderVarDeferred() {
+		return renderThread.joinable() && !onRenderThread;
+	}
+
+	/// <summary>
+	/// Queue a shader variable write for the render thread
+	/// </summary>
+	/// <param name="shader">Shader</param>
+	/// <param name="var">Variable</param>
+	/// <param name="type">Variable type</param>
+	/// <param name="data">Value to set</param>
+	/// <param name="size">Value size</param>
+	void Graphics::QueueShaderVar(Shader* const shader, const ShaderVar var, const ShaderVarType type, const void* data, const size_t size) {
+		AllocScope allocScope(AllocTag::Graphics);
+		size_t offset = gameFrame->shaderVarData.size();
+		gameFrame->shaderVarData.resize(offset + size);
+		memcpy(gameFrame->shaderVarData.data() + offset, data, size);
+		gameFrame->shaderVarWrites.push_back({ shader, var, type, offset, size });
+	}
+
+	/// <summary>
+	/// Apply a frame's queued shader variable writes
+	/// </summary>
+	/// <param name="frame">Frame</param>
+	void Graphics::ApplyShaderVars(SpriteFrame* const frame) {
+		for (const ShaderVarWrite& write : frame->shaderVarWrites) {
+			if (write.shader) {
+				write.shader->SetVariable(write.var, write.type, frame->shaderVarData.data() + write.offset, write.size);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Drop queued shader variable writes for a shader that's being destroyed
+	/// </summary>
+	/// <param name="shader">Shader</param>
+	void Graphics::ForgetShaderVars(Shader* const shader) {
+		for (int i = 0; i < 2; ++i) {
+			SpriteFrame* frame = frames[i].get();
+			if (!frame) {
+				continue;
+			}
+			for (ShaderVarWrite& write : frame->shaderVarWrites) {
+				if (write.shader != shader) {
+					continue;
+				}
+
+				// Frames handed to the render thread are only read by it, so let it finish with them first
+				if (frame != gameFrame) {
+					WaitRenderIdle();
+				}
+				write.shader = nullptr;
+			}
+		}
+	}
+
+	/// <summary>
+	/// Check if the calling thread is the render thread
+	/// </summary>
+	/// <returns>True if on the render thread, false if not</returns>
+	bool Graphics::IsRenderThread() {
+		return onRenderThread;
+	}
+
+	/// <summary>
+	/// Run render thread
+	/// </summary>
+	void Graphics::RunRenderThread() {
+		onRenderThread = true;
+		try {
+			Shell::StartRenderContext();
+			InitAPI();
+
+			while (true) {
+				// Wait for a frame
+				SpriteFrame* frame;
+				{
+					std::unique_lock<std::mutex> lock(renderMutex);
+					renderCond.wait(lock, [] { return pendingFrame != nullptr || renderQuit; });
+					if (renderQuit) {
+						break;
+					}
+					frame = pendingFrame;
+					renderingFrame = frame;
+					pendingFrame = nullptr;
+				}
+				renderCond.notify_all();
+
+				// Draw it
+				VertexBuffer::DeleteOrphans();
+				RenderTarget::DeleteOrphans();
+				WaitFrameFence(frame);
+				DrawFrame(frame);
+				Shell::UpdateGraphicsEnd();
+				ThrottleFrames(frame);
+
+				// Objects may be destroyed by the game thread once the frame is handed back
+				Texture::Unset();
+				VertexBuffer::Unset();
+				Shader::Unset();
+				RenderTarget::Unset();
+
+				{
+					std::lock_guard<std::mutex> lock(renderMutex);
+					lastStats = frame->stats;
+					renderingFrame = nullptr;
+				}
+				renderCond.notify_all();
+			}
+
+			VertexBuffer::DeleteOrphans();
+			RenderTarget::DeleteOrphans();
+			DisposeAPI();
+			Shell::StopRenderContext();
+		}
+		catch (const std::exception& e) {
+			Shell::StopRenderContext();
+			std::lock_guard<std::mutex> lock(renderMutex);
+			renderError = e.what();
+			renderingFrame = nullptr;
+			renderQuit = true;
+		}
+		renderCond.notify_all();
+	}
+
+	/// <summary>
+	/// Submit the current frame for drawing
+	/// </summary>
+	void Graphics::SubmitFrame() {
+		AllocScope allocScope(AllocTag::Graphics);
+		gameFrame->bgColor = bgColor;
+		gameFrame->windowSize = Engine::GetWindowSize();
+		gameFrame->projection = Engine::GetDefaultOrthoMat();
+		gameFrame->viewSize = GetViewSize();
+		gameFrame->lowResLayers = lowResLayers;
+		gameFrame->upscaleMode = upscaleMode;
+
+		// Layers that share a camera share its view matrix, so it's only set once for all of them
+		gameFrame->cameraViews.clear();
+		gameFrame->cameraViews.push_back(Matrix4x4<float>(1.0f));
+		Camera* lastCamera = nullptr;
+		for (int layer = 0; layer < LayerCount; ++layer) {
+			Camera* camera = cameras[layer].get();
+			if (camera && camera != lastCamera) {
+				gameFrame->cameraViews.push_back(camera->GetViewMat(gameFrame->viewSize));
+			}
+			gameFrame->layerCameras[layer] = camera ? static_cast<int>(gameFrame->cameraViews.size()) - 1 : 0;
+			lastCamera = camera;
+		}
+
+		// Disabled passes are left out here, so they cost nothing when drawing
+		for (const std::shared_ptr<PostShader>& shader : postShaders) {
+			if (shader->IsEnabled()) {
+				gameFrame->postShaders.push_back(shader);
+			}
+		}
+		if (!gameFrame->postShaders.empty()) {
+			if (gameFrame->lowResLayers == 0) {
+				gameFrame->lowResLayers = LayerCount;
+			}
+			if (!postTargets[0]) {
+				postTargets[0] = Engine::CreateRenderTarget(gameFrame->viewSize);
+				postTargets[1] = Engine::CreateRenderTarget(gameFrame->viewSize);
+			}
+		}
+		if (gameFrame->lowResLayers > 0 && !lowResTarget) {
+			lowResTarget = Engine::CreateRenderTarget(gameFrame->viewSize, true);
+		}
+		if (gameFrame->depthOrdering) {
+			BuildOpaqueBatches(gameFrame);
+		}
+		gameFrame->inputTick = Input::sampleTick;
+
+		if (!renderThreaded) {
+			DrawFrame(gameFrame);
+			lastStats = gameFrame->stats;
+			EngineTimer::FrameSubmitted();
+			Shell::UpdateGraphicsEnd();
+			ThrottleFrames(gameFrame);
+			ClearFrame(gameFrame);
+			return;
+		}
+
+		// Hand the frame over to the render thread
+		FenceFrame(gameFrame);
+		SpriteFrame* nextFrame = (gameFrame == frames[0].get()) ? frames[1].get() : frames[0].get();
+		{
+			std::unique_lock<std::mutex> lock(renderMutex);
+			renderCond.wait(lock, [] { return pendingFrame == nullptr || renderQuit; });
+			pendingFrame = gameFrame;
+			renderCond.notify_all();
+
+			// Wait for the render thread to be done with the other frame
+			renderCond.wait(lock, [nextFrame] { return renderingFrame != nextFrame || renderQuit; });
+			if (!renderError.empty()) {
+				Engine::Error("Render thread error: " + renderError);
+			}
+		}
+
+		// Clearing here makes sure that objects are only destroyed on the game thread
+		ClearFrame(nextFrame);
+		gameFrame = nextFrame;
+	}
+
+	/// <summary>
+	/// Draw frame
+	/// </summary>
+	/// <param name="frame">Frame to draw</param>
+	void Graphics::DrawFrame(SpriteFrame* const frame) {
+		AllocScope allocScope(AllocTag::Graphics);
+		double start = Engine::GetTicks();
+		drawFrame = frame;
+		ApplyShaderVars(frame);
+		Update();
+
+		// Per-frame data is set once here for every shader
+		FrameUniforms uniforms = { frame->projection, frame->cameraViews[0] };
+		frameUniforms->SetData(0, sizeof(uniforms), &uniforms);
+		frameUniforms->SetActive();
+
+		// Low resolution layers go into their own render target first
+		int lowResEnd = frame->lowResLayers * static_cast<int>(LayerType::Count);
+		if (lowResEnd > 0) {
+			DrawOpaqueSprites(true);
+			DrawSprites(0, lowResEnd);
+			DrawUpscale(*DrawPostShaders());
+		}
+		DrawOpaqueSprites(false);
+		DrawSprites(lowResEnd, TotalLayerCount);
+		frame->stats.drawTime = Engine::GetTicks() - start;
+	}
+
+	/// <summary>
+	/// Clear frame sprite queue
+	/// </summary>
+	/// <param name="frame">Frame to clear</param>
+	void Graphics::ClearFrame(SpriteFrame* const frame) {
+		// Cleared first, so that shaders released below don't look for their writes in here
+		frame->shaderVarWrites.clear();
+		frame->shaderVarData.clear();
+		ClearQueues(frame->sprites, frame->occupied, frame->retained, LayerMaskWords);
+		ClearQueues(frame->opaqueSprites, frame->opaqueOccupied, frame->opaqueRetained, OpaqueLayerMaskWords);
+		frame->opaqueBatches.clear();
+		frame->postShaders.clear();
+		frame->stats = {};
+
+		// Sprites are sorted into queues as they're added, so the mode can only change between frames
+		frame->depthOrdering = depthOrdering;
 	}
 
 	/// <summary>
@@ -71,102 +538,461 @@ namespace Violet {
 	/// <param name="textures">Sprite textures</param>
 	/// <param name="sprite">Sprite data</param>
 	void Graphics::AddSprite(std::shared_ptr<std::vector<TextureBind>> textures, SpriteData& sprite) {
-		// Get layer
-		int layer = (sprite.layer * static_cast<int>(LayerType::Count)) + static_cast<int>(curLayerType);
+		AllocScope allocScope(AllocTag::Graphics);
 
-		// Get sprite maps for this shader
 		if (!sprite.shader) {
+			// Texture arrays need the variant that reads the sprite's array layer
 			sprite.shader = spriteShader;
+			for (const TextureBind& bind : *textures) {
+				if (bind.unit == 0 && bind.texture && bind.texture->GetArrayLayers()) {
+					sprite.shader = arraySpriteShader;
+				}
+			}
+		}
+
+		// Sprites outside of the view are dropped here, before they cost a vertex transform and upload
+		// (custom shaders may move vertices, so their sprites are always kept)
+		if (IsDefaultShader(sprite.shader) && !IsSpriteVisible(sprite, GetVisibleRect(sprite.layer))) {
+			++gameFrame->stats.culled;
+			return;
 		}
-		if (sprites[layer]->find(sprite.shader) == sprites[layer]->end()) {
-			sprites[layer]->insert_or_assign(sprite.shader, SpriteQueueTextureMap());
+		++gameFrame->stats.sprites;
+
+		// Get layer
+		int layer = (sprite.layer * static_cast<int>(LayerType::Count)) + static_cast<int>(curLayerType);
+
+		// Opaque sprites don't depend on the draw order in depth ordering mode, so they're queued per layer for batching
+		if (gameFrame->depthOrdering) {
+			sprite.depth = (((layer + 0.5f) / TotalLayerCount) * 2) - 1;
+			if (IsSpriteOpaque(*textures, sprite)) {
+				QueueSprite(*gameFrame->opaqueSprites[sprite.layer], textures, sprite);
+				gameFrame->opaqueOccupied[sprite.layer >> 6] |= 1ULL << (sprite.layer & 63);
+				return;
+			}
 		}
-		SpriteQueueTextureMap spriteMaps = sprites[layer]->at(sprite.shader);
+		QueueSprite(*gameFrame->sprites[layer], textures, sprite);
+		gameFrame->occupied[layer >> 6] |= 1ULL << (layer & 63);
+	}
+
+	/// <summary>
+	/// Add sprite to a sprite queue
+	/// </summary>
+	/// <param name="sprites">Sprite queue</param>
+	/// <param name="textures">Sprite textures</param>
+	/// <param name="sprite">Sprite data</param>
+	void Graphics::QueueSprite(SpriteQueueShaderMap& sprites, std::shared_ptr<std::vector<TextureBind>> textures, SpriteData& sprite) {
+		// Get sprite maps for this shader
+		SpriteQueueTextureMap& spriteMaps = sprites[sprite.shader];
 
 		// Find sprite map for this particular binding of textures
-		for (SpriteQueueTexturePair spriteMap : spriteMaps) {
-			int foundCount = 0;
-
-			for (int i = 0; i < textures->size(); ++i) {
-				TextureBind spriteBind = textures->begin()[i];
-				bool found = false;
-
-				for (int j = 0; j < spriteMap.first->size(); ++j) {
-					TextureBind mapBind = spriteMap.first->at(j);
-					if (spriteBind.texture == mapBind.texture &&
-						spriteBind.unit == mapBind.unit &&
-						spriteBind.filter == mapBind.filter) {
-						++foundCount;
-						found = true;
-						break;
-					}
-				}
+		for (SpriteQueueTexturePair& spriteMap : spriteMaps) {
+			if (SameTextures(*textures, *spriteMap.first)) {
+				spriteMap.second->push_back(sprite);
+				return;
+			}
+		}
+
+		// Create new sprite map for this binding of textures
+		SpriteQueue& queue = spriteMaps[textures];
+		queue = std::make_shared<std::vector<SpriteData>>();
+		queue->push_back(sprite);
+	}
 
-				if (!found && spriteBind.texture == nullptr) {
+	/// <summary>
+	/// Check if 2 texture bindings match
+	/// </summary>
+	/// <param name="a">First texture binding</param>
+	/// <param name="b">Second texture binding</param>
+	/// <returns>True if they match, false if not</returns>
+	bool Graphics::SameTextures(const std::vector<TextureBind>& a, const std::vector<TextureBind>& b) {
+		int foundCount = 0;
+
+		for (int i = 0; i < a.size(); ++i) {
+			const TextureBind& spriteBind = a[i];
+			bool found = false;
+
+			for (int j = 0; j < b.size(); ++j) {
+				const TextureBind& mapBind = b[j];
+				if (spriteBind.texture == mapBind.texture &&
+					spriteBind.unit == mapBind.unit &&
+					spriteBind.filter == mapBind.filter) {
 					++foundCount;
+					found = true;
+					break;
 				}
 			}
 
-			if (foundCount == Math::Max(textures->size(), spriteMap.first->size())) {
-				spriteMaps[spriteMap.first]->push_back(sprite);
-				sprites[layer]->insert_or_assign(sprite.shader, spriteMaps);
-				return;
+			if (!found && spriteBind.texture == nullptr) {
+				++foundCount;
 			}
 		}
 
-		// Create new sprite map for this binding of textures
-		spriteMaps[textures] = std::make_shared<std::vector<SpriteData>>();
-		spriteMaps[textures]->push_back(sprite);
-		sprites[layer]->insert_or_assign(sprite.shader, spriteMaps);
+		return foundCount == Math::Max(a.size(), b.size());
+	}
+
+	/// <summary>
+	/// Clear a sprite queue's sprites (queues that were used are kept, so that their capacity is reused)
+	/// </summary>
+	/// <param name="sprites">Sprite queue</param>
+	/// <returns>True if any queues were kept, false if it's now empty</returns>
+	bool Graphics::ClearQueue(SpriteQueueShaderMap& sprites) {
+		// Queues that went unused for a whole frame are let go, so that they don't keep their textures and shader alive
+		for (SpriteQueueShaderMap::iterator shaderIt = sprites.begin(); shaderIt != sprites.end();) {
+			SpriteQueueTextureMap& spriteMaps = shaderIt->second;
+			for (SpriteQueueTextureMap::iterator it = spriteMaps.begin(); it != spriteMaps.end();) {
+				if (it->second->empty()) {
+					it = spriteMaps.erase(it);
+				}
+				else {
+					it->second->clear();
+					++it;
+				}
+			}
 
+			if (spriteMaps.empty()) {
+				shaderIt = sprites.erase(shaderIt);
+			}
+			else {
+				++shaderIt;
+			}
+		}
+		return !sprites.empty();
 	}
 
 	/// <summary>
-	/// Draw sprites
+	/// Clear the sprite queues of the layers set in a pair of bitmaps
+	/// </summary>
+	/// <param name="queues">Sprite queues</param>
+	/// <param name="occupied">Occupied layer bitmap (cleared)</param>
+	/// <param name="retained">Retained layer bitmap (updated)</param>
+	/// <param name="words">Number of words in the bitmaps</param>
+	void Graphics::ClearQueues(std::unique_ptr<SpriteQueueShaderMap>* queues, U64* occupied, U64* retained, const int words) {
+		for (int word = 0; word < words; ++word) {
+			U64 bits = occupied[word] | retained[word];
+			U64 kept = 0;
+			while (bits) {
+				int bit = Math::FindFirstSet(bits);
+				bits &= bits - 1;
+				if (ClearQueue(*queues[(word << 6) + bit])) {
+					kept |= 1ULL << bit;
+				}
+			}
+			occupied[word] = 0;
+			retained[word] = kept;
+		}
+	}
+
+	/// <summary>
+	/// Check if a sprite can be drawn as opaque in depth ordering mode
 	/// </summary>
-	void Graphics::DrawSprites() {
-		// Iterate through each layer
-		for (int layer = 0; layer < TotalLayerCount; ++layer) {
-			// Iterate through each shader
-			for (SpriteQueueShaderPair spriteMaps : *(sprites[layer])) {
-				std::shared_ptr<Shader> shader = spriteMaps.first;
-				shader->SetActive();
-
-				// Iterate through each texture binding
-				for (SpriteQueueTexturePair spriteMap : spriteMaps.second) {
-					// Unset unused units
-					for (int i = 0; i < 16; ++i) {
-						bool found = false;
-						for (int j = 0; j < spriteMap.first->size(); ++j) {
-							if (spriteMap.first->at(j).unit == i) {
-								found = true;
-								break;
-							}
-							if (!found) {
-								Texture::Unset(i);
-							}
+	/// <param name="textures">Sprite textures</param>
+	/// <param name="sprite">Sprite data</param>
+	/// <returns>True if opaque, false if not</returns>
+	bool Graphics::IsSpriteOpaque(const std::vector<TextureBind>& textures, const SpriteData& sprite) {
+		// Only the default shaders are known to cut out transparent pixels instead of blending them
+		if (!IsDefaultShader(sprite.shader) || sprite.color.a < 1) {
+			return false;
+		}
+		for (const TextureBind& bind : textures) {
+			if (bind.texture && (bind.filter != TextureFilter::Nearest || bind.texture->IsTranslucent())) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// Check if a shader is one of the default sprite shaders
+	/// </summary>
+	/// <param name="shader">Shader</param>
+	/// <returns>True if it's a default sprite shader, false if not</returns>
+	bool Graphics::IsDefaultShader(const std::shared_ptr<Shader>& shader) {
+		return shader == spriteShader || shader == arraySpriteShader;
+	}
+
+	/// <summary>
+	/// Merge a frame's opaque sprite queues into batches
+	/// </summary>
+	/// <param name="frame">Frame</param>
+	void Graphics::BuildOpaqueBatches(SpriteFrame* const frame) {
+		// Front to back, so that the nearest sprites fill in the depth buffer first
+		for (int layer = LayerCount - 1; layer >= 0; --layer) {
+			if (!(frame->opaqueOccupied[layer >> 6] & (1ULL << (layer & 63)))) {
+				continue;
+			}
+			int camera = frame->layerCameras[layer];
+			bool lowRes = layer < frame->lowResLayers;
+
+			for (const SpriteQueueShaderPair& spriteMaps : *(frame->opaqueSprites[layer])) {
+				for (const SpriteQueueTexturePair& spriteMap : spriteMaps.second) {
+					if (spriteMap.second->empty()) {
+						continue;
+					}
+					OpaqueBatch* batch = nullptr;
+					for (OpaqueBatch& opaqueBatch : frame->opaqueBatches) {
+						if (opaqueBatch.camera == camera && opaqueBatch.lowRes == lowRes &&
+							opaqueBatch.shader == spriteMaps.first && SameTextures(*opaqueBatch.textures, *spriteMap.first)) {
+							batch = &opaqueBatch;
+							break;
 						}
 					}
-
-					// Set active units
-					for (int i = 0; i < spriteMap.first->size(); ++i) {
-						TextureBind bind = spriteMap.first->at(i);
-						bind.texture->SetActive(bind.filter, bind.unit);
+					if (!batch) {
+						frame->opaqueBatches.push_back({ spriteMaps.first, spriteMap.first, camera, lowRes, {} });
+						batch = &frame->opaqueBatches.back();
 					}
+					batch->queues.push_back(spriteMap.second);
+				}
+			}
+		}
+	}
 
-					// Draw sprites
-					shader->StartSpriteDraw();
-					for (int i = 0; i < spriteMap.second->size(); ++i) {
-						shader->AddSprite(spriteMap.first, spriteMap.second->at(i));
-					}
-					shader->FlushSprites();
-					spriteMap.second->clear();
+	/// <summary>
+	/// Check if a sprite overlaps an area
+	/// </summary>
+	/// <param name="sprite">Sprite data</param>
+	/// <param name="area">Area</param>
+	/// <returns>True if it overlaps, false if not</returns>
+	bool Graphics::IsSpriteVisible(const SpriteData& sprite, const Rect<float>& area) {
+		// Scaled box around the position, the same as the quad that the sprite shader builds
+		float x0 = -sprite.origin.x * sprite.scale.x;
+		float x1 = (sprite.bounds.w - sprite.origin.x) * sprite.scale.x;
+		float y0 = -sprite.origin.y * sprite.scale.y;
+		float y1 = (sprite.bounds.h - sprite.origin.y) * sprite.scale.y;
+
+#ifdef VIOLET_GRAPHICS_SSE
+		float cos = 1;
+		float sin = 0;
+		if (sprite.angle != 0) {
+			cos = Math::CosDeg(sprite.angle);
+			sin = Math::SinDeg(sprite.angle);
+		}
+
+		// Transform all 4 corners at once
+		__m128 cornerX = _mm_set_ps(x1, x1, x0, x0);
+		__m128 cornerY = _mm_set_ps(y1, y0, y1, y0);
+		__m128 cosVec = _mm_set1_ps(cos);
+		__m128 sinVec = _mm_set1_ps(sin);
+		__m128 posX = _mm_add_ps(_mm_set1_ps(sprite.pos.x), _mm_sub_ps(_mm_mul_ps(cornerX, cosVec), _mm_mul_ps(cornerY, sinVec)));
+		__m128 posY = _mm_add_ps(_mm_set1_ps(sprite.pos.y), _mm_add_ps(_mm_mul_ps(cornerX, sinVec), _mm_mul_ps(cornerY, cosVec)));
+
+		// Reduce them to the bounding box, with every lane holding the result
+		__m128 minX = _mm_min_ps(posX, _mm_shuffle_ps(posX, posX, _MM_SHUFFLE(1, 0, 3, 2)));
+		__m128 maxX = _mm_max_ps(posX, _mm_shuffle_ps(posX, posX, _MM_SHUFFLE(1, 0, 3, 2)));
+		__m128 minY = _mm_min_ps(posY, _mm_shuffle_ps(posY, posY, _MM_SHUFFLE(1, 0, 3, 2)));
+		__m128 maxY = _mm_max_ps(posY, _mm_shuffle_ps(posY, posY, _MM_SHUFFLE(1, 0, 3, 2)));
+		minX = _mm_min_ps(minX, _mm_shuffle_ps(minX, minX, _MM_SHUFFLE(2, 3, 0, 1)));
+		maxX = _mm_max_ps(maxX, _mm_shuffle_ps(maxX, maxX, _MM_SHUFFLE(2, 3, 0, 1)));
+		minY = _mm_min_ps(minY, _mm_shuffle_ps(minY, minY, _MM_SHUFFLE(2, 3, 0, 1)));
+		maxY = _mm_max_ps(maxY, _mm_shuffle_ps(maxY, maxY, _MM_SHUFFLE(2, 3, 0, 1)));
+
+		// Test all 4 edges at once, with the minimums negated so that every test is the same direction
+		__m128 maxs = _mm_unpacklo_ps(maxX, maxY);
+		__m128 mins = _mm_sub_ps(_mm_setzero_ps(), _mm_unpacklo_ps(minX, minY));
+		__m128 bounds = _mm_movelh_ps(maxs, mins);
+		__m128 edges = _mm_set_ps(-(area.y + area.h), -(area.x + area.w), area.y, area.x);
+		return _mm_movemask_ps(_mm_cmpge_ps(bounds, edges)) == 0xF;
+#else
+		float centerX = (x0 + x1) / 2;
+		float centerY = (y0 + y1) / 2;
+		float extentX = Math::Abs(x1 - x0) / 2;
+		float extentY = Math::Abs(y1 - y0) / 2;
+
+		// Rotating the box only moves its center and widens its extents
+		if (sprite.angle != 0) {
+			float cos = Math::CosDeg(sprite.angle);
+			float sin = Math::SinDeg(sprite.angle);
+			float rotCenterX = (centerX * cos) - (centerY * sin);
+			float rotCenterY = (centerX * sin) + (centerY * cos);
+			float rotExtentX = (Math::Abs(cos) * extentX) + (Math::Abs(sin) * extentY);
+			float rotExtentY = (Math::Abs(sin) * extentX) + (Math::Abs(cos) * extentY);
+			centerX = rotCenterX;
+			centerY = rotCenterY;
+			extentX = rotExtentX;
+			extentY = rotExtentY;
+		}
+
+		centerX += sprite.pos.x;
+		centerY += sprite.pos.y;
+		return centerX + extentX >= area.x && centerX - extentX <= area.x + area.w &&
+			centerY + extentY >= area.y && centerY - extentY <= area.y + area.h;
+#endif
+	}
+
+	/// <summary>
+	/// Get the area of a layer that's visible
+	/// </summary>
+	/// <param name="layer">Layer</param>
+	/// <returns>Visible area (the view, if the layer has no camera)</returns>
+	Rect<float> Graphics::GetVisibleRect(const int layer) {
+		Size2D<int> viewSize = GetViewSize();
+		if (cameras[layer]) {
+			return cameras[layer]->GetVisibleRect(viewSize);
+		}
+		return { 0.0f, 0.0f, static_cast<float>(viewSize.w), static_cast<float>(viewSize.h) };
+	}
+
+	/// <summary>
+	/// Draw sprites
+	/// </summary>
+	void Graphics::DrawSprites(const int firstLayer, const int endLayer) {
+		// Drawing works off of the queues built during the update, so it shouldn't need to allocate anything
+		NoAllocScope noAllocScope("Graphics::DrawSprites");
+
+		// Iterate through each layer with sprites queued
+		int curCamera = -1;
+		for (int word = firstLayer >> 6; word <= (endLayer - 1) >> 6; ++word) {
+			U64 bits = drawFrame->occupied[word];
+			while (bits) {
+				int layer = (word << 6) + Math::FindFirstSet(bits);
+				bits &= bits - 1;
+				if (layer < firstLayer) {
+					continue;
+				}
+				if (layer >= endLayer) {
+					break;
 				}
+				DrawLayer(layer, curCamera);
+			}
+		}
 
-				spriteMaps.second.clear();
+		if (drawFrame->depthOrdering) {
+			SetDepthState(false, false);
+		}
+	}
+
+	/// <summary>
+	/// Draw a layer's sprites
+	/// </summary>
+	/// <param name="layer">Layer slot</param>
+	/// <param name="curCamera">Camera view index that's currently set (updated)</param>
+	void Graphics::DrawLayer(const int layer, int& curCamera) {
+		// Only the view part of the frame data changes between cameras
+		int camera = drawFrame->layerCameras[layer / static_cast<int>(LayerType::Count)];
+		if (camera != curCamera) {
+			SetCameraView(camera);
+			curCamera = camera;
+		}
+
+		// Translucent sprites are depth tested against the opaque ones, but don't hide each other
+		if (drawFrame->depthOrdering) {
+			SetDepthState(true, false);
+		}
+
+		// Iterate through each shader
+		bool layerDepth = false;
+		for (const SpriteQueueShaderPair& spriteMaps : *(drawFrame->sprites[layer])) {
+			const std::shared_ptr<Shader>& shader = spriteMaps.first;
+			shader->SetActive();
+
+			// Other shaders don't output depth, so the layer's depth is forced for them
+			if (drawFrame->depthOrdering && IsDefaultShader(shader) == layerDepth) {
+				layerDepth = !layerDepth;
+				SetLayerDepth(layerDepth ? layer : -1);
+			}
+
+			// Iterate through each texture binding (queues kept from earlier frames may be empty)
+			for (const SpriteQueueTexturePair& spriteMap : spriteMaps.second) {
+				if (spriteMap.second->empty()) {
+					continue;
+				}
+				BindTextures(*spriteMap.first);
+
+				// Draw sprites
+				++drawFrame->stats.batches;
+				shader->StartSpriteDraw();
+				for (int i = 0; i < spriteMap.second->size(); ++i) {
+					shader->AddSprite(spriteMap.first, spriteMap.second->at(i));
+				}
+				shader->FlushSprites();
+			}
+		}
+		if (layerDepth) {
+			SetLayerDepth(-1);
+		}
+	}
+
+	/// <summary>
+	/// Draw opaque sprites (depth ordering mode only)
+	/// </summary>
+	/// <param name="lowRes">Draw the low resolution batches if set, or the window resolution ones if not</param>
+	void Graphics::DrawOpaqueSprites(const bool lowRes) {
+		NoAllocScope noAllocScope("Graphics::DrawOpaqueSprites");
+		if (drawFrame->opaqueBatches.empty()) {
+			return;
+		}
+
+		// The nearest sprite in each pixel wins the depth test, so each batch can hold sprites from any layer
+		SetDepthState(true, true);
+		spriteShader->SetAlphaCutoff(0.5f);
+		arraySpriteShader->SetAlphaCutoff(0.5f);
+		for (const OpaqueBatch& batch : drawFrame->opaqueBatches) {
+			if (batch.lowRes != lowRes) {
+				continue;
 			}
-			sprites[layer]->clear();
+			SetCameraView(batch.camera);
+			batch.shader->SetActive();
+			BindTextures(*batch.textures);
+
+			// Later sprites in a layer are drawn first, so that they stay on top of earlier ones at the same depth
+			++drawFrame->stats.batches;
+			batch.shader->StartSpriteDraw();
+			for (const SpriteQueue& queue : batch.queues) {
+				for (int i = static_cast<int>(queue->size()) - 1; i >= 0; --i) {
+					batch.shader->AddSprite(batch.textures, queue->at(i));
+				}
+			}
+			batch.shader->FlushSprites();
+		}
+		spriteShader->SetAlphaCutoff(0);
+		arraySpriteShader->SetAlphaCutoff(0);
+		SetDepthState(false, false);
+	}
+
+	/// <summary>
+	/// Bind sprite textures
+	/// </summary>
+	/// <param name="textures">Sprite textures</param>
+	void Graphics::BindTextures(const std::vector<TextureBind>& textures) {
+		// Unset unused units
+		for (int i = 0; i < 16; ++i) {
+			bool found = false;
+			for (int j = 0; j < textures.size(); ++j) {
+				if (textures[j].unit == i) {
+					found = true;
+					break;
+				}
+				if (!found) {
+					Texture::Unset(i);
+				}
+			}
+		}
+
+		// Set active units
+		for (int i = 0; i < textures.size(); ++i) {
+			const TextureBind& bind = textures[i];
+			bind.texture->SetActive(bind.filter, bind.unit);
+		}
+	}
+
+	/// <summary>
+	/// Set the camera view in the frame data
+	/// </summary>
+	/// <param name="camera">Camera view index</param>
+	void Graphics::SetCameraView(const int camera) {
+		frameUniforms->SetData(static_cast<int>(offsetof(FrameUniforms, view)), sizeof(Matrix4x4<float>), &drawFrame->cameraViews[camera]);
+		frameUniforms->SetActive();
+	}
+
+	/// <summary>
+	/// Get statistics of the last drawn frame
+	/// </summary>
+	/// <returns>Graphics statistics</returns>
+	GraphicsStats Graphics::GetStats() {
+		if (renderThreaded) {
+			std::lock_guard<std::mutex> lock(renderMutex);
+			return lastStats;
 		}
+		return lastStats;
 	}
 
 	/// <summary>
@@ -195,6 +1021,125 @@ namespace Violet {
 		viewSize = size;
 	}
 
+	/// <summary>
+	/// Set low resolution rendering (layers below the given count are drawn at the view size and then scaled up
+	/// to the window, and the rest are drawn at window resolution on top)
+	/// </summary>
+	/// <param name="layers">Number of layers drawn at low resolution (0 = draw everything at window resolution)</param>
+	/// <param name="mode">Upscale mode</param>
+	void Graphics::SetLowResRender(const int layers, const UpscaleMode mode) {
+		if (layers < 0 || layers > LayerCount) {
+			Engine::Error("Invalid low resolution layer count \"" + std::to_string(layers) + "\".");
+		}
+		lowResLayers = layers;
+		upscaleMode = mode;
+	}
+
+	/// <summary>
+	/// Add a post processing shader to the end of the chain (the chain runs over the low resolution layers,
+	/// or over every layer at the view size if low resolution rendering is off)
+	/// </summary>
+	/// <param name="shader">Post processing shader</param>
+	void Graphics::AddPostShader(std::shared_ptr<PostShader> shader) {
+		postShaders.push_back(shader);
+	}
+
+	/// <summary>
+	/// Remove a post processing shader from the chain
+	/// </summary>
+	/// <param name="shader">Post processing shader</param>
+	void Graphics::RemovePostShader(std::shared_ptr<PostShader> shader) {
+		postShaders.erase(std::remove(postShaders.begin(), postShaders.end(), shader), postShaders.end());
+	}
+
+	/// <summary>
+	/// Remove every post processing shader from the chain
+	/// </summary>
+	void Graphics::ClearPostShaders() {
+		postShaders.clear();
+	}
+
+	/// <summary>
+	/// Set depth ordering mode (takes effect from the next frame). Layers are stored as depth, opaque sprites
+	/// are drawn first, front to back and batched across layers, and translucent sprites are drawn over them,
+	/// back to front. Sprites are opaque if they're drawn with the default shader, no alpha and nearest
+	/// filtered textures without partially transparent pixels.
+	/// </summary>
+	/// <param name="enable">Depth ordering enable flag</param>
+	void Graphics::SetDepthOrdering(const bool enable) {
+		depthOrdering = enable;
+	}
+
+	/// <summary>
+	/// Set the camera for a range of layers (a camera's view is set once for its layers, so scrolling
+	/// and parallax only cost a uniform update)
+	/// </summary>
+	/// <param name="firstLayer">First layer</param>
+	/// <param name="lastLayer">Last layer (inclusive)</param>
+	/// <param name="camera">Camera (nullptr = no camera)</param>
+	void Graphics::SetCamera(const int firstLayer, const int lastLayer, std::shared_ptr<Camera> camera) {
+		if (firstLayer < 0 || lastLayer >= LayerCount || firstLayer > lastLayer) {
+			Engine::Error("Invalid camera layer range \"" + std::to_string(firstLayer) + "-" + std::to_string(lastLayer) + "\".");
+		}
+		for (int layer = firstLayer; layer <= lastLayer; ++layer) {
+			cameras[layer] = camera;
+		}
+	}
+
+	/// <summary>
+	/// Get the camera for a layer
+	/// </summary>
+	/// <param name="layer">Layer</param>
+	/// <returns>Camera (nullptr if none)</returns>
+	std::shared_ptr<Camera> Graphics::GetCamera(const int layer) {
+		if (layer < 0 || layer >= LayerCount) {
+			Engine::Error("Invalid layer \"" + std::to_string(layer) + "\".");
+		}
+		return cameras[layer];
+	}
+
+	/// <summary>
+	/// Run the post processing shaders over the low resolution render target
+	/// </summary>
+	/// <returns>Render target with the result</returns>
+	RenderTarget* Graphics::DrawPostShaders() {
+		RenderTarget* source = lowResTarget.get();
+		Size2D<int> viewSize = drawFrame->viewSize;
+
+		// Each pass reads the last one's result and writes to the other target
+		for (const std::shared_ptr<PostShader>& shader : drawFrame->postShaders) {
+			RenderTarget* dest = (source == postTargets[0].get()) ? postTargets[1].get() : postTargets[0].get();
+			dest->Resize(viewSize);
+			dest->SetActive();
+			shader->DrawScreen(*source, shader->GetFilter(), { 0, 0, viewSize.w, viewSize.h });
+			source = dest;
+		}
+		return source;
+	}
+
+	/// <summary>
+	/// Get the window area that low resolution rendering is scaled up to
+	/// </summary>
+	/// <param name="viewSize">View size</param>
+	/// <param name="windowSize">Window size</param>
+	/// <param name="mode">Upscale mode</param>
+	/// <returns>Window area (in pixels, from the bottom left)</returns>
+	Rect<int> Graphics::GetUpscaleArea(const Size2D<int> viewSize, const Size2D<int> windowSize, const UpscaleMode mode) {
+		switch (mode) {
+		case UpscaleMode::Integer: {
+			// The view size already follows the resize modes, so only the scale has to be rounded down
+			int scale = Math::Max(1, Math::Min(windowSize.w / viewSize.w, windowSize.h / viewSize.h));
+			int w = viewSize.w * scale;
+			int h = viewSize.h * scale;
+			return { (windowSize.w - w) / 2, (windowSize.h - h) / 2, w, h };
+		}
+
+		case UpscaleMode::SharpBilinear:
+		default:
+			return { 0, 0, windowSize.w, windowSize.h };
+		}
+	}
+
 	/// <summary>
 	/// Get view size
 	/// </summary>
@@ -23,6 +23,21 @@ namespace Violet {
 		Expand
 	};
 
+	/// <summary>
+	/// Upscale mode (how low resolution rendering is scaled up to the window)
+	/// </summary>
+	enum class UpscaleMode {
+		/// <summary>
+		/// Integer (largest whole multiple of the view size that fits, centered)
+		/// </summary>
+		Integer = 0,
+
+		/// <summary>
+		/// Sharp bilinear (fills the same area as drawing directly, with pixels only blended along their edges)
+		/// </summary>
+		SharpBilinear
+	};
+
 	/// <summary>
 	/// Sprite queue
 	/// </summary>
@@ -41,12 +56,12 @@ namespace Violet {
 	/// <summary>
 	/// Sprite queue texture pair
 	/// </summary>
-	typedef std::pair<std::shared_ptr<std::vector<TextureBind>>, SpriteQueue> SpriteQueueTexturePair;
+	typedef std::pair<const std::shared_ptr<std::vector<TextureBind>>, SpriteQueue> SpriteQueueTexturePair;
 
 	/// <summary>
 	/// Sprite queue shader pair
 	/// </summary>
-	typedef std::pair<std::shared_ptr<Shader>, SpriteQueueTextureMap> SpriteQueueShaderPair;
+	typedef std::pair<const std::shared_ptr<Shader>, SpriteQueueTextureMap> SpriteQueueShaderPair;
 
 	/// <summary>
 	/// Layer count
@@ -88,6 +103,236 @@ namespace Violet {
 	/// </summary>
 	constexpr int TotalLayerCount = LayerCount * static_cast<int>(LayerType::Count);
 
+	/// <summary>
+	/// Number of 64-bit words in a bitmap with a bit for every layer slot
+	/// </summary>
+	constexpr int LayerMaskWords = TotalLayerCount / 64;
+
+	/// <summary>
+	/// Number of 64-bit words in a bitmap with a bit for every layer
+	/// </summary>
+	constexpr int OpaqueLayerMaskWords = LayerCount / 64;
+
+	/// <summary>
+	/// Graphics statistics for a frame
+	/// </summary>
+	struct GraphicsStats {
+		/// <summary>
+		/// Number of sprites queued
+		/// </summary>
+		U32 sprites{ 0 };
+
+		/// <summary>
+		/// Number of sprites culled (outside of the visible area when submitted, and never queued)
+		/// </summary>
+		U32 culled{ 0 };
+
+		/// <summary>
+		/// Number of sprite batches (shader and texture binding changes)
+		/// </summary>
+		U32 batches{ 0 };
+
+		/// <summary>
+		/// Number of draw calls
+		/// </summary>
+		U32 drawCalls{ 0 };
+
+		/// <summary>
+		/// Time spent building and submitting draw commands (in milliseconds)
+		/// </summary>
+		double drawTime{ 0 };
+	};
+
+	/// <summary>
+	/// Per-frame shader data (std140 layout of the FrameData uniform block)
+	/// </summary>
+	struct FrameUniforms {
+		/// <summary>
+		/// Default projection matrix
+		/// </summary>
+		Matrix4x4<float> projection;
+
+		/// <summary>
+		/// View matrix of the camera for the layers being drawn
+		/// </summary>
+		Matrix4x4<float> view;
+	};
+
+	/// <summary>
+	/// Opaque sprite batch (sprites from every layer that share the same state, in depth ordering mode)
+	/// </summary>
+	struct OpaqueBatch {
+		/// <summary>
+		/// Shader
+		/// </summary>
+		std::shared_ptr<Shader> shader;
+
+		/// <summary>
+		/// Textures
+		/// </summary>
+		std::shared_ptr<std::vector<TextureBind>> textures;
+
+		/// <summary>
+		/// Camera view index
+		/// </summary>
+		int camera;
+
+		/// <summary>
+		/// Low resolution flag
+		/// </summary>
+		bool lowRes;
+
+		/// <summary>
+		/// Sprite queues, from the front layer to the back one
+		/// </summary>
+		std::vector<SpriteQueue> queues;
+	};
+
+	/// <summary>
+	/// Shader variable write made by the game while the render thread is running
+	/// </summary>
+	struct ShaderVarWrite {
+		/// <summary>
+		/// Shader (cleared if the shader is destroyed before the write is applied)
+		/// </summary>
+		Shader* shader;
+
+		/// <summary>
+		/// Variable
+		/// </summary>
+		ShaderVar var;
+
+		/// <summary>
+		/// Variable type
+		/// </summary>
+		ShaderVarType type;
+
+		/// <summary>
+		/// Offset of the value in the frame's shader variable data
+		/// </summary>
+		size_t offset;
+
+		/// <summary>
+		/// Value size
+		/// </summary>
+		size_t size;
+	};
+
+	/// <summary>
+	/// Sprite frame (everything needed to draw a frame)
+	/// </summary>
+	struct SpriteFrame {
+		/// <summary>
+		/// Sprite queue
+		/// </summary>
+		std::unique_ptr<SpriteQueueShaderMap> sprites[TotalLayerCount];
+
+		/// <summary>
+		/// Layer slots with sprites queued (1 bit each)
+		/// </summary>
+		U64 occupied[LayerMaskWords]{ 0 };
+
+		/// <summary>
+		/// Layer slots with empty sprite queues kept from the last time that the frame was used (1 bit each)
+		/// </summary>
+		U64 retained[LayerMaskWords]{ 0 };
+
+		/// <summary>
+		/// Opaque sprite queue for each layer (depth ordering mode only)
+		/// </summary>
+		std::unique_ptr<SpriteQueueShaderMap> opaqueSprites[LayerCount];
+
+		/// <summary>
+		/// Layers with opaque sprites queued (1 bit each)
+		/// </summary>
+		U64 opaqueOccupied[OpaqueLayerMaskWords]{ 0 };
+
+		/// <summary>
+		/// Layers with empty opaque sprite queues kept from the last time that the frame was used (1 bit each)
+		/// </summary>
+		U64 opaqueRetained[OpaqueLayerMaskWords]{ 0 };
+
+		/// <summary>
+		/// Opaque sprite batches, built from the opaque sprite queues when the frame is submitted
+		/// </summary>
+		std::vector<OpaqueBatch> opaqueBatches;
+
+		/// <summary>
+		/// Depth ordering flag
+		/// </summary>
+		bool depthOrdering{ false };
+
+		/// <summary>
+		/// Background color
+		/// </summary>
+		ColorRGB<float> bgColor;
+
+		/// <summary>
+		/// Window size
+		/// </summary>
+		Size2D<int> windowSize;
+
+		/// <summary>
+		/// Default projection matrix
+		/// </summary>
+		Matrix4x4<float> projection;
+
+		/// <summary>
+		/// View size
+		/// </summary>
+		Size2D<int> viewSize;
+
+		/// <summary>
+		/// Number of layers drawn at low resolution
+		/// </summary>
+		int lowResLayers{ 0 };
+
+		/// <summary>
+		/// Upscale mode
+		/// </summary>
+		UpscaleMode upscaleMode{ UpscaleMode::SharpBilinear };
+
+		/// <summary>
+		/// Camera view matrices (the first one is for layers without a camera)
+		/// </summary>
+		std::vector<Matrix4x4<float>> cameraViews;
+
+		/// <summary>
+		/// Index into the camera view matrices for each layer
+		/// </summary>
+		int layerCameras[LayerCount];
+
+		/// <summary>
+		/// Enabled post processing shaders, in order
+		/// </summary>
+		std::vector<std::shared_ptr<PostShader>> postShaders;
+
+		/// <summary>
+		/// Shader variable writes, applied in order before the frame is drawn
+		/// </summary>
+		std::vector<ShaderVarWrite> shaderVarWrites;
+
+		/// <summary>
+		/// Shader variable values
+		/// </summary>
+		std::vector<U8> shaderVarData;
+
+		/// <summary>
+		/// Fence signaled once the game thread's graphics commands for this frame are done
+		/// </summary>
+		void* fence{ nullptr };
+
+		/// <summary>
+		/// Tick that the frame's input was sampled at
+		/// </summary>
+		double inputTick{ 0 };
+
+		/// <summary>
+		/// Statistics
+		/// </summary>
+		GraphicsStats stats;
+	};
+
 	/// <summary>
 	/// Graphics
 	/// </summary>
@@ -95,11 +340,30 @@ namespace Violet {
 	public:
 		// Friend classes
 		friend class Actor;
+		friend class AssetWatcher;
 		friend class Engine;
+		friend class EngineTimer;
 		friend class Map;
+		friend class RenderTarget;
+		friend class ScreenShader;
+		friend class Shader;
 		friend class Sheet;
 		friend class Shell;
+		friend class SpriteShader;
 		friend class Texture;
+		friend class VertexBuffer;
+
+		/// <summary>
+		/// Set render thread flag (must be set before the engine is run)
+		/// </summary>
+		/// <param name="enable">Render thread enable flag</param>
+		static void SetRenderThread(const bool enable);
+
+		/// <summary>
+		/// Set the maximum number of frames queued up for the GPU in low latency mode
+		/// </summary>
+		/// <param name="frames">Maximum number of queued frames (0 = wait for each frame to finish)</param>
+		static void SetMaxQueuedFrames(const int frames);
 
 		/// <summary>
 		/// Set background color
@@ -120,12 +384,69 @@ namespace Violet {
 		/// <param name="size">Base view size</param>
 		static void SetBaseViewSize(Size2D<int> size);
 
+		/// <summary>
+		/// Set low resolution rendering (layers below the given count are drawn at the view size and then scaled up
+		/// to the window, and the rest are drawn at window resolution on top)
+		/// </summary>
+		/// <param name="layers">Number of layers drawn at low resolution (0 = draw everything at window resolution)</param>
+		/// <param name="mode">Upscale mode</param>
+		static void SetLowResRender(const int layers, const UpscaleMode mode = UpscaleMode::SharpBilinear);
+
+		/// <summary>
+		/// Add a post processing shader to the end of the chain (the chain runs over the low resolution layers,
+		/// or over every layer at the view size if low resolution rendering is off)
+		/// </summary>
+		/// <param name="shader">Post processing shader</param>
+		static void AddPostShader(std::shared_ptr<PostShader> shader);
+
+		/// <summary>
+		/// Remove a post processing shader from the chain
+		/// </summary>
+		/// <param name="shader">Post processing shader</param>
+		static void RemovePostShader(std::shared_ptr<PostShader> shader);
+
+		/// <summary>
+		/// Remove every post processing shader from the chain
+		/// </summary>
+		static void ClearPostShaders();
+
+		/// <summary>
+		/// Set depth ordering mode (takes effect from the next frame). Layers are stored as depth, opaque sprites
+		/// are drawn first, front to back and batched across layers, and translucent sprites are drawn over them,
+		/// back to front. Sprites are opaque if they're drawn with the default shader, no alpha and nearest
+		/// filtered textures without partially transparent pixels.
+		/// </summary>
+		/// <param name="enable">Depth ordering enable flag</param>
+		static void SetDepthOrdering(const bool enable);
+
+		/// <summary>
+		/// Set the camera for a range of layers (a camera's view is set once for its layers, so scrolling
+		/// and parallax only cost a uniform update)
+		/// </summary>
+		/// <param name="firstLayer">First layer</param>
+		/// <param name="lastLayer">Last layer (inclusive)</param>
+		/// <param name="camera">Camera (nullptr = no camera)</param>
+		static void SetCamera(const int firstLayer, const int lastLayer, std::shared_ptr<Camera> camera);
+
+		/// <summary>
+		/// Get the camera for a layer
+		/// </summary>
+		/// <param name="layer">Layer</param>
+		/// <returns>Camera (nullptr if none)</returns>
+		static std::shared_ptr<Camera> GetCamera(const int layer);
+
 		/// <summary>
 		/// Get view size
 		/// </summary>
 		/// <returns>View size</returns>
 		static Size2D<int> GetViewSize();
 
+		/// <summary>
+		/// Get statistics of the last drawn frame
+		/// </summary>
+		/// <returns>Graphics statistics</returns>
+		static GraphicsStats GetStats();
+
 	private:
 		/// <summary>
 		/// Initialize graphics
@@ -159,10 +480,228 @@ namespace Violet {
 		/// <param name="sprite">Sprite data</param>
 		static void AddSprite(std::shared_ptr<std::vector<TextureBind>> textures, SpriteData& sprite);
 
+		/// <summary>
+		/// Check if a sprite overlaps an area
+		/// </summary>
+		/// <param name="sprite">Sprite data</param>
+		/// <param name="area">Area</param>
+		/// <returns>True if it overlaps, false if not</returns>
+		static bool IsSpriteVisible(const SpriteData& sprite, const Rect<float>& area);
+
+		/// <summary>
+		/// Get the area of a layer that's visible
+		/// </summary>
+		/// <param name="layer">Layer</param>
+		/// <returns>Visible area (the view, if the layer has no camera)</returns>
+		static Rect<float> GetVisibleRect(const int layer);
+
+		/// <summary>
+		/// Add sprite to a sprite queue
+		/// </summary>
+		/// <param name="sprites">Sprite queue</param>
+		/// <param name="textures">Sprite textures</param>
+		/// <param name="sprite">Sprite data</param>
+		static void QueueSprite(SpriteQueueShaderMap& sprites, std::shared_ptr<std::vector<TextureBind>> textures, SpriteData& sprite);
+
+		/// <summary>
+		/// Check if 2 texture bindings match
+		/// </summary>
+		/// <param name="a">First texture binding</param>
+		/// <param name="b">Second texture binding</param>
+		/// <returns>True if they match, false if not</returns>
+		static bool SameTextures(const std::vector<TextureBind>& a, const std::vector<TextureBind>& b);
+
+		/// <summary>
+		/// Clear a sprite queue's sprites (queues that were used are kept, so that their capacity is reused)
+		/// </summary>
+		/// <param name="sprites">Sprite queue</param>
+		/// <returns>True if any queues were kept, false if it's now empty</returns>
+		static bool ClearQueue(SpriteQueueShaderMap& sprites);
+
+		/// <summary>
+		/// Clear the sprite queues of the layers set in a pair of bitmaps
+		/// </summary>
+		/// <param name="queues">Sprite queues</param>
+		/// <param name="occupied">Occupied layer bitmap (cleared)</param>
+		/// <param name="retained">Retained layer bitmap (updated)</param>
+		/// <param name="words">Number of words in the bitmaps</param>
+		static void ClearQueues(std::unique_ptr<SpriteQueueShaderMap>* queues, U64* occupied, U64* retained, const int words);
+
+		/// <summary>
+		/// Check if a sprite can be drawn as opaque in depth ordering mode
+		/// </summary>
+		/// <param name="textures">Sprite textures</param>
+		/// <param name="sprite">Sprite data</param>
+		/// <returns>True if opaque, false if not</returns>
+		static bool IsSpriteOpaque(const std::vector<TextureBind>& textures, const SpriteData& sprite);
+
+		/// <summary>
+		/// Check if a shader is one of the default sprite shaders
+		/// </summary>
+		/// <param name="shader">Shader</param>
+		/// <returns>True if it's a default sprite shader, false if not</returns>
+		static bool IsDefaultShader(const std::shared_ptr<Shader>& shader);
+
+		/// <summary>
+		/// Merge a frame's opaque sprite queues into batches
+		/// </summary>
+		/// <param name="frame">Frame</param>
+		static void BuildOpaqueBatches(SpriteFrame* const frame);
+
+		/// <summary>
+		/// Draw opaque sprites (depth ordering mode only)
+		/// </summary>
+		/// <param name="lowRes">Draw the low resolution batches if set, or the window resolution ones if not</param>
+		static void DrawOpaqueSprites(const bool lowRes);
+
+		/// <summary>
+		/// Bind sprite textures
+		/// </summary>
+		/// <param name="textures">Sprite textures</param>
+		static void BindTextures(const std::vector<TextureBind>& textures);
+
+		/// <summary>
+		/// Set the camera view in the frame data
+		/// </summary>
+		/// <param name="camera">Camera view index</param>
+		static void SetCameraView(const int camera);
+
+		/// <summary>
+		/// Set depth state
+		/// </summary>
+		/// <param name="test">Depth test flag</param>
+		/// <param name="write">Depth write flag (for opaque sprites, which are drawn without blending)</param>
+		static void SetDepthState(const bool test, const bool write);
+
+		/// <summary>
+		/// Force the depth of everything drawn to a layer slot's depth (for shaders that don't output it)
+		/// </summary>
+		/// <param name="layer">Layer slot (-1 = use the depth the shader outputs)</param>
+		static void SetLayerDepth(const int layer);
+
 		/// <summary>
 		/// Draw sprites
 		/// </summary>
-		static void DrawSprites();
+		/// <param name="firstLayer">First layer slot to draw</param>
+		/// <param name="endLayer">Layer slot to stop drawing at</param>
+		static void DrawSprites(const int firstLayer, const int endLayer);
+
+		/// <summary>
+		/// Draw a layer's sprites
+		/// </summary>
+		/// <param name="layer">Layer slot</param>
+		/// <param name="curCamera">Camera view index that's currently set (updated)</param>
+		static void DrawLayer(const int layer, int& curCamera);
+
+		/// <summary>
+		/// Run the post processing shaders over the low resolution render target
+		/// </summary>
+		/// <returns>Render target with the result</returns>
+		static RenderTarget* DrawPostShaders();
+
+		/// <summary>
+		/// Scale the low resolution image up to the window
+		/// </summary>
+		/// <param name="source">Render target with the low resolution image</param>
+		static void DrawUpscale(RenderTarget& source);
+
+		/// <summary>
+		/// Get the window area that low resolution rendering is scaled up to
+		/// </summary>
+		/// <param name="viewSize">View size</param>
+		/// <param name="windowSize">Window size</param>
+		/// <param name="mode">Upscale mode</param>
+		/// <returns>Window area (in pixels, from the bottom left)</returns>
+		static Rect<int> GetUpscaleArea(const Size2D<int> viewSize, const Size2D<int> windowSize, const UpscaleMode mode);
+
+		/// <summary>
+		/// Submit the current frame for drawing
+		/// </summary>
+		static void SubmitFrame();
+
+		/// <summary>
+		/// Draw frame
+		/// </summary>
+		/// <param name="frame">Frame to draw</param>
+		static void DrawFrame(SpriteFrame* const frame);
+
+		/// <summary>
+		/// Clear frame sprite queue
+		/// </summary>
+		/// <param name="frame">Frame to clear</param>
+		static void ClearFrame(SpriteFrame* const frame);
+
+		/// <summary>
+		/// Start render thread (if enabled)
+		/// </summary>
+		static void StartRenderThread();
+
+		/// <summary>
+		/// Stop render thread
+		/// </summary>
+		static void StopRenderThread();
+
+		/// <summary>
+		/// Run render thread
+		/// </summary>
+		static void RunRenderThread();
+
+		/// <summary>
+		/// Check if the calling thread is the render thread
+		/// </summary>
+		/// <returns>True if on the render thread, false if not</returns>
+		static bool IsRenderThread();
+
+		/// <summary>
+		/// Wait for the render thread to finish the frames handed to it (so that objects it uses can be changed)
+		/// </summary>
+		static void WaitRenderIdle();
+
+		/// <summary>
+		/// Check if shader variables set by the calling thread have to be queued for the render thread
+		/// </summary>
+		/// <returns>True if they have to be queued, false if they can be set directly</returns>
+		static bool IsShaderVarDeferred();
+
+		/// <summary>
+		/// Queue a shader variable write for the render thread
+		/// </summary>
+		/// <param name="shader">Shader</param>
+		/// <param name="var">Variable</param>
+		/// <param name="type">Variable type</param>
+		/// <param name="data">Value to set</param>
+		/// <param name="size">Value size</param>
+		static void QueueShaderVar(Shader* const shader, const ShaderVar var, const ShaderVarType type, const void* data, const size_t size);
+
+		/// <summary>
+		/// Apply a frame's queued shader variable writes
+		/// </summary>
+		/// <param name="frame">Frame</param>
+		static void ApplyShaderVars(SpriteFrame* const frame);
+
+		/// <summary>
+		/// Drop queued shader variable writes for a shader that's being destroyed
+		/// </summary>
+		/// <param name="shader">Shader</param>
+		static void ForgetShaderVars(Shader* const shader);
+
+		/// <summary>
+		/// Place a fence after the game thread's graphics commands for a frame
+		/// </summary>
+		/// <param name="frame">Frame</param>
+		static void FenceFrame(SpriteFrame* const frame);
+
+		/// <summary>
+		/// Wait for a frame's fence
+		/// </summary>
+		/// <param name="frame">Frame</param>
+		static void WaitFrameFence(SpriteFrame* const frame);
+
+		/// <summary>
+		/// Limit the number of frames queued up for the GPU after a swap (low latency mode only)
+		/// </summary>
+		/// <param name="frame">Frame that was just swapped</param>
+		static void ThrottleFrames(SpriteFrame* const frame);
 
 		/// <summary>
 		/// Current layer type
@@ -189,15 +728,135 @@ namespace Violet {
 		/// </summary>
 		static ViewResize viewResizeModeY;
 
+		/// <summary>
+		/// Number of layers drawn at low resolution
+		/// </summary>
+		static int lowResLayers;
+
+		/// <summary>
+		/// Upscale mode
+		/// </summary>
+		static UpscaleMode upscaleMode;
+
+		/// <summary>
+		/// Low resolution render target (created when first needed)
+		/// </summary>
+		static std::shared_ptr<RenderTarget> lowResTarget;
+
+		/// <summary>
+		/// Post processing shader chain
+		/// </summary>
+		static std::vector<std::shared_ptr<PostShader>> postShaders;
+
+		/// <summary>
+		/// Camera for each layer
+		/// </summary>
+		static std::shared_ptr<Camera> cameras[LayerCount];
+
+		/// <summary>
+		/// Depth ordering flag
+		/// </summary>
+		static bool depthOrdering;
+
+		/// <summary>
+		/// Render targets that post processing passes alternate between
+		/// </summary>
+		static std::shared_ptr<RenderTarget> postTargets[2];
+
 		/// <summary>
 		/// Default sprite shader
 		/// </summary>
 		static std::shared_ptr<SpriteShader> spriteShader;
+
+		/// <summary>
+		/// Default texture array sprite shader
+		/// </summary>
+		static std::shared_ptr<SpriteShader> arraySpriteShader;
+
+		/// <summary>
+		/// Copy screen shader
+		/// </summary>
+		static std::shared_ptr<ScreenShader> copyShader;
+
+		/// <summary>
+		/// Sharp bilinear screen shader
+		/// </summary>
+		static std::shared_ptr<ScreenShader> sharpBilinearShader;
+
+		/// <summary>
+		/// Per-frame shader data buffer
+		/// </summary>
+		static std::shared_ptr<UniformBuffer> frameUniforms;
 		
 		/// <summary>
-		/// Sprite queue
+		/// Sprite frames
+		/// </summary>
+		static std::unique_ptr<SpriteFrame> frames[2];
+
+		/// <summary>
+		/// Frame being written by the game
+		/// </summary>
+		static SpriteFrame* gameFrame;
+
+		/// <summary>
+		/// Frame being drawn
+		/// </summary>
+		static SpriteFrame* drawFrame;
+
+		/// <summary>
+		/// Statistics of the last drawn frame
+		/// </summary>
+		static GraphicsStats lastStats;
+
+		/// <summary>
+		/// Maximum number of frames queued up for the GPU in low latency mode
+		/// </summary>
+		static int maxQueuedFrames;
+
+		/// <summary>
+		/// Render thread flag
+		/// </summary>
+		static bool renderThreaded;
+
+		/// <summary>
+		/// Render thread handle
+		/// </summary>
+		static std::thread renderThread;
+
+		/// <summary>
+		/// Render thread flag for the calling thread
+		/// </summary>
+		static thread_local bool onRenderThread;
+
+		/// <summary>
+		/// Render thread mutex
+		/// </summary>
+		static std::mutex renderMutex;
+
+		/// <summary>
+		/// Render thread condition
+		/// </summary>
+		static std::condition_variable renderCond;
+
+		/// <summary>
+		/// Frame submitted to the render thread, but not yet taken
+		/// </summary>
+		static SpriteFrame* pendingFrame;
+
+		/// <summary>
+		/// Frame being drawn by the render thread
+		/// </summary>
+		static SpriteFrame* renderingFrame;
+
+		/// <summary>
+		/// Render thread quit flag
+		/// </summary>
+		static bool renderQuit;
+
+		/// <summary>
+		/// Render thread error message
 		/// </summary>
-		static std::unique_ptr<SpriteQueueShaderMap> sprites[TotalLayerCount];
+		static std::string renderError;
 	};
 
 }
@@ -0,0 +1,365 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+#ifdef VIOLET_SHELL_HEADLESS
+
+namespace Violet {
+
+	/// <summary>
+	/// Choose an EGL display (surfaceless if the driver supports it, so that no display server is needed)
+	/// </summary>
+	/// <returns>EGL display</returns>
+	static EGLDisplay GetEGLDisplay();
+
+	/// <summary>
+	/// Create an EGL pbuffer surface
+	/// </summary>
+	/// <param name="size">Surface size</param>
+	/// <returns>EGL surface</returns>
+	static EGLSurface CreateSurface(const Size2D<int> size);
+
+	/// <summary>
+	/// Surface size
+	/// </summary>
+	static const Size2D<int> surfaceSize{ Size2D<int>(1280, 720) };
+
+	/// <summary>
+	/// EGL display
+	/// </summary>
+	static EGLDisplay display{ EGL_NO_DISPLAY };
+
+	/// <summary>
+	/// EGL frame buffer configuration
+	/// </summary>
+	static EGLConfig config{ nullptr };
+
+	/// <summary>
+	/// Surface that frames are drawn to
+	/// </summary>
+	static EGLSurface surface{ EGL_NO_SURFACE };
+
+	/// <summary>
+	/// Small surface for the game thread's context while the render thread owns the main surface
+	/// </summary>
+	static EGLSurface gameSurface{ EGL_NO_SURFACE };
+
+	/// <summary>
+	/// OpenGL context
+	/// </summary>
+	static EGLContext context{ EGL_NO_CONTEXT };
+
+	/// <summary>
+	/// Render thread OpenGL context (shares objects with the main context)
+	/// </summary>
+	static EGLContext renderContext{ EGL_NO_CONTEXT };
+
+	/// <summary>
+	/// Window title
+	/// </summary>
+	static std::string windowTitle;
+
+	/// <summary>
+	/// Initialize shell
+	/// </summary>
+	void Shell::Initialize() {
+		display = GetEGLDisplay();
+		if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr)) {
+			Engine::Error("Failed to initialize EGL.");
+		}
+		if (!eglBindAPI(EGL_OPENGL_API)) {
+			Engine::Error("Failed to bind OpenGL API.");
+		}
+
+		const EGLint configAttribs[] = {
+			EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+			EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+			EGL_RED_SIZE, 8,
+			EGL_GREEN_SIZE, 8,
+			EGL_BLUE_SIZE, 8,
+			EGL_ALPHA_SIZE, 8,
+			EGL_DEPTH_SIZE, 24,
+			EGL_STENCIL_SIZE, 8,
+			EGL_NONE
+		};
+		EGLint configCount = 0;
+		if (!eglChooseConfig(display, configAttribs, &config, 1, &configCount) || configCount == 0) {
+			Engine::Error("Failed to find an EGL frame buffer configuration.");
+		}
+
+		// Create surface and context
+		surface = CreateSurface(surfaceSize);
+
+		const EGLint contextAttribs[] = {
+			EGL_CONTEXT_MAJOR_VERSION, 3,
+			EGL_CONTEXT_MINOR_VERSION, 2,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_NONE
+		};
+		context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+		if (context == EGL_NO_CONTEXT) {
+			Engine::Error("Failed to create OpenGL context.");
+		}
+
+		// Create render thread context. A surface can only be current on one thread, so the game thread moves to its own.
+		if (Graphics::renderThreaded) {
+			renderContext = eglCreateContext(display, config, context, contextAttribs);
+			if (renderContext == EGL_NO_CONTEXT) {
+				Engine::Error("Failed to create render thread OpenGL context.");
+			}
+			gameSurface = CreateSurface(Size2D<int>(1, 1));
+		}
+
+		if (!eglMakeCurrent(display, renderContext ? gameSurface : surface, renderContext ? gameSurface : surface, context)) {
+			Engine::Error("Failed to set current OpenGL context.");
+		}
+		if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress)) {
+			Engine::Error("Failed to set up OpenGL loader.");
+		}
+
+		// Initialize ticks
+		tickFreq = 1000000.0;
+
+		// There's no display, so pretend to have a 60 Hz one for pacing and statistics
+		EngineTimer::drawFPS = 60;
+
+		// Initialize input
+		if (Input::GetBindings().empty()) {
+			Input::ResetBindings();
+		}
+
+		// There's no audio output, so mix into nothing unless a file was asked for
+		if (Sound::device == SoundDevice::Shell) {
+			Sound::device = SoundDevice::Null;
+		}
+
+		Engine::DebugMessage("HEADLESS SHELL:      " + std::to_string(surfaceSize.w) + "x" + std::to_string(surfaceSize.h) + " " +
+			std::string(reinterpret_cast<const char*>(glGetString(GL_RENDERER))));
+	}
+
+	/// <summary>
+	/// Update events
+	/// </summary>
+	/// <returns>True if running, false if not</returns>
+	bool Shell::UpdateEvents() {
+		UpdateInput();
+		return true;
+	}
+
+	/// <summary>
+	/// Sample input state
+	/// </summary>
+	void Shell::UpdateInput() {
+		Input::sampleTick = Engine::GetTicks();
+	}
+
+	/// <summary>
+	/// Bind default inputs
+	/// </summary>
+	void Shell::BindDefaultInput() {
+		// No input devices
+	}
+
+	/// <summary>
+	/// Update graphics start
+	/// </summary>
+	void Shell::UpdateGraphicsStart() {
+		// No display to follow, the refresh rate is set once when initializing
+	}
+
+	/// <summary>
+	/// Update graphics end
+	/// </summary>
+	void Shell::UpdateGraphicsEnd() {
+		// Nothing waits for a vertical blank here, so VSync just lets frames run as fast as possible
+		eglSwapBuffers(display, surface);
+	}
+
+	/// <summary>
+	/// Make the render context current on the calling thread
+	/// </summary>
+	void Shell::StartRenderContext() {
+		if (!eglMakeCurrent(display, surface, surface, renderContext)) {
+			Engine::Error("Failed to set current render thread OpenGL context.");
+		}
+	}
+
+	/// <summary>
+	/// Release the render context from the calling thread
+	/// </summary>
+	void Shell::StopRenderContext() {
+		eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	}
+
+	/// <summary>
+	/// Update sound
+	/// </summary>
+	/// <param name="buffer">Sound buffer</param>
+	void Shell::UpdateSound(S16* buffer) {
+		Sound::Update(buffer);
+	}
+
+	/// <summary>
+	/// Stop shell
+	/// </summary>
+	void Shell::Stop() {
+	}
+
+	/// <summary>
+	/// Dispose of shell data
+	/// </summary>
+	void Shell::Dispose() {
+		if (display == EGL_NO_DISPLAY) {
+			return;
+		}
+
+		eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+		if (renderContext != EGL_NO_CONTEXT) {
+			eglDestroyContext(display, renderContext);
+			renderContext = EGL_NO_CONTEXT;
+		}
+		if (context != EGL_NO_CONTEXT) {
+			eglDestroyContext(display, context);
+			context = EGL_NO_CONTEXT;
+		}
+		if (gameSurface != EGL_NO_SURFACE) {
+			eglDestroySurface(display, gameSurface);
+			gameSurface = EGL_NO_SURFACE;
+		}
+		if (surface != EGL_NO_SURFACE) {
+			eglDestroySurface(display, surface);
+			surface = EGL_NO_SURFACE;
+		}
+		eglTerminate(display);
+		display = EGL_NO_DISPLAY;
+	}
+
+	/// <summary>
+	/// Get window size
+	/// </summary>
+	/// <returns>Window size</returns>
+	Size2D<int> Shell::GetWindowSize() {
+		return surfaceSize;
+	}
+
+	/// <summary>
+	/// Set window title
+	/// </summary>
+	/// <param name="title">Window title</param>
+	void Shell::SetWindowTitle(std::string title) {
+		windowTitle = title;
+	}
+
+	/// <summary>
+	/// Set screen mode
+	/// </summary>
+	/// <param name="newMode">Screen mode</param>
+	void Shell::SetScreenMode(ScreenMode newMode) {
+		screenMode = newMode;
+	}
+
+	/// <summary>
+	/// Set VSync flag
+	/// </summary>
+	/// <param name="enable">VSync enable flag</param>
+	void Shell::SetVSync(const bool enable) {
+		vsync = enable;
+	}
+
+	/// <summary>
+	/// Get tick
+	/// </summary>
+	/// <returns>Tick</returns>
+	double Shell::GetTick() {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count() / tickFreq;
+	}
+
+	/// <summary>
+	/// Sleep the calling thread
+	/// </summary>
+	/// <param name="time">Time to sleep (in milliseconds, rounded down)</param>
+	void Shell::Sleep(const double time) {
+		if (time >= 1) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<S64>(time)));
+		}
+	}
+
+	/// <summary>
+	/// Get the address of a graphics API function
+	/// </summary>
+	/// <param name="name">Function name</param>
+	/// <returns>Function address (nullptr if not available)</returns>
+	void* Shell::GetProcAddress(const char* name) {
+		return reinterpret_cast<void*>(eglGetProcAddress(name));
+	}
+
+	/// <summary>
+	/// Choose an EGL display (surfaceless if the driver supports it, so that no display server is needed)
+	/// </summary>
+	/// <returns>EGL display</returns>
+	EGLDisplay GetEGLDisplay() {
+		const char* extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+		if (extensions && strstr(extensions, "EGL_MESA_platform_surfaceless")) {
+			PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+				(PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+			if (getPlatformDisplay) {
+				EGLDisplay surfaceless = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+				if (surfaceless != EGL_NO_DISPLAY) {
+					return surfaceless;
+				}
+			}
+		}
+		return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	}
+
+	/// <summary>
+	/// Create an EGL pbuffer surface
+	/// </summary>
+	/// <param name="size">Surface size</param>
+	/// <returns>EGL surface</returns>
+	EGLSurface CreateSurface(const Size2D<int> size) {
+		const EGLint attribs[] = {
+			EGL_WIDTH, size.w,
+			EGL_HEIGHT, size.h,
+			EGL_NONE
+		};
+		EGLSurface newSurface = eglCreatePbufferSurface(display, config, attribs);
+		if (newSurface == EGL_NO_SURFACE) {
+			Engine::Error("Failed to create EGL pbuffer surface.");
+		}
+		return newSurface;
+	}
+
+	/// <summary>
+	/// Show message
+	/// </summary>
+	/// <param name="type">Message type</param>
+	/// <param name="msg">Message</param>
+	void Engine::Message(MessageType type, std::string msg) {
+		AllocScope allocScope(AllocTag::Message);
+		std::string title = GetAppName();
+
+		switch (type) {
+		default:
+		case MessageType::Info:
+			break;
+
+		case MessageType::Warning:
+			title += " - Warning";
+			break;
+
+		case MessageType::Error:
+			title += " - Error";
+			break;
+		}
+
+		fprintf(stderr, "%s: %s\n", title.c_str(), msg.c_str());
+	}
+
+}
+
+#endif // VIOLET_SHELL_HEADLESS
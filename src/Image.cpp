@@ -20,6 +20,20 @@ namespace Violet {
 		}
 	}
 
+	/// <summary>
+	/// Blank image constructor
+	/// </summary>
+	/// <param name="size">Image size</param>
+	Image::Image(Size2D<int> size) {
+		if (size.w <= 0 || size.h <= 0) {
+			Engine::Error("Invalid image size \"" + std::to_string(size.w) + "x" + std::to_string(size.h) + "\".");
+		}
+
+		this->fileName = "(" + std::to_string(size.w) + "x" + std::to_string(size.h) + " image)";
+		this->size = size;
+		pixels = new ColorRGBA<float>[size.w * size.h]();
+	}
+
 	/// <summary>
 	/// Image destructor
 	/// </summary>
@@ -35,7 +49,8 @@ namespace Violet {
 	/// </summary>
 	/// <returns>Pixel data</returns>
 	std::shared_ptr<ColorRGBA<float>[]> Image::GetPixels() {
-		return std::shared_ptr<ColorRGBA<float>[]>(pixels);
+		// The image keeps ownership of the pixels
+		return std::shared_ptr<ColorRGBA<float>[]>(pixels, [](ColorRGBA<float>*) {});
 	}
 
 	/// <summary>
@@ -134,11 +149,12 @@ namespace Violet {
 			png_bytep row = rowPointers[y];
 			for (int x = 0; x < size.w; ++x) {
 				pixels[i++] = {
-					(*(row++)) / 255.0f,
-					(*(row++)) / 255.0f,
-					(*(row++)) / 255.0f,
-					(*(row++)) / 255.0f
+					row[0] / 255.0f,
+					row[1] / 255.0f,
+					row[2] / 255.0f,
+					row[3] / 255.0f
 				};
+				row += 4;
 			}
 			delete[] rowPointers[y];
 		}
@@ -156,7 +172,18 @@ namespace Violet {
 	/// <param name="fileName">File name</param>
 	/// <returns>Opened image</returns>
 	std::shared_ptr<Image> Engine::OpenImage(std::string fileName) {
+		AllocScope allocScope(AllocTag::Asset);
 		return std::shared_ptr<Image>(new Image(fileName));
 	}
 
+	/// <summary>
+	/// Create blank image
+	/// </summary>
+	/// <param name="size">Image size</param>
+	/// <returns>Created image</returns>
+	std::shared_ptr<Image> Engine::CreateImage(Size2D<int> size) {
+		AllocScope allocScope(AllocTag::Asset);
+		return std::shared_ptr<Image>(new Image(size));
+	}
+
 }
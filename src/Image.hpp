@@ -41,6 +41,12 @@ namespace Violet {
 		/// <param name="fileName">File name</param>
 		Image(std::string fileName);
 
+		/// <summary>
+		/// Blank image constructor
+		/// </summary>
+		/// <param name="size">Image size</param>
+		Image(Size2D<int> size);
+
 		/// <summary>
 		/// Open a PNG file
 		/// </summary>
@@ -0,0 +1,162 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+#ifdef __linux__
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace Violet {
+
+	/// <summary>
+	/// inotify instance
+	/// </summary>
+	static int inotifyFD{ -1 };
+
+	/// <summary>
+	/// Watched directories by watch descriptor
+	/// </summary>
+	static std::unordered_map<int, std::string> watchDirs;
+
+	/// <summary>
+	/// Watched file names by resolved path (a file may have been added under more than one name)
+	/// </summary>
+	static std::unordered_map<std::string, std::vector<std::string>> watchFiles;
+
+	/// <summary>
+	/// Resolved paths by watched file name
+	/// </summary>
+	static std::unordered_map<std::string, std::string> watchPaths;
+
+	/// <summary>
+	/// Resolve a path
+	/// </summary>
+	/// <param name="path">Path</param>
+	/// <returns>Resolved path (empty if it doesn't exist)</returns>
+	static std::string ResolvePath(const std::string& path) {
+		char* resolved = realpath(path.c_str(), nullptr);
+		if (!resolved) {
+			return "";
+		}
+		std::string result(resolved);
+		free(resolved);
+		return result;
+	}
+
+	/// <summary>
+	/// Start watching for file changes
+	/// </summary>
+	void AssetWatcher::StartWatching() {
+		inotifyFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (inotifyFD < 0) {
+			Engine::Error("Failed to start watching for file changes.");
+		}
+	}
+
+	/// <summary>
+	/// Watch a file for changes
+	/// </summary>
+	/// <param name="fileName">File name</param>
+	void AssetWatcher::AddFile(const std::string& fileName) {
+		std::string path = ResolvePath(fileName);
+		if (path.empty()) {
+			Engine::Error("Failed to find \"" + fileName + "\" to watch.");
+		}
+
+		// Watch the directory rather than the file, as editors often save by replacing the file
+		std::string dir = path.substr(0, path.find_last_of('/') + 1);
+		int wd = inotify_add_watch(inotifyFD, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+		if (wd < 0) {
+			Engine::Error("Failed to watch \"" + fileName + "\".");
+		}
+		watchDirs[wd] = dir;
+		watchPaths[fileName] = path;
+
+		std::vector<std::string>& names = watchFiles[path];
+		if (std::find(names.begin(), names.end(), fileName) == names.end()) {
+			names.push_back(fileName);
+		}
+	}
+
+	/// <summary>
+	/// Stop watching a file
+	/// </summary>
+	/// <param name="fileName">File name (as it was added)</param>
+	void AssetWatcher::RemoveFile(const std::string& fileName) {
+		std::unordered_map<std::string, std::string>::iterator path = watchPaths.find(fileName);
+		if (path == watchPaths.end()) {
+			return;
+		}
+		std::string dir = path->second.substr(0, path->second.find_last_of('/') + 1);
+
+		std::unordered_map<std::string, std::vector<std::string>>::iterator file = watchFiles.find(path->second);
+		if (file != watchFiles.end()) {
+			file->second.erase(std::remove(file->second.begin(), file->second.end(), fileName), file->second.end());
+			if (file->second.empty()) {
+				watchFiles.erase(file);
+			}
+		}
+		watchPaths.erase(path);
+
+		// The directory stays watched for as long as any other file in it is
+		for (const std::pair<const std::string, std::vector<std::string>>& other : watchFiles) {
+			if (other.first.compare(0, dir.length(), dir) == 0 && other.first.find('/', dir.length()) == std::string::npos) {
+				return;
+			}
+		}
+		for (std::unordered_map<int, std::string>::iterator it = watchDirs.begin(); it != watchDirs.end(); ++it) {
+			if (it->second == dir) {
+				inotify_rm_watch(inotifyFD, it->first);
+				watchDirs.erase(it);
+				break;
+			}
+		}
+	}
+
+	/// <summary>
+	/// Get files that changed since the last check (never blocks)
+	/// </summary>
+	/// <param name="changed">List to add the changed file names to (as they were added)</param>
+	void AssetWatcher::GetChanges(std::vector<std::string>& changed) {
+		alignas(inotify_event) char buffer[4096];
+		while (true) {
+			ssize_t length = read(inotifyFD, buffer, sizeof(buffer));
+			if (length <= 0) {
+				break;
+			}
+
+			for (char* event = buffer; event < buffer + length; event += sizeof(inotify_event) + reinterpret_cast<inotify_event*>(event)->len) {
+				const inotify_event* info = reinterpret_cast<inotify_event*>(event);
+				if (info->len == 0) {
+					continue;
+				}
+
+				std::unordered_map<int, std::string>::iterator dir = watchDirs.find(info->wd);
+				if (dir != watchDirs.end()) {
+					std::unordered_map<std::string, std::vector<std::string>>::iterator file = watchFiles.find(dir->second + info->name);
+					if (file != watchFiles.end()) {
+						changed.insert(changed.end(), file->second.begin(), file->second.end());
+					}
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// Stop watching for file changes
+	/// </summary>
+	void AssetWatcher::StopWatching() {
+		close(inotifyFD);
+		inotifyFD = -1;
+		watchDirs.clear();
+		watchFiles.clear();
+		watchPaths.clear();
+	}
+
+}
+
+#endif // __linux__
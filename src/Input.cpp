@@ -8,34 +8,252 @@
 namespace Violet {
 
 	/// <summary>
-	/// Buttons
+	/// Player states
 	/// </summary>
-	bool Input::buttons[static_cast<int>(Button::Count)]{ { 0 } };
+	Input::PlayerState Input::players[MaxPlayers];
 
 	/// <summary>
-	/// Previous buttons
+	/// Pending events
 	/// </summary>
-	bool Input::buttonsPrev[static_cast<int>(Button::Count)]{ { 0 } };
+	std::vector<InputEvent> Input::events;
 
 	/// <summary>
-	/// Analog inputs
+	/// Events latched for this frame
 	/// </summary>
-	float Input::analog[static_cast<int>(Analog::Count)]{ { 0 } };
+	std::vector<InputEvent> Input::frameEvents;
 
 	/// <summary>
-	/// Previous analog inputs
+	/// Bindings
 	/// </summary>
-	float Input::analogPrev[static_cast<int>(Analog::Count)]{ { 0 } };
+	std::vector<InputBinding> Input::bindings;
+
+	/// <summary>
+	/// Raw inputs held down
+	/// </summary>
+	std::vector<Input::HeldInput> Input::held;
+
+	/// <summary>
+	/// Analog dead zone
+	/// </summary>
+	float Input::deadZone{ 0.2f };
+
+	/// <summary>
+	/// Last input pressed flag
+	/// </summary>
+	bool Input::lastInputSet{ false };
+
+	/// <summary>
+	/// Last input source pressed
+	/// </summary>
+	InputSource Input::lastSource{ InputSource::Key };
+
+	/// <summary>
+	/// Last input code pressed
+	/// </summary>
+	int Input::lastCode{ 0 };
+
+	/// <summary>
+	/// Tick of the last input sample
+	/// </summary>
+	double Input::sampleTick{ 0 };
 
 	/// <summary>
 	/// Set up new frame of input
 	/// </summary>
 	void Input::NewFrame() {
-		for (int i = 0; i < static_cast<int>(Button::Count); ++i) {
-			buttonsPrev[i] = buttons[i];
+		frameEvents.clear();
+		for (PlayerState& state : players) {
+			state.tapped.reset();
+			state.released.reset();
+		}
+	}
+
+	/// <summary>
+	/// Latch the pending events for the update phase
+	/// </summary>
+	void Input::LatchFrame() {
+		// Replayed input is set at each fixed update step instead
+		if (InputRecorder::replaying) {
+			events.clear();
+			return;
+		}
+
+		for (const InputEvent& ev : events) {
+			ApplyEvent(ev);
+		}
+		frameEvents.swap(events);
+		events.clear();
+
+		// Inputs that were pressed and released within the frame still count as pressed for it
+		for (PlayerState& state : players) {
+			state.pressed = state.down | state.tapped;
+		}
+	}
+
+	/// <summary>
+	/// Let the draw phase see the pending events' state, leaving them for the next frame's taps and releases
+	/// </summary>
+	void Input::LatchLate() {
+		if (InputRecorder::replaying) {
+			events.clear();
+			return;
 		}
+
+		U8 holds[MaxPlayers][static_cast<int>(Button::Count)];
+		ButtonSet down[MaxPlayers];
+		for (int i = 0; i < MaxPlayers; ++i) {
+			memcpy(holds[i], players[i].holds, sizeof(holds[i]));
+			down[i] = players[i].down;
+		}
+
+		for (const InputEvent& ev : events) {
+			if (ev.type == InputEventType::Analog) {
+				ApplyEvent(ev);
+			}
+			else if (ev.pressed) {
+				++holds[ev.player][ev.id];
+				down[ev.player].set(ev.id);
+			}
+			else if (holds[ev.player][ev.id] > 0 && --holds[ev.player][ev.id] == 0) {
+				down[ev.player].reset(ev.id);
+			}
+		}
+
+		for (int i = 0; i < MaxPlayers; ++i) {
+			players[i].pressed = down[i] | players[i].tapped;
+		}
+	}
+
+	/// <summary>
+	/// Apply an event to a player's state
+	/// </summary>
+	/// <param name="ev">Event</param>
+	void Input::ApplyEvent(const InputEvent& ev) {
+		PlayerState& state = players[ev.player];
+
+		if (ev.type == InputEventType::Analog) {
+			if (ev.axis == 0) {
+				state.analog[ev.id].x = ev.value;
+			}
+			else {
+				state.analog[ev.id].y = ev.value;
+			}
+		}
+		else if (ev.pressed) {
+			if (state.holds[ev.id]++ == 0) {
+				state.down.set(ev.id);
+				state.tapped.set(ev.id);
+			}
+		}
+		else if (state.holds[ev.id] > 0 && --state.holds[ev.id] == 0) {
+			state.down.reset(ev.id);
+			state.released.set(ev.id);
+		}
+	}
+
+	/// <summary>
+	/// Queue a raw input from the shell
+	/// </summary>
+	/// <param name="source">Input source</param>
+	/// <param name="code">Shell key or controller button code</param>
+	/// <param name="player">Player ID of the controller (ignored for keys)</param>
+	/// <param name="pressed">Pressed flag</param>
+	/// <param name="tick">Tick that the input happened at</param>
+	void Input::QueueInput(InputSource source, const int code, const int player, const bool pressed, const double tick) {
+		int rawPlayer = (source == InputSource::Key) ? -1 : player;
+
+		// Only pass on changes, so that key repeats and stray releases don't throw off the hold counts
+		auto it = std::find_if(held.begin(), held.end(), [&](const HeldInput& input) {
+			return input.source == source && input.code == code && input.player == rawPlayer;
+		});
+		if (pressed) {
+			if (it != held.end()) {
+				return;
+			}
+			held.push_back({ source, code, rawPlayer });
+
+			lastInputSet = true;
+			lastSource = source;
+			lastCode = code;
+		}
+		else {
+			if (it == held.end()) {
+				return;
+			}
+			held.erase(it);
+		}
+
+		for (const InputBinding& binding : bindings) {
+			if (binding.source == source && binding.code == code && (rawPlayer < 0 || binding.player == rawPlayer)) {
+				InputEvent ev;
+				ev.tick = tick;
+				ev.type = InputEventType::Button;
+				ev.player = binding.player;
+				ev.id = static_cast<int>(binding.button);
+				ev.pressed = pressed;
+				events.push_back(ev);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Queue an analog axis from the shell
+	/// </summary>
+	/// <param name="player">Player ID</param>
+	/// <param name="analog">Analog input ID</param>
+	/// <param name="axis">Axis (0 = X, 1 = Y)</param>
+	/// <param name="value">Axis value</param>
+	/// <param name="tick">Tick that the input happened at</param>
+	void Input::QueueAnalog(const int player, Analog analog, const int axis, const float value, const double tick) {
+		InputEvent ev;
+		ev.tick = tick;
+		ev.type = InputEventType::Analog;
+		ev.player = player;
+		ev.id = static_cast<int>(analog);
+		ev.axis = axis;
+		ev.value = value;
+		events.push_back(ev);
+	}
+
+	/// <summary>
+	/// Release all of a player's buttons and analog inputs (controller disconnected)
+	/// </summary>
+	/// <param name="player">Player ID</param>
+	/// <param name="tick">Tick that the controller disconnected at</param>
+	void Input::QueueRelease(const int player, const double tick) {
+		std::vector<HeldInput> release;
+		for (const HeldInput& input : held) {
+			if (input.player == player) {
+				release.push_back(input);
+			}
+		}
+		for (const HeldInput& input : release) {
+			QueueInput(input.source, input.code, input.player, false, tick);
+		}
+
 		for (int i = 0; i < static_cast<int>(Analog::Count); ++i) {
-			analogPrev[i] = analog[i];
+			QueueAnalog(player, static_cast<Analog>(i), 0, 0, tick);
+			QueueAnalog(player, static_cast<Analog>(i), 1, 0, tick);
+		}
+	}
+
+	/// <summary>
+	/// Release all held inputs (bindings changed)
+	/// </summary>
+	void Input::ReleaseAll() {
+		while (!held.empty()) {
+			HeldInput input = held.back();
+			QueueInput(input.source, input.code, input.player, false, Engine::GetTicks());
+		}
+	}
+
+	/// <summary>
+	/// Check a player ID
+	/// </summary>
+	/// <param name="player">Player ID</param>
+	void Input::CheckPlayer(const int player) {
+		if (player < 0 || player >= MaxPlayers) {
+			Engine::Error("Invalid player ID \"" + std::to_string(player) + "\".");
 		}
 	}
 
@@ -43,30 +261,161 @@ namespace Violet {
 	/// Check if a button is being pressed
 	/// </summary>
 	/// <param name="button">Button ID</param>
+	/// <param name="player">Player ID</param>
 	/// <returns>True if pressed, false if not</returns>
-	bool Input::CheckButtonPress(Button button) {
-		int id = static_cast<int>(button);
-		return buttons[id];
+	bool Input::CheckButtonPress(Button button, const int player) {
+		CheckPlayer(player);
+		return players[player].pressed[static_cast<int>(button)];
 	}
 
 	/// <summary>
 	/// Check if a button was tapped
 	/// </summary>
 	/// <param name="button">Button ID</param>
+	/// <param name="player">Player ID</param>
 	/// <returns>True if tapped, false if not</returns>
-	bool Input::CheckButtonTap(Button button) {
-		int id = static_cast<int>(button);
-		return buttons[id] && !buttonsPrev[id];
+	bool Input::CheckButtonTap(Button button, const int player) {
+		CheckPlayer(player);
+		return players[player].tapped[static_cast<int>(button)];
 	}
 
 	/// <summary>
 	/// Check if a button was released
 	/// </summary>
 	/// <param name="button">Button ID</param>
+	/// <param name="player">Player ID</param>
 	/// <returns>True if released, false if not</returns>
-	bool Input::CheckButtonRelease(Button button) {
-		int id = static_cast<int>(button);
-		return !buttons[id] && buttonsPrev[id];
+	bool Input::CheckButtonRelease(Button button, const int player) {
+		CheckPlayer(player);
+		return players[player].released[static_cast<int>(button)];
+	}
+
+	/// <summary>
+	/// Get an analog input (triggers only use X)
+	/// </summary>
+	/// <param name="analog">Analog input ID</param>
+	/// <param name="player">Player ID</param>
+	/// <returns>Analog input value, with the dead zone applied</returns>
+	Vec2D<float> Input::GetAnalog(Analog analog, const int player) {
+		CheckPlayer(player);
+		Vec2D<float> value = players[player].analog[static_cast<int>(analog)];
+
+		// Triggers
+		if (analog == Analog::LeftTrigger || analog == Analog::RightTrigger) {
+			if (value.x <= deadZone) {
+				return Vec2D<float>(0, 0);
+			}
+			return Vec2D<float>(Math::Min((value.x - deadZone) / (1 - deadZone), 1.0f), 0);
+		}
+
+		// Sticks (radial dead zone, rescaled so that the edge of the dead zone is 0)
+		float length = Math::Sqrt(value.x * value.x + value.y * value.y);
+		if (length <= deadZone) {
+			return Vec2D<float>(0, 0);
+		}
+		float scale = Math::Min((length - deadZone) / (1 - deadZone), 1.0f) / length;
+		return Vec2D<float>(value.x * scale, value.y * scale);
+	}
+
+	/// <summary>
+	/// Set analog dead zone
+	/// </summary>
+	/// <param name="deadZone">Dead zone (0-1)</param>
+	void Input::SetDeadZone(const float deadZone) {
+		if (deadZone < 0 || deadZone >= 1) {
+			Engine::Error("Invalid analog dead zone \"" + std::to_string(deadZone) + "\".");
+		}
+		Input::deadZone = deadZone;
+	}
+
+	/// <summary>
+	/// Check if a player has a controller connected
+	/// </summary>
+	/// <param name="player">Player ID</param>
+	/// <returns>True if connected, false if not</returns>
+	bool Input::CheckController(const int player) {
+		CheckPlayer(player);
+		return players[player].controller;
+	}
+
+	/// <summary>
+	/// Get the input events latched for this frame
+	/// </summary>
+	/// <returns>Input events, in the order they happened</returns>
+	const std::vector<InputEvent>& Input::GetEvents() {
+		return frameEvents;
+	}
+
+	/// <summary>
+	/// Bind an input to a button
+	/// </summary>
+	/// <param name="button">Button ID</param>
+	/// <param name="source">Input source</param>
+	/// <param name="code">Shell key or controller button code</param>
+	/// <param name="player">Player ID</param>
+	void Input::Bind(Button button, InputSource source, const int code, const int player) {
+		CheckPlayer(player);
+		for (const InputBinding& binding : bindings) {
+			if (binding.button == button && binding.source == source && binding.code == code && binding.player == player) {
+				return;
+			}
+		}
+
+		ReleaseAll();
+		bindings.push_back({ source, code, player, button });
+	}
+
+	/// <summary>
+	/// Remove all bindings of a button
+	/// </summary>
+	/// <param name="button">Button ID</param>
+	/// <param name="player">Player ID</param>
+	void Input::Unbind(Button button, const int player) {
+		CheckPlayer(player);
+		ReleaseAll();
+		bindings.erase(std::remove_if(bindings.begin(), bindings.end(), [&](const InputBinding& binding) {
+			return binding.button == button && binding.player == player;
+		}), bindings.end());
+	}
+
+	/// <summary>
+	/// Remove all bindings
+	/// </summary>
+	void Input::ClearBindings() {
+		ReleaseAll();
+		bindings.clear();
+	}
+
+	/// <summary>
+	/// Restore the shell's default bindings
+	/// </summary>
+	void Input::ResetBindings() {
+		ClearBindings();
+		Shell::BindDefaultInput();
+	}
+
+	/// <summary>
+	/// Get bindings
+	/// </summary>
+	/// <returns>Bindings</returns>
+	const std::vector<InputBinding>& Input::GetBindings() {
+		return bindings;
+	}
+
+	/// <summary>
+	/// Get the last key or controller button pressed, bound or not (for rebinding)
+	/// </summary>
+	/// <param name="source">Input source output</param>
+	/// <param name="code">Shell key or controller button code output</param>
+	/// <returns>True if anything was pressed since the last call, false if not</returns>
+	bool Input::GetLastInput(InputSource& source, int& code) {
+		if (!lastInputSet) {
+			return false;
+		}
+		source = lastSource;
+		code = lastCode;
+		lastInputSet = false;
+		return true;
 	}
 
 }
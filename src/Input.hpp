@@ -108,6 +108,106 @@ namespace Violet {
 		Count
 	};
 
+	/// <summary>
+	/// Maximum number of players
+	/// </summary>
+	constexpr int MaxPlayers = 4;
+
+	/// <summary>
+	/// Input sources that can be bound to buttons
+	/// </summary>
+	enum class InputSource {
+		/// <summary>
+		/// Keyboard key (shell key code)
+		/// </summary>
+		Key = 0,
+
+		/// <summary>
+		/// Controller button (shell controller button code)
+		/// </summary>
+		ControllerButton
+	};
+
+	/// <summary>
+	/// Input event types
+	/// </summary>
+	enum class InputEventType {
+		/// <summary>
+		/// Button pressed or released
+		/// </summary>
+		Button = 0,
+
+		/// <summary>
+		/// Analog axis moved
+		/// </summary>
+		Analog
+	};
+
+	/// <summary>
+	/// Input event
+	/// </summary>
+	struct InputEvent {
+		/// <summary>
+		/// Tick that the event happened at
+		/// </summary>
+		double tick{ 0 };
+
+		/// <summary>
+		/// Event type
+		/// </summary>
+		InputEventType type{ InputEventType::Button };
+
+		/// <summary>
+		/// Player ID
+		/// </summary>
+		int player{ 0 };
+
+		/// <summary>
+		/// Button or analog input ID
+		/// </summary>
+		int id{ 0 };
+
+		/// <summary>
+		/// Analog axis (0 = X, 1 = Y)
+		/// </summary>
+		int axis{ 0 };
+
+		/// <summary>
+		/// Pressed flag (buttons)
+		/// </summary>
+		bool pressed{ false };
+
+		/// <summary>
+		/// Axis value (analog inputs)
+		/// </summary>
+		float value{ 0 };
+	};
+
+	/// <summary>
+	/// Input binding
+	/// </summary>
+	struct InputBinding {
+		/// <summary>
+		/// Input source
+		/// </summary>
+		InputSource source{ InputSource::Key };
+
+		/// <summary>
+		/// Shell key or controller button code
+		/// </summary>
+		int code{ 0 };
+
+		/// <summary>
+		/// Player ID
+		/// </summary>
+		int player{ 0 };
+
+		/// <summary>
+		/// Bound button
+		/// </summary>
+		Button button{ Button::A };
+	};
+
 	/// <summary>
 	/// Input
 	/// </summary>
@@ -117,52 +217,273 @@ namespace Violet {
 		/// Check if a button is being pressed
 		/// </summary>
 		/// <param name="button">Button ID</param>
+		/// <param name="player">Player ID</param>
 		/// <returns>True if pressed, false if not</returns>
-		static bool CheckButtonPress(Button button);
+		static bool CheckButtonPress(Button button, const int player = 0);
 
 		/// <summary>
 		/// Check if a button was tapped
 		/// </summary>
 		/// <param name="button">Button ID</param>
+		/// <param name="player">Player ID</param>
 		/// <returns>True if tapped, false if not</returns>
-		static bool CheckButtonTap(Button button);
+		static bool CheckButtonTap(Button button, const int player = 0);
 
 		/// <summary>
 		/// Check if a button was released
 		/// </summary>
 		/// <param name="button">Button ID</param>
+		/// <param name="player">Player ID</param>
 		/// <returns>True if released, false if not</returns>
-		static bool CheckButtonRelease(Button button);
+		static bool CheckButtonRelease(Button button, const int player = 0);
+
+		/// <summary>
+		/// Get an analog input (triggers only use X)
+		/// </summary>
+		/// <param name="analog">Analog input ID</param>
+		/// <param name="player">Player ID</param>
+		/// <returns>Analog input value, with the dead zone applied</returns>
+		static Vec2D<float> GetAnalog(Analog analog, const int player = 0);
+
+		/// <summary>
+		/// Set analog dead zone
+		/// </summary>
+		/// <param name="deadZone">Dead zone (0-1)</param>
+		static void SetDeadZone(const float deadZone);
+
+		/// <summary>
+		/// Check if a player has a controller connected
+		/// </summary>
+		/// <param name="player">Player ID</param>
+		/// <returns>True if connected, false if not</returns>
+		static bool CheckController(const int player);
+
+		/// <summary>
+		/// Get the input events latched for this frame
+		/// </summary>
+		/// <returns>Input events, in the order they happened</returns>
+		static const std::vector<InputEvent>& GetEvents();
+
+		/// <summary>
+		/// Bind an input to a button
+		/// </summary>
+		/// <param name="button">Button ID</param>
+		/// <param name="source">Input source</param>
+		/// <param name="code">Shell key or controller button code</param>
+		/// <param name="player">Player ID</param>
+		static void Bind(Button button, InputSource source, const int code, const int player = 0);
+
+		/// <summary>
+		/// Remove all bindings of a button
+		/// </summary>
+		/// <param name="button">Button ID</param>
+		/// <param name="player">Player ID</param>
+		static void Unbind(Button button, const int player = 0);
+
+		/// <summary>
+		/// Remove all bindings
+		/// </summary>
+		static void ClearBindings();
+
+		/// <summary>
+		/// Restore the shell's default bindings
+		/// </summary>
+		static void ResetBindings();
+
+		/// <summary>
+		/// Get bindings
+		/// </summary>
+		/// <returns>Bindings</returns>
+		static const std::vector<InputBinding>& GetBindings();
+
+		/// <summary>
+		/// Get the last key or controller button pressed, bound or not (for rebinding)
+		/// </summary>
+		/// <param name="source">Input source output</param>
+		/// <param name="code">Shell key or controller button code output</param>
+		/// <returns>True if anything was pressed since the last call, false if not</returns>
+		static bool GetLastInput(InputSource& source, int& code);
 
 		// Friend classes
 		friend class Engine;
+		friend class Graphics;
+		friend class InputRecorder;
 		friend class Shell;
 
 	private:
+		/// <summary>
+		/// Button bitset
+		/// </summary>
+		using ButtonSet = std::bitset<static_cast<size_t>(Button::Count)>;
+
+		/// <summary>
+		/// Player input state
+		/// </summary>
+		struct PlayerState {
+			/// <summary>
+			/// Number of inputs holding each button after the latched events
+			/// </summary>
+			U8 holds[static_cast<int>(Button::Count)]{ 0 };
+
+			/// <summary>
+			/// Buttons held after the latched events
+			/// </summary>
+			ButtonSet down;
+
+			/// <summary>
+			/// Buttons that count as pressed
+			/// </summary>
+			ButtonSet pressed;
+
+			/// <summary>
+			/// Buttons tapped this frame
+			/// </summary>
+			ButtonSet tapped;
+
+			/// <summary>
+			/// Buttons released this frame
+			/// </summary>
+			ButtonSet released;
+
+			/// <summary>
+			/// Analog inputs
+			/// </summary>
+			Vec2D<float> analog[static_cast<int>(Analog::Count)];
+
+			/// <summary>
+			/// Controller connected flag
+			/// </summary>
+			bool controller{ false };
+		};
+
+		/// <summary>
+		/// Raw input held down
+		/// </summary>
+		struct HeldInput {
+			/// <summary>
+			/// Input source
+			/// </summary>
+			InputSource source;
+
+			/// <summary>
+			/// Shell key or controller button code
+			/// </summary>
+			int code;
+
+			/// <summary>
+			/// Player ID of the controller (-1 for keys)
+			/// </summary>
+			int player;
+		};
+
 		/// <summary>
 		/// Set up new frame of input
 		/// </summary>
 		static void NewFrame();
 
 		/// <summary>
-		/// Buttons
+		/// Latch the pending events for the update phase
+		/// </summary>
+		static void LatchFrame();
+
+		/// <summary>
+		/// Let the draw phase see the pending events' state, leaving them for the next frame's taps and releases
+		/// </summary>
+		static void LatchLate();
+
+		/// <summary>
+		/// Queue a raw input from the shell
+		/// </summary>
+		/// <param name="source">Input source</param>
+		/// <param name="code">Shell key or controller button code</param>
+		/// <param name="player">Player ID of the controller (ignored for keys)</param>
+		/// <param name="pressed">Pressed flag</param>
+		/// <param name="tick">Tick that the input happened at</param>
+		static void QueueInput(InputSource source, const int code, const int player, const bool pressed, const double tick);
+
+		/// <summary>
+		/// Queue an analog axis from the shell
+		/// </summary>
+		/// <param name="player">Player ID</param>
+		/// <param name="analog">Analog input ID</param>
+		/// <param name="axis">Axis (0 = X, 1 = Y)</param>
+		/// <param name="value">Axis value</param>
+		/// <param name="tick">Tick that the input happened at</param>
+		static void QueueAnalog(const int player, Analog analog, const int axis, const float value, const double tick);
+
+		/// <summary>
+		/// Release all of a player's buttons and analog inputs (controller disconnected)
+		/// </summary>
+		/// <param name="player">Player ID</param>
+		/// <param name="tick">Tick that the controller disconnected at</param>
+		static void QueueRelease(const int player, const double tick);
+
+		/// <summary>
+		/// Apply an event to a player's state
+		/// </summary>
+		/// <param name="ev">Event</param>
+		static void ApplyEvent(const InputEvent& ev);
+
+		/// <summary>
+		/// Release all held inputs (bindings changed)
+		/// </summary>
+		static void ReleaseAll();
+
+		/// <summary>
+		/// Check a player ID
+		/// </summary>
+		/// <param name="player">Player ID</param>
+		static void CheckPlayer(const int player);
+
+		/// <summary>
+		/// Player states
+		/// </summary>
+		static PlayerState players[MaxPlayers];
+
+		/// <summary>
+		/// Pending events
+		/// </summary>
+		static std::vector<InputEvent> events;
+
+		/// <summary>
+		/// Events latched for this frame
+		/// </summary>
+		static std::vector<InputEvent> frameEvents;
+
+		/// <summary>
+		/// Bindings
+		/// </summary>
+		static std::vector<InputBinding> bindings;
+
+		/// <summary>
+		/// Raw inputs held down
+		/// </summary>
+		static std::vector<HeldInput> held;
+
+		/// <summary>
+		/// Analog dead zone
+		/// </summary>
+		static float deadZone;
+
+		/// <summary>
+		/// Last input pressed flag
 		/// </summary>
-		static bool buttons[static_cast<int>(Button::Count)];
+		static bool lastInputSet;
 
 		/// <summary>
-		/// Previous buttons
+		/// Last input source pressed
 		/// </summary>
-		static bool buttonsPrev[static_cast<int>(Button::Count)];
+		static InputSource lastSource;
 
 		/// <summary>
-		/// Analog inputs
+		/// Last input code pressed
 		/// </summary>
-		static float analog[static_cast<int>(Analog::Count)];
+		static int lastCode;
 
 		/// <summary>
-		/// Previous analog inputs
+		/// Tick of the last input sample
 		/// </summary>
-		static float analogPrev[static_cast<int>(Analog::Count)];
+		static double sampleTick;
 	};
 
 }
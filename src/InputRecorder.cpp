@@ -0,0 +1,259 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+namespace Violet {
+
+	/// <summary>
+	/// File
+	/// </summary>
+	std::shared_ptr<BinaryFile> InputRecorder::file;
+
+	/// <summary>
+	/// Recording flag
+	/// </summary>
+	bool InputRecorder::recording{ false };
+
+	/// <summary>
+	/// Replaying flag
+	/// </summary>
+	bool InputRecorder::replaying{ false };
+
+	/// <summary>
+	/// Current step
+	/// </summary>
+	U32 InputRecorder::step{ 0 };
+
+	/// <summary>
+	/// Number of steps in the replay
+	/// </summary>
+	U32 InputRecorder::stepCount{ 0 };
+
+	/// <summary>
+	/// Step count position in the file
+	/// </summary>
+	long InputRecorder::stepCountPos{ 0 };
+
+	/// <summary>
+	/// Last recorded or replayed states
+	/// </summary>
+	InputRecorder::StepState InputRecorder::states[MaxPlayers];
+
+	/// <summary>
+	/// Start recording input
+	/// </summary>
+	/// <param name="fileName">File name</param>
+	/// <param name="seed">Random number generator seed to start with</param>
+	void InputRecorder::StartRecording(std::string fileName, const U64 seed) {
+		Stop();
+
+		file = Engine::OpenBinaryFile(fileName, false);
+		file->WriteString("VIOLREC", false);
+		file->WriteUInt8(1);
+		file->WriteFloat(Engine::GetGameFPS());
+		file->WriteUInt64(seed);
+		stepCountPos = file->GetPosition();
+		file->WriteUInt32(0);
+
+		Math::SetSeed(seed);
+		for (StepState& state : states) {
+			state = StepState();
+		}
+		step = 0;
+		recording = true;
+
+		Engine::DebugMessage("INPUT RECORD START:  " + fileName);
+	}
+
+	/// <summary>
+	/// Start replaying recorded input
+	/// </summary>
+	/// <param name="fileName">File name</param>
+	void InputRecorder::StartReplay(std::string fileName) {
+		Stop();
+
+		file = Engine::OpenBinaryFile(fileName, true);
+		if (file->ReadString(7) != "VIOLREC") {
+			Engine::Error("File \"" + fileName + "\" is not a valid input recording.");
+		}
+		U8 version = file->ReadUInt8();
+		if (version != 1) {
+			Engine::Error("Input recording file \"" + fileName + "\" version (" + std::to_string(version) + ") is not supported.");
+		}
+
+		// Steps only line up if they run at the same rate
+		float fps = file->ReadFloat();
+		if (fps != Engine::GetGameFPS()) {
+			Engine::Error("Input recording file \"" + fileName + "\" was recorded at " + std::to_string(fps) + " FPS.");
+		}
+		Math::SetSeed(file->ReadUInt64());
+		stepCount = file->ReadUInt32();
+
+		for (StepState& state : states) {
+			state = StepState();
+		}
+		Input::events.clear();
+		Input::held.clear();
+		step = 0;
+		replaying = true;
+
+		Engine::DebugMessage("INPUT REPLAY START:  " + fileName + " (" + std::to_string(stepCount) + " steps)");
+	}
+
+	/// <summary>
+	/// Stop recording or replaying input
+	/// </summary>
+	void InputRecorder::Stop() {
+		if (recording) {
+			file->Seek(stepCountPos);
+			file->WriteUInt32(step);
+			Engine::DebugMessage("INPUT RECORD END:    " + std::to_string(step) + " steps");
+		}
+		else if (replaying) {
+			// Go back to live input from a clean state
+			for (int i = 0; i < MaxPlayers; ++i) {
+				bool controller = Input::players[i].controller;
+				Input::players[i] = Input::PlayerState();
+				Input::players[i].controller = controller;
+			}
+			Engine::DebugMessage("INPUT REPLAY END:    " + std::to_string(step) + " steps");
+		}
+
+		file = nullptr;
+		recording = false;
+		replaying = false;
+	}
+
+	/// <summary>
+	/// Check if input is being recorded
+	/// </summary>
+	/// <returns>True if recording, false if not</returns>
+	bool InputRecorder::CheckRecording() {
+		return recording;
+	}
+
+	/// <summary>
+	/// Check if input is being replayed
+	/// </summary>
+	/// <returns>True if replaying, false if not</returns>
+	bool InputRecorder::CheckReplaying() {
+		return replaying;
+	}
+
+	/// <summary>
+	/// Get the number of fixed update steps recorded or replayed so far
+	/// </summary>
+	/// <returns>Number of steps</returns>
+	U32 InputRecorder::GetStep() {
+		return step;
+	}
+
+	/// <summary>
+	/// Record or replay the input for a fixed update step
+	/// </summary>
+	void InputRecorder::Step() {
+		if (recording) {
+			RecordStep();
+		}
+		else if (replaying) {
+			if (step >= stepCount) {
+				Stop();
+				return;
+			}
+			ReplayStep();
+		}
+	}
+
+	/// <summary>
+	/// Record a step
+	/// </summary>
+	void InputRecorder::RecordStep() {
+		// Only players whose state changed get written, so idle steps take up 1 byte
+		StepState newStates[MaxPlayers];
+		U8 playerMask = 0;
+		for (int i = 0; i < MaxPlayers; ++i) {
+			const Input::PlayerState& player = Input::players[i];
+			StepState& state = newStates[i];
+			state.pressed = static_cast<U16>(player.pressed.to_ulong());
+			state.tapped = static_cast<U16>(player.tapped.to_ulong());
+			state.released = static_cast<U16>(player.released.to_ulong());
+			for (int j = 0; j < static_cast<int>(Analog::Count); ++j) {
+				state.analog[j * 2] = player.analog[j].x;
+				state.analog[j * 2 + 1] = player.analog[j].y;
+			}
+
+			bool changed = state.pressed != states[i].pressed || state.tapped != states[i].tapped || state.released != states[i].released;
+			for (int j = 0; j < AnalogComponents; ++j) {
+				changed |= state.analog[j] != states[i].analog[j];
+			}
+			if (changed) {
+				playerMask |= 1 << i;
+			}
+		}
+
+		file->WriteUInt8(playerMask);
+		for (int i = 0; i < MaxPlayers; ++i) {
+			if (!(playerMask & (1 << i))) {
+				continue;
+			}
+
+			StepState& state = newStates[i];
+			file->WriteUInt16(state.pressed);
+			file->WriteUInt16(state.tapped);
+			file->WriteUInt16(state.released);
+
+			U8 analogMask = 0;
+			for (int j = 0; j < AnalogComponents; ++j) {
+				if (state.analog[j] != states[i].analog[j]) {
+					analogMask |= 1 << j;
+				}
+			}
+			file->WriteUInt8(analogMask);
+			for (int j = 0; j < AnalogComponents; ++j) {
+				if (analogMask & (1 << j)) {
+					file->WriteFloat(state.analog[j]);
+				}
+			}
+
+			states[i] = state;
+		}
+
+		++step;
+	}
+
+	/// <summary>
+	/// Replay a step
+	/// </summary>
+	void InputRecorder::ReplayStep() {
+		U8 playerMask = file->ReadUInt8();
+		for (int i = 0; i < MaxPlayers; ++i) {
+			StepState& state = states[i];
+			if (playerMask & (1 << i)) {
+				state.pressed = file->ReadUInt16();
+				state.tapped = file->ReadUInt16();
+				state.released = file->ReadUInt16();
+
+				U8 analogMask = file->ReadUInt8();
+				for (int j = 0; j < AnalogComponents; ++j) {
+					if (analogMask & (1 << j)) {
+						state.analog[j] = file->ReadFloat();
+					}
+				}
+			}
+
+			Input::PlayerState& player = Input::players[i];
+			player.pressed = Input::ButtonSet(state.pressed);
+			player.tapped = Input::ButtonSet(state.tapped);
+			player.released = Input::ButtonSet(state.released);
+			for (int j = 0; j < static_cast<int>(Analog::Count); ++j) {
+				player.analog[j] = Vec2D<float>(state.analog[j * 2], state.analog[j * 2 + 1]);
+			}
+		}
+
+		++step;
+	}
+
+}
@@ -0,0 +1,140 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#ifndef VIOLET_INPUT_RECORDER_HPP
+#define VIOLET_INPUT_RECORDER_HPP
+
+namespace Violet {
+
+	/// <summary>
+	/// Input recorder (records and replays the input seen by each fixed update step)
+	/// </summary>
+	class InputRecorder {
+	public:
+		/// <summary>
+		/// Start recording input
+		/// </summary>
+		/// <param name="fileName">File name</param>
+		/// <param name="seed">Random number generator seed to start with</param>
+		static void StartRecording(std::string fileName, const U64 seed);
+
+		/// <summary>
+		/// Start replaying recorded input
+		/// </summary>
+		/// <param name="fileName">File name</param>
+		static void StartReplay(std::string fileName);
+
+		/// <summary>
+		/// Stop recording or replaying input
+		/// </summary>
+		static void Stop();
+
+		/// <summary>
+		/// Check if input is being recorded
+		/// </summary>
+		/// <returns>True if recording, false if not</returns>
+		static bool CheckRecording();
+
+		/// <summary>
+		/// Check if input is being replayed
+		/// </summary>
+		/// <returns>True if replaying, false if not</returns>
+		static bool CheckReplaying();
+
+		/// <summary>
+		/// Get the number of fixed update steps recorded or replayed so far
+		/// </summary>
+		/// <returns>Number of steps</returns>
+		static U32 GetStep();
+
+		// Friend classes
+		friend class Engine;
+		friend class Input;
+
+	private:
+		/// <summary>
+		/// Analog components per player
+		/// </summary>
+		static constexpr int AnalogComponents = static_cast<int>(Analog::Count) * 2;
+
+		/// <summary>
+		/// Input state of a player for a step
+		/// </summary>
+		struct StepState {
+			/// <summary>
+			/// Pressed buttons
+			/// </summary>
+			U16 pressed{ 0 };
+
+			/// <summary>
+			/// Tapped buttons
+			/// </summary>
+			U16 tapped{ 0 };
+
+			/// <summary>
+			/// Released buttons
+			/// </summary>
+			U16 released{ 0 };
+
+			/// <summary>
+			/// Analog components
+			/// </summary>
+			float analog[AnalogComponents]{ 0 };
+		};
+
+		/// <summary>
+		/// Record or replay the input for a fixed update step
+		/// </summary>
+		static void Step();
+
+		/// <summary>
+		/// Record a step
+		/// </summary>
+		static void RecordStep();
+
+		/// <summary>
+		/// Replay a step
+		/// </summary>
+		static void ReplayStep();
+
+		/// <summary>
+		/// File
+		/// </summary>
+		static std::shared_ptr<BinaryFile> file;
+
+		/// <summary>
+		/// Recording flag
+		/// </summary>
+		static bool recording;
+
+		/// <summary>
+		/// Replaying flag
+		/// </summary>
+		static bool replaying;
+
+		/// <summary>
+		/// Current step
+		/// </summary>
+		static U32 step;
+
+		/// <summary>
+		/// Number of steps in the replay
+		/// </summary>
+		static U32 stepCount;
+
+		/// <summary>
+		/// Step count position in the file
+		/// </summary>
+		static long stepCountPos;
+
+		/// <summary>
+		/// Last recorded or replayed states
+		/// </summary>
+		static StepState states[MaxPlayers];
+	};
+
+}
+
+#endif // VIOLET_INPUT_RECORDER_HPP
@@ -156,11 +156,10 @@ namespace Violet {
 	/// Draw map
 	/// </summary>
 	void Map::Draw() {
+		AllocScope allocScope(AllocTag::Map);
 		LayerType layerType = Graphics::curLayerType;
 		Graphics::curLayerType = LayerType::Map;
 
-		Size2D<int> viewSize = Graphics::GetViewSize();
-		
 		// Make sure that the largest tile remains drawn, even if partially offscreen
 		float drawBackX = 0;
 		float drawBackY = 0;
@@ -187,17 +186,22 @@ namespace Violet {
 
 		for (int i = 0; i < LayerCount; ++i) {
 			if (layers[i].tiles) {
-				int initMapX = static_cast<int>(Math::Floor(layers[i].scroll.x / gridSize.w)) - mapBackX;
-				float initDrawX = (Math::Floor(layers[i].scroll.x / gridSize.w) * gridSize.w) - layers[i].scroll.x - drawBackX;
+				// Only tiles in the area that the layer's camera can see are drawn
+				Rect<float> visible = Graphics::GetVisibleRect(i);
+				float scrollX = layers[i].scroll.x + visible.x;
+				float scrollY = layers[i].scroll.y + visible.y;
 
-				int mapY = static_cast<int>(Math::Floor(layers[i].scroll.y / gridSize.h)) - mapBackY;
-				float drawY = (Math::Floor(layers[i].scroll.y / gridSize.h) * gridSize.h) - layers[i].scroll.y - drawBackY;
+				int initMapX = static_cast<int>(Math::Floor(scrollX / gridSize.w)) - mapBackX;
+				float initDrawX = (Math::Floor(scrollX / gridSize.w) * gridSize.w) - layers[i].scroll.x - drawBackX;
 
-				while (drawY < viewSize.h) {
+				int mapY = static_cast<int>(Math::Floor(scrollY / gridSize.h)) - mapBackY;
+				float drawY = (Math::Floor(scrollY / gridSize.h) * gridSize.h) - layers[i].scroll.y - drawBackY;
+
+				while (drawY < visible.y + visible.h) {
 					int mapX = initMapX;
 					float drawX = initDrawX;
 
-					while (drawX < viewSize.w) {
+					while (drawX < visible.x + visible.w) {
 						if (mapX >= 0 && mapX < mapSize.w && mapY >= 0 && mapY < mapSize.h) {
 							Tile tile = layers[i].tiles[mapX + (mapY * mapSize.w)];
 
@@ -230,6 +234,7 @@ namespace Violet {
 	/// </summary>
 	/// <param name="fileName">File name</param>
 	std::shared_ptr<Map> Engine::OpenMap(std::string fileName) {
+		AllocScope allocScope(AllocTag::Asset);
 		return std::shared_ptr<Map>(new Map(fileName));
 	}
 
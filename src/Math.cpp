@@ -7,6 +7,68 @@
 
 namespace Violet {
 
+	/// <summary>
+	/// Random number generator seed
+	/// </summary>
+	U64 Math::seed{ 0 };
+
+	/// <summary>
+	/// Random number generator state
+	/// </summary>
+	U64 Math::randomState{ 0 };
+
+	/// <summary>
+	/// Set random number generator seed
+	/// </summary>
+	/// <param name="seed">Seed</param>
+	void Math::SetSeed(const U64 seed) {
+		Math::seed = seed;
+		randomState = seed;
+	}
+
+	/// <summary>
+	/// Get random number generator seed
+	/// </summary>
+	/// <returns>Seed that the generator was last set with</returns>
+	U64 Math::GetSeed() {
+		return seed;
+	}
+
+	/// <summary>
+	/// Get a random number
+	/// </summary>
+	/// <returns>Random number</returns>
+	U32 Math::Random() {
+		// SplitMix64
+		randomState += 0x9E3779B97F4A7C15ULL;
+		U64 z = randomState;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		return static_cast<U32>((z ^ (z >> 31)) >> 32);
+	}
+
+	/// <summary>
+	/// Get a random number in a range
+	/// </summary>
+	/// <param name="min">Minimum value</param>
+	/// <param name="max">Maximum value (inclusive)</param>
+	/// <returns>Random number</returns>
+	int Math::RandomRange(const int min, const int max) {
+		if (max < min) {
+			Engine::Error("Invalid random range \"" + std::to_string(min) + "-" + std::to_string(max) + "\".");
+		}
+		U64 range = static_cast<U64>(static_cast<S64>(max) - min) + 1;
+		return static_cast<int>(min + static_cast<S64>((Random() * range) >> 32));
+	}
+
+	/// <summary>
+	/// Get a random number between 0 and 1
+	/// </summary>
+	/// <returns>Random number (1 excluded)</returns>
+	float Math::RandomFloat() {
+		return (Random() >> 8) / 16777216.0f;
+	}
+
 	/// <summary>
 	/// Get default ortho projection matrix
 	/// </summary>
@@ -213,6 +213,94 @@ namespace Violet {
 			return Cos(DegToRad(a));
 		}
 
+		/// <summary>
+		/// Get the square root of a value
+		/// </summary>
+		/// <param name="a">Value</param>
+		/// <returns>The square root of the value</returns>
+		template<typename T1>
+		static auto Sqrt(T1 a) {
+			return sqrtf(static_cast<float>(a));
+		}
+
+		/// <summary>
+		/// Linearly interpolate between 2 values
+		/// </summary>
+		/// <param name="a">Start value</param>
+		/// <param name="b">End value</param>
+		/// <param name="t">Interpolation factor</param>
+		/// <returns>The interpolated value</returns>
+		template<typename T1>
+		static T1 Lerp(T1 a, T1 b, const float t) {
+			return static_cast<T1>(a + (b - a) * t);
+		}
+
+		/// <summary>
+		/// Linearly interpolate between 2 vectors
+		/// </summary>
+		/// <param name="a">Start vector</param>
+		/// <param name="b">End vector</param>
+		/// <param name="t">Interpolation factor</param>
+		/// <returns>The interpolated vector</returns>
+		template<typename T1>
+		static Vec2D<T1> Lerp(Vec2D<T1> a, Vec2D<T1> b, const float t) {
+			return Vec2D<T1>(Lerp(a.x, b.x, t), Lerp(a.y, b.y, t));
+		}
+
+		/// <summary>
+		/// Find the lowest set bit of a value
+		/// </summary>
+		/// <param name="a">Value (must not be 0)</param>
+		/// <returns>Index of the lowest set bit</returns>
+		static int FindFirstSet(const U64 a) {
+#if defined(_MSC_VER) && defined(VIOLET_64_BIT)
+			unsigned long index;
+			_BitScanForward64(&index, a);
+			return static_cast<int>(index);
+#elif defined(_MSC_VER)
+			unsigned long index;
+			if (_BitScanForward(&index, static_cast<unsigned long>(a))) {
+				return static_cast<int>(index);
+			}
+			_BitScanForward(&index, static_cast<unsigned long>(a >> 32));
+			return static_cast<int>(index) + 32;
+#else
+			return __builtin_ctzll(a);
+#endif
+		}
+
+		/// <summary>
+		/// Set random number generator seed
+		/// </summary>
+		/// <param name="seed">Seed</param>
+		static void SetSeed(const U64 seed);
+
+		/// <summary>
+		/// Get random number generator seed
+		/// </summary>
+		/// <returns>Seed that the generator was last set with</returns>
+		static U64 GetSeed();
+
+		/// <summary>
+		/// Get a random number
+		/// </summary>
+		/// <returns>Random number</returns>
+		static U32 Random();
+
+		/// <summary>
+		/// Get a random number in a range
+		/// </summary>
+		/// <param name="min">Minimum value</param>
+		/// <param name="max">Maximum value (inclusive)</param>
+		/// <returns>Random number</returns>
+		static int RandomRange(const int min, const int max);
+
+		/// <summary>
+		/// Get a random number between 0 and 1
+		/// </summary>
+		/// <returns>Random number (1 excluded)</returns>
+		static float RandomFloat();
+
 		/// <summary>
 		/// Get ortho projection matrix
 		/// </summary>
@@ -254,6 +342,17 @@ namespace Violet {
 		/// <param name="angle">Angle</param>
 		/// <returns>Generated matrix</returns>
 		static Matrix4x4<float> Transform2DMat(Vec2D<float> pos, Vec2D<float> scale, float angle);
+
+	private:
+		/// <summary>
+		/// Random number generator seed
+		/// </summary>
+		static U64 seed;
+
+		/// <summary>
+		/// Random number generator state
+		/// </summary>
+		static U64 randomState;
 	};
 
 }
@@ -21,6 +21,7 @@ namespace Violet {
 	/// <param name="msg">Debug message</param>
 	void Engine::DebugMessage(std::string msg) {
 #ifdef VIOLET_DEBUG
+		AllocScope allocScope(AllocTag::Message);
 		printf(("[Debug] " + msg + "\n").c_str());
 #endif
 	}
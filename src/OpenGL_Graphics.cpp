@@ -7,6 +7,36 @@
 
 namespace Violet {
 
+	/// <summary>
+	/// Swapped frame fence
+	/// </summary>
+	struct SwapFence {
+		/// <summary>
+		/// Fence
+		/// </summary>
+		GLsync fence;
+
+		/// <summary>
+		/// Tick that the frame's input was sampled at
+		/// </summary>
+		double inputTick;
+	};
+
+	/// <summary>
+	/// Fences of swapped frames that may still be queued up
+	/// </summary>
+	static std::vector<SwapFence> swapFences;
+
+	/// <summary>
+	/// Delete swapped frame fences
+	/// </summary>
+	static void ClearSwapFences() {
+		for (SwapFence& swapFence : swapFences) {
+			glDeleteSync(swapFence.fence);
+		}
+		swapFences.clear();
+	}
+
 	/// <summary>
 	/// Initialize graphics API
 	/// </summary>
@@ -19,6 +49,7 @@ namespace Violet {
 	/// Dispose of graphics API data
 	/// </summary>
 	void Graphics::DisposeAPI() {
+		ClearSwapFences();
 		glUseProgram(0);
 	}
 
@@ -26,10 +57,138 @@ namespace Violet {
 	/// Update graphics manager
 	/// </summary>
 	void Graphics::Update() {
-		Size2D<int> windowSize = Engine::GetWindowSize();
+		Size2D<int> windowSize = drawFrame->windowSize;
+		ColorRGB<float> color = drawFrame->bgColor;
+		if (drawFrame->lowResLayers > 0) {
+			lowResTarget->Resize(drawFrame->viewSize);
+			lowResTarget->SetActive();
+		}
+		else {
+			RenderTarget::Unset();
+			glViewport(0, 0, windowSize.w, windowSize.h);
+		}
+		glClearColor(color.r, color.g, color.b, 1);
+		glClear(drawFrame->depthOrdering ? (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT) : GL_COLOR_BUFFER_BIT);
+	}
+
+	/// <summary>
+	/// Set depth state
+	/// </summary>
+	/// <param name="test">Depth test flag</param>
+	/// <param name="write">Depth write flag (for opaque sprites, which are drawn without blending)</param>
+	void Graphics::SetDepthState(const bool test, const bool write) {
+		if (test) {
+			glEnable(GL_DEPTH_TEST);
+			glDepthFunc(write ? GL_LESS : GL_LEQUAL);
+		}
+		else {
+			glDisable(GL_DEPTH_TEST);
+		}
+
+		// Nothing is written with the test off, and the mask has to stay on for the depth buffer to be cleared
+		glDepthMask((write || !test) ? GL_TRUE : GL_FALSE);
+		if (write) {
+			glDisable(GL_BLEND);
+		}
+		else {
+			glEnable(GL_BLEND);
+		}
+	}
+
+	/// <summary>
+	/// Force the depth of everything drawn to a layer slot's depth (for shaders that don't output it)
+	/// </summary>
+	/// <param name="layer">Layer slot (-1 = use the depth the shader outputs)</param>
+	void Graphics::SetLayerDepth(const int layer) {
+		if (layer < 0) {
+			glDepthRange(0, 1);
+			return;
+		}
+
+		// The default projection flips the depth AddSprite sets, so later layers are nearer. A collapsed depth range
+		// maps every fragment to the same depth, which is nudged a quarter slot forward so that rounding can't put it
+		// behind the layer's own opaque sprites.
+		double depth = 1.0 - ((layer + 0.75) / TotalLayerCount);
+		glDepthRange(depth, depth);
+	}
+
+	/// <summary>
+	/// Scale the low resolution image up to the window
+	/// </summary>
+	/// <param name="source">Render target with the low resolution image</param>
+	void Graphics::DrawUpscale(RenderTarget& source) {
+		Size2D<int> windowSize = drawFrame->windowSize;
+		Rect<int> area = GetUpscaleArea(drawFrame->viewSize, windowSize, drawFrame->upscaleMode);
+
+		// Clear the whole window, as integer scaling may not cover all of it
+		RenderTarget::Unset();
 		glViewport(0, 0, windowSize.w, windowSize.h);
-		glClearColor(bgColor.r, bgColor.g, bgColor.b, 1);
-		glClear(GL_COLOR_BUFFER_BIT);
+		glClear(drawFrame->depthOrdering ? (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT) : GL_COLOR_BUFFER_BIT);
+
+		if (drawFrame->upscaleMode == UpscaleMode::Integer) {
+			copyShader->DrawScreen(source, TextureFilter::Nearest, area);
+		}
+		else {
+			sharpBilinearShader->DrawScreen(source, TextureFilter::Bilinear, area);
+		}
+
+		// Window resolution layers are drawn over the same area, so that they line up with the low resolution ones
+		glViewport(area.x, area.y, area.w, area.h);
+	}
+
+	/// <summary>
+	/// Place a fence after the game thread's graphics commands for a frame
+	/// </summary>
+	/// <param name="frame">Frame</param>
+	void Graphics::FenceFrame(SpriteFrame* const frame) {
+		// Objects created or updated on the game thread must be visible to the render thread
+		frame->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		glFlush();
+	}
+
+	/// <summary>
+	/// Wait for a frame's fence
+	/// </summary>
+	/// <param name="frame">Frame</param>
+	void Graphics::WaitFrameFence(SpriteFrame* const frame) {
+		if (frame->fence) {
+			GLsync fence = static_cast<GLsync>(frame->fence);
+			glWaitSync(fence, 0, GL_TIMEOUT_IGNORED);
+			glDeleteSync(fence);
+			frame->fence = nullptr;
+		}
+	}
+
+
+	/// <summary>
+	/// Limit the number of frames queued up for the GPU after a swap (low latency mode only)
+	/// </summary>
+	/// <param name="frame">Frame that was just swapped</param>
+	void Graphics::ThrottleFrames(SpriteFrame* const frame) {
+		if (!EngineTimer::lowLatency) {
+			ClearSwapFences();
+			return;
+		}
+
+		if (maxQueuedFrames == 0) {
+			// Wait for the swap itself
+			ClearSwapFences();
+			glFinish();
+			EngineTimer::FramePresented(frame->inputTick, Engine::GetTicks());
+			return;
+		}
+
+		// Wait for the oldest frames until few enough are queued up
+		swapFences.push_back({ glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), frame->inputTick });
+		while (static_cast<int>(swapFences.size()) > maxQueuedFrames) {
+			SwapFence swapFence = swapFences.front();
+			while (glClientWaitSync(swapFence.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 100000000) == GL_TIMEOUT_EXPIRED) {
+				// Keep waiting
+			}
+			glDeleteSync(swapFence.fence);
+			swapFences.erase(swapFences.begin());
+			EngineTimer::FramePresented(swapFence.inputTick, Engine::GetTicks());
+		}
 	}
 
 }
@@ -0,0 +1,170 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+namespace Violet {
+
+	/// <summary>
+	/// Render target constructor
+	/// </summary>
+	/// <param name="size">Size</param>
+	/// <param name="depth">Depth buffer flag</param>
+	RenderTarget::RenderTarget(const Size2D<int> size, const bool depth) {
+		// The framebuffers are created by the threads that draw into them, as they aren't shared
+		GLuint texture;
+		glGenTextures(1, &texture);
+		textureID = static_cast<Ptr>(texture);
+
+		Texture::Unset(0);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, texture);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size.w, size.h, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		// Renderbuffers are shared between contexts, unlike the framebuffers that they're attached to
+		if (depth) {
+			GLuint renderbuffer;
+			glGenRenderbuffers(1, &renderbuffer);
+			glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+			glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size.w, size.h);
+			glBindRenderbuffer(GL_RENDERBUFFER, 0);
+			depthID = static_cast<Ptr>(renderbuffer);
+		}
+
+		this->size = size;
+	}
+
+	/// <summary>
+	/// Render target destructor
+	/// </summary>
+	RenderTarget::~RenderTarget() {
+		if (active == this) {
+			Unset();
+		}
+
+		if (id) {
+			GLuint fbo = static_cast<GLuint>(id);
+			glDeleteFramebuffers(1, &fbo);
+		}
+		GLuint texture = static_cast<GLuint>(textureID);
+		glDeleteTextures(1, &texture);
+		if (depthID) {
+			GLuint renderbuffer = static_cast<GLuint>(depthID);
+			glDeleteRenderbuffers(1, &renderbuffer);
+		}
+
+		// The render thread framebuffer can only be deleted by the render thread
+		if (renderID) {
+			std::lock_guard<std::mutex> lock(orphanMutex);
+			orphans.push_back(renderID);
+		}
+	}
+
+	/// <summary>
+	/// Resize (the contents are lost if the size changes)
+	/// </summary>
+	/// <param name="size">Size</param>
+	void RenderTarget::Resize(const Size2D<int> size) {
+		if (size.w == this->size.w && size.h == this->size.h) {
+			return;
+		}
+		if (size.w <= 0 || size.h <= 0) {
+			Engine::Error("Invalid render target size \"" + std::to_string(size.w) + "x" + std::to_string(size.h) + "\".");
+		}
+
+		// Framebuffers keep the texture attached when its storage is replaced
+		Texture::Unset(0);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(textureID));
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size.w, size.h, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		glBindTexture(GL_TEXTURE_2D, 0);
+		if (depthID) {
+			glBindRenderbuffer(GL_RENDERBUFFER, static_cast<GLuint>(depthID));
+			glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size.w, size.h);
+			glBindRenderbuffer(GL_RENDERBUFFER, 0);
+		}
+
+		this->size = size;
+		if (active == this) {
+			glViewport(0, 0, size.w, size.h);
+		}
+	}
+
+	/// <summary>
+	/// Set active (following draws go into the render target, over its whole area)
+	/// </summary>
+	void RenderTarget::SetActive() {
+		if (active != this) {
+			Ptr& fboID = Graphics::IsRenderThread() ? renderID : id;
+			if (!fboID) {
+				GLuint fbo;
+				glGenFramebuffers(1, &fbo);
+				glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, static_cast<GLuint>(textureID), 0);
+				if (depthID) {
+					glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, static_cast<GLuint>(depthID));
+				}
+				if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+					glBindFramebuffer(GL_FRAMEBUFFER, 0);
+					glDeleteFramebuffers(1, &fbo);
+					Engine::Error("Failed to create render target framebuffer.");
+				}
+				fboID = static_cast<Ptr>(fbo);
+			}
+			else {
+				glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(fboID));
+			}
+			active = this;
+		}
+		glViewport(0, 0, size.w, size.h);
+	}
+
+	/// <summary>
+	/// Bind the render target's image to a texture unit
+	/// </summary>
+	/// <param name="filter">Texture filter</param>
+	/// <param name="unit">Unit ID</param>
+	void RenderTarget::BindTexture(const TextureFilter filter, const int unit) {
+		// Take the unit from whichever texture had it, so that it gets bound again when needed
+		Texture::Unset(unit);
+		glActiveTexture(GL_TEXTURE0 + unit);
+		glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(textureID));
+
+		if (filter != this->filter) {
+			GLint glFilter = (filter == TextureFilter::Bilinear) ? GL_LINEAR : GL_NEAREST;
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, glFilter);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, glFilter);
+			this->filter = filter;
+		}
+	}
+
+	/// <summary>
+	/// Unset render target (following draws go to the window)
+	/// </summary>
+	void RenderTarget::Unset() {
+		if (active) {
+			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			active = nullptr;
+		}
+	}
+
+	/// <summary>
+	/// Delete render thread framebuffers of destroyed render targets
+	/// </summary>
+	void RenderTarget::DeleteOrphans() {
+		std::lock_guard<std::mutex> lock(orphanMutex);
+		for (Ptr orphan : orphans) {
+			GLuint fbo = static_cast<GLuint>(orphan);
+			glDeleteFramebuffers(1, &fbo);
+		}
+		orphans.clear();
+	}
+
+}
@@ -0,0 +1,99 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+namespace Violet {
+	// Screen shader vertex shader code
+	static const char* vertexCode =
+		"#version 330 core\n"
+		"layout (location = 0) in vec2 inPos;\n"
+		"layout (location = 1) in vec2 texCoord;\n"
+		"out vec2 fragTexCoord;\n"
+		"void main()\n"
+		"{\n"
+		"	gl_Position = vec4(inPos.x, inPos.y, 0.0, 1.0);\n"
+		"	fragTexCoord = texCoord;\n"
+		"}";
+
+	// Copy fragment shader code
+	static const char* copyCode =
+		"#version 330 core\n"
+		"uniform sampler2D source;\n"
+		"in vec2 fragTexCoord;\n"
+		"out vec4 outColor;\n"
+		"void main()\n"
+		"{\n"
+		"	outColor = texture(source, fragTexCoord);\n"
+		"}";
+
+	// Sharp bilinear fragment shader code (each source pixel is a flat square, with a bilinear blend
+	// one output pixel wide along its edges, so non-integer scales don't leave uneven pixels)
+	static const char* sharpBilinearCode =
+		"#version 330 core\n"
+		"uniform sampler2D source;\n"
+		"uniform vec2 sourceSize;\n"
+		"uniform vec2 outputSize;\n"
+		"in vec2 fragTexCoord;\n"
+		"out vec4 outColor;\n"
+		"void main()\n"
+		"{\n"
+		"	vec2 scale = outputSize / sourceSize;\n"
+		"	vec2 texel = fragTexCoord * sourceSize;\n"
+		"	vec2 texelFloor = floor(texel);\n"
+		"	vec2 centerDist = (texel - texelFloor) - 0.5;\n"
+		"	vec2 region = max(0.5 - (0.5 / scale), 0.0);\n"
+		"	vec2 offset = ((centerDist - clamp(centerDist, -region, region)) * scale) + 0.5;\n"
+		"	outColor = texture(source, (texelFloor + offset) / sourceSize);\n"
+		"}";
+
+	/// <summary>
+	/// Draw a render target's image
+	/// </summary>
+	/// <param name="source">Render target to draw</param>
+	/// <param name="filter">Texture filter</param>
+	/// <param name="area">Area of the current target to draw over (in pixels)</param>
+	void ScreenShader::DrawScreen(RenderTarget& source, const TextureFilter filter, const Rect<int> area) {
+		Size2D<int> sourceSize = source.GetSize();
+
+		SetActive();
+		SetVec2(sourceSizeVar, { static_cast<float>(sourceSize.w), static_cast<float>(sourceSize.h) });
+		SetVec2(outputSizeVar, { static_cast<float>(area.w), static_cast<float>(area.h) });
+		source.BindTexture(filter, 0);
+
+		// The source replaces what's under it, as its alpha isn't meaningful after sprites were blended into it
+		glViewport(area.x, area.y, area.w, area.h);
+		glDisable(GL_BLEND);
+		vertexBuffer->SetActive();
+		vertexBuffer->Draw(6);
+		glEnable(GL_BLEND);
+		++Graphics::drawFrame->stats.drawCalls;
+	}
+
+	/// <summary>
+	/// Get screen shader vertex shader code
+	/// </summary>
+	/// <returns>Screen shader vertex shader code</returns>
+	const char* ScreenShader::GetVertexShader() {
+		return vertexCode;
+	}
+
+	/// <summary>
+	/// Get copy fragment shader code (draws the source as is)
+	/// </summary>
+	/// <returns>Copy fragment shader code</returns>
+	const char* ScreenShader::GetCopyShader() {
+		return copyCode;
+	}
+
+	/// <summary>
+	/// Get sharp bilinear fragment shader code (scales the source with sharp pixels, blending only along their edges)
+	/// </summary>
+	/// <returns>Sharp bilinear fragment shader code</returns>
+	const char* ScreenShader::GetSharpBilinearShader() {
+		return sharpBilinearCode;
+	}
+
+}
@@ -33,13 +33,22 @@ namespace Violet {
 	}
 
 	/// <summary>
-	/// Shader constructor
+	/// Create a shader program (from the cache if possible)
 	/// </summary>
-	/// <param name="vertexSize">Size of vertex</param>
-	/// <param name="vertexCount">Vertex count</param>
 	/// <param name="vertexCode">Vertex shader code</param>
 	/// <param name="fragCode">Fragment shader code</param>
-	Shader::Shader(const int vertexSize, const int vertexCount, std::string vertexCode, std::string fragCode) {
+	/// <param name="cached">Loaded from the cache flag</param>
+	/// <param name="cacheKey">Cache key</param>
+	/// <returns>Program ID</returns>
+	Ptr Shader::CreateProgram(const std::string& vertexCode, const std::string& fragCode, bool& cached, U64& cacheKey) {
+		/* Try the cache first */
+		cacheKey = ShaderCache::GetKey(vertexCode, fragCode);
+		GLuint program = static_cast<GLuint>(ShaderCache::LoadProgram(cacheKey));
+		cached = program != 0;
+		if (cached) {
+			return static_cast<Ptr>(program);
+		}
+
 		/* Compile shaders */
 		GLuint vertexShader = 0;
 		GLuint fragShader = 0;
@@ -47,18 +56,27 @@ namespace Violet {
 			vertexShader = CompileShader(vertexCode.c_str(), GL_VERTEX_SHADER);
 		}
 		if (fragCode.length() > 0) {
-			fragShader = CompileShader(fragCode.c_str(), GL_FRAGMENT_SHADER);
+			try {
+				fragShader = CompileShader(fragCode.c_str(), GL_FRAGMENT_SHADER);
+			}
+			catch (...) {
+				if (vertexShader) {
+					glDeleteShader(vertexShader);
+				}
+				throw;
+			}
 		}
 
 		/* Link shaders */
 		int success;
-		GLuint program = glCreateProgram();
+		program = glCreateProgram();
 		if (vertexShader) {
 			glAttachShader(program, vertexShader);
 		}
 		if (fragShader) {
 			glAttachShader(program, fragShader);
 		}
+		ShaderCache::PrepareProgram(static_cast<Ptr>(program));
 		glLinkProgram(program);
 
 		/* Clean up */
@@ -74,19 +92,34 @@ namespace Violet {
 		if (!success) {
 			glGetProgramInfoLog(program, 512, NULL, infoLog);
 			glDeleteProgram(program);
-			program = 0;
 			Engine::Error("Failed to link shaders: " + std::string(infoLog));
 		}
 
-		/* Finish setup */
-		id = static_cast<Ptr>(program);
+		ShaderCache::SaveProgram(static_cast<Ptr>(program), cacheKey);
+		return static_cast<Ptr>(program);
+	}
+
+	/// <summary>
+	/// Shader constructor
+	/// </summary>
+	/// <param name="vertexSize">Size of vertex</param>
+	/// <param name="vertexCount">Vertex count</param>
+	/// <param name="vertexCode">Vertex shader code</param>
+	/// <param name="fragCode">Fragment shader code</param>
+	Shader::Shader(const int vertexSize, const int vertexCount, std::string vertexCode, std::string fragCode) {
+		double startTick = Engine::GetTicks();
+
+		bool cached;
+		id = CreateProgram(vertexCode, fragCode, cached, cacheKey);
 		vertexBuffer = std::shared_ptr<VertexBuffer>(new VertexBuffer(vertexSize, vertexCount));
+		ShaderCache::AddShader(Engine::GetTicks() - startTick, cached);
 	}
 
 	/// <summary>
 	/// Shader destructor
 	/// </summary>
 	Shader::~Shader() {
+		Graphics::ForgetShaderVars(this);
 		if (active == this) {
 			Unset();
 		}
@@ -112,651 +145,268 @@ namespace Violet {
 	}
 
 	/// <summary>
-	/// Add variable
-	/// </summary>
-	/// <param name="name">Variable name</param>
-	void Shader::AddVariable(std::string name) {
-		if (variables.find(name) == variables.end()) {
-			variables[name] = glGetUniformLocation(static_cast<GLuint>(id), name.c_str());
-		}
-	}
-
-	/// <summary>
-	/// Get shader array data
-	/// </summary>
-	/// <param name="list">Data to get</param>
-	/// <returns>Retrieved array data</returns>
-	template<typename T>
-	inline T* GetShaderArrayData(std::initializer_list<T> list) {
-		T* valArray = new T[list.size()];
-		for (int i = 0; i < list.size(); ++i) {
-			valArray[i] = *(list.begin() + i);
-		}
-		return valArray;
-	}
-
-	/// <summary>
-	/// Set float
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="val">Value to set</param>
-	void Shader::SetFloat(std::string name, float val) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniform1f(variables[name], val);
-		}
-	}
-
-	/// <summary>
-	/// Set signed integer
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="val">Value to set</param>
-	void Shader::SetInt(std::string name, S32 val) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniform1i(variables[name], val);
-		}
-	}
-
-	/// <summary>
-	/// Set unsigned integer
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="val">Value to set</param>
-	void Shader::SetUInt(std::string name, U32 val) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniform1ui(variables[name], val);
-		}
-	}
-
-	/// <summary>
-	/// Set floats
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="val">Values to set</param>
-	void Shader::SetFloats(std::string name, std::initializer_list<float> val) {
-		if (variables.find(name) != variables.end()) {
-			float* valArray = GetShaderArrayData<float>(val);
-			SetActive();
-			glUniform1fv(variables[name], static_cast<GLsizei>(val.size()), (GLfloat*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set signed integers
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="val">Values to set</param>
-	void Shader::SetInts(std::string name, std::initializer_list<S32> val) {
-		if (variables.find(name) != variables.end()) {
-			S32* valArray = GetShaderArrayData<S32>(val);
-			SetActive();
-			glUniform1iv(variables[name], static_cast<GLsizei>(val.size()), (GLint*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set unsigned integers
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="val">Values to set</param>
-	void Shader::SetUInts(std::string name, std::initializer_list<U32> val) {
-		if (variables.find(name) != variables.end()) {
-			U32* valArray = GetShaderArrayData<U32>(val);
-			SetActive();
-			glUniform1uiv(variables[name], static_cast<GLsizei>(val.size()), (GLuint*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set 1-dimensional vector
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vector to set</param>
-	void Shader::SetVec1(std::string name, Vec1D<float> vec) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniform1f(variables[name], vec.x);
-		}
-	}
-
-	/// <summary>
-	/// Set 2-dimensional vector
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vector to set</param>
-	void Shader::SetVec2(std::string name, Vec2D<float> vec) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniform2f(variables[name], vec.x, vec.y);
-		}
-	}
-
-	/// <summary>
-	/// Set 3-dimensional vector
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vector to set</param>
-	void Shader::SetVec3(std::string name, Vec3D<float> vec) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniform3f(variables[name], vec.x, vec.y, vec.z);
-		}
-	}
-
-	/// <summary>
-	/// Set 4-dimensional vector
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vector to set</param>
-	void Shader::SetVec4(std::string name, Vec4D<float> vec) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniform4f(variables[name], vec.x, vec.y, vec.z, vec.w);
-		}
-	}
-
-	/// <summary>
-	/// Set 1-dimensional signed integer vector
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vector to set</param>
-	void Shader::SetIntVec1(std::string name, Vec1D<S32> vec) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniform1i(variables[name], vec.x);
-		}
-	}
-
-	/// <summary>
-	/// Set 2-dimensional signed integer vector
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vector to set</param>
-	void Shader::SetIntVec2(std::string name, Vec2D<S32> vec) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniform2i(variables[name], vec.x, vec.y);
-		}
-	}
-
-	/// <summary>
-	/// Set 3-dimensional signed integer vector
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vector to set</param>
-	void Shader::SetIntVec3(std::string name, Vec3D<S32> vec) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniform3i(variables[name], vec.x, vec.y, vec.z);
-		}
-	}
-
-	/// <summary>
-	/// Set 4-dimensional signed integer vector
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vector to set</param>
-	void Shader::SetIntVec4(std::string name, Vec4D<S32> vec) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniform4i(variables[name], vec.x, vec.y, vec.z, vec.w);
-		}
-	}
-
-	/// <summary>
-	/// Set 1-dimensional unsigned integer vector
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vector to set</param>
-	void Shader::SetUIntVec1(std::string name, Vec1D<U32> vec) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniform1ui(variables[name], vec.x);
-		}
-	}
-
-	/// <summary>
-	/// Set 2-dimensional unsigned integer vector
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vector to set</param>
-	void Shader::SetUIntVec2(std::string name, Vec2D<U32> vec) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniform2ui(variables[name], vec.x, vec.y);
-		}
-	}
-
-	/// <summary>
-	/// Set 3-dimensional unsigned integer vector
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vector to set</param>
-	void Shader::SetUIntVec3(std::string name, Vec3D<U32> vec) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniform3ui(variables[name], vec.x, vec.y, vec.z);
-		}
-	}
-
-	/// <summary>
-	/// Set 4-dimensional unsigned integer vector
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vector to set</param>
-	void Shader::SetUIntVec4(std::string name, Vec4D<U32> vec) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniform4ui(variables[name], vec.x, vec.y, vec.z, vec.w);
-		}
-	}
-
-	/// <summary>
-	/// Set 1-dimensional vectors
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vectors to set</param>
-	void Shader::SetVec1s(std::string name, std::initializer_list<Vec1D<float>> vec) {
-		if (variables.find(name) != variables.end()) {
-			Vec1D<float>* valArray = GetShaderArrayData<Vec1D<float>>(vec);
-			SetActive();
-			glUniform1fv(variables[name], static_cast<GLsizei>(vec.size()), (GLfloat*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set 2-dimensional vectors
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vectors to set</param>
-	void Shader::SetVec2s(std::string name, std::initializer_list<Vec2D<float>> vec) {
-		if (variables.find(name) != variables.end()) {
-			Vec2D<float>* valArray = GetShaderArrayData<Vec2D<float>>(vec);
-			SetActive();
-			glUniform2fv(variables[name], static_cast<GLsizei>(vec.size()), (GLfloat*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set 3-dimensional vectors
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vectors to set</param>
-	void Shader::SetVec3s(std::string name, std::initializer_list<Vec3D<float>> vec) {
-		if (variables.find(name) != variables.end()) {
-			Vec3D<float>* valArray = GetShaderArrayData<Vec3D<float>>(vec);
-			SetActive();
-			glUniform3fv(variables[name], static_cast<GLsizei>(vec.size()), (GLfloat*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set 4-dimensional vectors
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vectors to set</param>
-	void Shader::SetVec4s(std::string name, std::initializer_list<Vec4D<float>> vec) {
-		if (variables.find(name) != variables.end()) {
-			Vec4D<float>* valArray = GetShaderArrayData<Vec4D<float>>(vec);
-			SetActive();
-			glUniform4fv(variables[name], static_cast<GLsizei>(vec.size()), (GLfloat*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set 1-dimensional signed integer vectors
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vectors to set</param>
-	void Shader::SetIntVec1s(std::string name, std::initializer_list<Vec1D<S32>> vec) {
-		if (variables.find(name) != variables.end()) {
-			Vec1D<S32>* valArray = GetShaderArrayData<Vec1D<S32>>(vec);
-			SetActive();
-			glUniform1iv(variables[name], static_cast<GLsizei>(vec.size()), (GLint*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set 2-dimensional signed integer vectors
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vectors to set</param>
-	void Shader::SetIntVec2s(std::string name, std::initializer_list<Vec2D<S32>> vec) {
-		if (variables.find(name) != variables.end()) {
-			Vec2D<S32>* valArray = GetShaderArrayData<Vec2D<S32>>(vec);
-			SetActive();
-			glUniform2iv(variables[name], static_cast<GLsizei>(vec.size()), (GLint*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set 3-dimensional signed integer vectors
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vectors to set</param>
-	void Shader::SetIntVec3s(std::string name, std::initializer_list<Vec3D<S32>> vec) {
-		if (variables.find(name) != variables.end()) {
-			Vec3D<S32>* valArray = GetShaderArrayData<Vec3D<S32>>(vec);
-			SetActive();
-			glUniform3iv(variables[name], static_cast<GLsizei>(vec.size()), (GLint*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set 4-dimensional signed integer vectors
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vectors to set</param>
-	void Shader::SetIntVec4s(std::string name, std::initializer_list<Vec4D<S32>> vec) {
-		if (variables.find(name) != variables.end()) {
-			Vec4D<S32>* valArray = GetShaderArrayData<Vec4D<S32>>(vec);
-			SetActive();
-			glUniform4iv(variables[name], static_cast<GLsizei>(vec.size()), (GLint*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set 1-dimensional unsigned integer vectors
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vectors to set</param>
-	void Shader::SetUIntVec1s(std::string name, std::initializer_list<Vec1D<U32>> vec) {
-		if (variables.find(name) != variables.end()) {
-			Vec1D<U32>* valArray = GetShaderArrayData<Vec1D<U32>>(vec);
-			SetActive();
-			glUniform1uiv(variables[name], static_cast<GLsizei>(vec.size()), (GLuint*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set 2-dimensional unsigned integer vectors
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vectors to set</param>
-	void Shader::SetUIntVec2s(std::string name, std::initializer_list<Vec2D<U32>> vec) {
-		if (variables.find(name) != variables.end()) {
-			Vec2D<U32>* valArray = GetShaderArrayData<Vec2D<U32>>(vec);
-			SetActive();
-			glUniform2uiv(variables[name], static_cast<GLsizei>(vec.size()), (GLuint*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set 3-dimensional unsigned integer vectors
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vectors to set</param>
-	void Shader::SetUIntVec3s(std::string name, std::initializer_list<Vec3D<U32>> vec) {
-		if (variables.find(name) != variables.end()) {
-			Vec3D<U32>* valArray = GetShaderArrayData<Vec3D<U32>>(vec);
-			SetActive();
-			glUniform3uiv(variables[name], static_cast<GLsizei>(vec.size()), (GLuint*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set 4-dimensional unsigned integer vectors
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="vec">Vectors to set</param>
-	void Shader::SetUIntVec4s(std::string name, std::initializer_list<Vec4D<U32>> vec) {
-		if (variables.find(name) != variables.end()) {
-			Vec4D<U32>* valArray = GetShaderArrayData<Vec4D<U32>>(vec);
-			SetActive();
-			glUniform4uiv(variables[name], static_cast<GLsizei>(vec.size()), (GLuint*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set 2x2 matrix
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrix to set</param>
-	void Shader::SetMatrix2x2(std::string name, Matrix2x2<float> mat) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniformMatrix2fv(variables[name], 1, false, (GLfloat*)(&mat));
-		}
-	}
-
-	/// <summary>
-	/// Set 3x3 matrix
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrix to set</param>
-	void Shader::SetMatrix3x3(std::string name, Matrix3x3<float> mat) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniformMatrix3fv(variables[name], 1, false, (GLfloat*)(&mat));
-		}
-	}
-
-	/// <summary>
-	/// Set 4x4 matrix
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrix to set</param>
-	void Shader::SetMatrix4x4(std::string name, Matrix4x4<float> mat) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniformMatrix4fv(variables[name], 1, false, (GLfloat*)(&mat));
-		}
-	}
-
-	/// <summary>
-	/// Set 2x3 matrix
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrix to set</param>
-	void Shader::SetMatrix2x3(std::string name, Matrix2x3<float> mat) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniformMatrix2x3fv(variables[name], 1, false, (GLfloat*)(&mat));
-		}
-	}
-
-	/// <summary>
-	/// Set 3x2 matrix
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrix to set</param>
-	void Shader::SetMatrix3x2(std::string name, Matrix3x2<float> mat) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniformMatrix3x2fv(variables[name], 1, false, (GLfloat*)(&mat));
-		}
-	}
-
-	/// <summary>
-	/// Set 2x4 matrix
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrix to set</param>
-	void Shader::SetMatrix2x4(std::string name, Matrix2x4<float> mat) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniformMatrix2x4fv(variables[name], 1, false, (GLfloat*)(&mat));
-		}
-	}
-
-	/// <summary>
-	/// Set 4x2 matrix
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrix to set</param>
-	void Shader::SetMatrix4x2(std::string name, Matrix4x2<float> mat) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniformMatrix4x2fv(variables[name], 1, false, (GLfloat*)(&mat));
-		}
-	}
-
-	/// <summary>
-	/// Set 3x4 matrix
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrix to set</param>
-	void Shader::SetMatrix3x4(std::string name, Matrix3x4<float> mat) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniformMatrix3x4fv(variables[name], 1, false, (GLfloat*)(&mat));
-		}
-	}
-
-	/// <summary>
-	/// Set 4x3 matrix
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrix to set</param>
-	void Shader::SetMatrix4x3(std::string name, Matrix4x3<float> mat) {
-		if (variables.find(name) != variables.end()) {
-			SetActive();
-			glUniformMatrix4x3fv(variables[name], 1, false, (GLfloat*)(&mat));
-		}
-	}
-
-	/// <summary>
-	/// Set 2x2 matrices
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrices to set</param>
-	void Shader::SetMatrices2x2(std::string name, std::initializer_list<Matrix2x2<float>> mat) {
-		if (variables.find(name) != variables.end()) {
-			Matrix2x2<float>* valArray = GetShaderArrayData<Matrix2x2<float>>(mat);
-			SetActive();
-			glUniformMatrix2fv(variables[name], static_cast<GLsizei>(mat.size()), false, (GLfloat*)(valArray));
-			delete[] valArray;
-		}
-	}
-
-	/// <summary>
-	/// Set 3x3 matrices
+	/// Rebuild the shader from new code (variables, uniform blocks and the values set to them are kept,
+	/// and the current program is kept if the new one fails to build)
 	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrices to set</param>
-	void Shader::SetMatrices3x3(std::string name, std::initializer_list<Matrix3x3<float>> mat) {
-		if (variables.find(name) != variables.end()) {
-			Matrix3x3<float>* valArray = GetShaderArrayData<Matrix3x3<float>>(mat);
-			SetActive();
-			glUniformMatrix3fv(variables[name], static_cast<GLsizei>(mat.size()), false, (GLfloat*)(valArray));
-			delete[] valArray;
+	/// <param name="vertexCode">Vertex shader code</param>
+	/// <param name="fragCode">Fragment shader code</param>
+	/// <returns>True if rebuilt, false if not</returns>
+	bool Shader::Reload(std::string vertexCode, std::string fragCode) {
+		GLuint program;
+		U64 newCacheKey;
+		try {
+			bool cached;
+			program = static_cast<GLuint>(CreateProgram(vertexCode, fragCode, cached, newCacheKey));
 		}
-	}
-
-	/// <summary>
-	/// Set 4x4 matrices
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrices to set</param>
-	void Shader::SetMatrices4x4(std::string name, std::initializer_list<Matrix4x4<float>> mat) {
-		if (variables.find(name) != variables.end()) {
-			Matrix4x4<float>* valArray = GetShaderArrayData<Matrix4x4<float>>(mat);
-			SetActive();
-			glUniformMatrix4fv(variables[name], static_cast<GLsizei>(mat.size()), false, (GLfloat*)(valArray));
-			delete[] valArray;
+		catch (const std::exception& e) {
+			Engine::DebugMessage("SHADER RELOAD FAIL:  " + std::string(e.what()));
+			return false;
 		}
-	}
 
-	/// <summary>
-	/// Set 2x3 matrices
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrices to set</param>
-	void Shader::SetMatrices2x3(std::string name, std::initializer_list<Matrix2x3<float>> mat) {
-		if (variables.find(name) != variables.end()) {
-			Matrix2x3<float>* valArray = GetShaderArrayData<Matrix2x3<float>>(mat);
-			SetActive();
-			glUniformMatrix2x3fv(variables[name], static_cast<GLsizei>(mat.size()), false, (GLfloat*)(valArray));
-			delete[] valArray;
+		if (active == this) {
+			Unset();
 		}
-	}
+		glDeleteProgram(static_cast<GLuint>(id));
+		id = static_cast<Ptr>(program);
 
-	/// <summary>
-	/// Set 3x2 matrices
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrices to set</param>
-	void Shader::SetMatrices3x2(std::string name, std::initializer_list<Matrix3x2<float>> mat) {
-		if (variables.find(name) != variables.end()) {
-			Matrix3x2<float>* valArray = GetShaderArrayData<Matrix3x2<float>>(mat);
-			SetActive();
-			glUniformMatrix3x2fv(variables[name], static_cast<GLsizei>(mat.size()), false, (GLfloat*)(valArray));
-			delete[] valArray;
+		// Drop the replaced program from the cache, so that it doesn't grow with every edit
+		if (newCacheKey != cacheKey) {
+			ShaderCache::RemoveProgram(cacheKey);
+			cacheKey = newCacheKey;
+		}
+
+		for (const std::pair<const std::string, int>& block : uniformBlocks) {
+			GLuint index = glGetUniformBlockIndex(program, block.first.c_str());
+			if (index != GL_INVALID_INDEX) {
+				glUniformBlockBinding(program, index, static_cast<GLuint>(block.second));
+			}
+		}
+		RestoreVariables();
+		return true;
+	}
+
+	/// <summary>
+	/// Look up variables in the current program again and set their last values to it
+	/// </summary>
+	void Shader::RestoreVariables() {
+		GLuint program = static_cast<GLuint>(id);
+		SetActive();
+
+		for (const std::pair<const std::string, int>& variableID : variableIDs) {
+			Variable& variable = variables[variableID.second];
+			variable.location = glGetUniformLocation(program, variableID.first.c_str());
+			if (variable.location < 0 || !variable.set) {
+				continue;
+			}
+
+			// The shadow copy doesn't know which setter made it, so go by the variable's type in the new program
+			const char* name = variableID.first.c_str();
+			GLuint index;
+			GLint type = 0;
+			glGetUniformIndices(program, 1, &name, &index);
+			if (index != GL_INVALID_INDEX) {
+				glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_TYPE, &type);
+			}
+
+			ShaderVarType varType;
+			switch (type) {
+			case GL_FLOAT:
+				varType = ShaderVarType::Float;
+				break;
+			case GL_FLOAT_VEC2:
+				varType = ShaderVarType::Vec2;
+				break;
+			case GL_FLOAT_VEC3:
+				varType = ShaderVarType::Vec3;
+				break;
+			case GL_FLOAT_VEC4:
+				varType = ShaderVarType::Vec4;
+				break;
+			case GL_INT:
+			case GL_BOOL:
+			case GL_SAMPLER_1D:
+			case GL_SAMPLER_2D:
+			case GL_SAMPLER_3D:
+			case GL_SAMPLER_CUBE:
+			case GL_SAMPLER_2D_ARRAY:
+			case GL_SAMPLER_BUFFER:
+				varType = ShaderVarType::Int;
+				break;
+			case GL_INT_VEC2:
+			case GL_BOOL_VEC2:
+				varType = ShaderVarType::IntVec2;
+				break;
+			case GL_INT_VEC3:
+			case GL_BOOL_VEC3:
+				varType = ShaderVarType::IntVec3;
+				break;
+			case GL_INT_VEC4:
+			case GL_BOOL_VEC4:
+				varType = ShaderVarType::IntVec4;
+				break;
+			case GL_UNSIGNED_INT:
+				varType = ShaderVarType::UInt;
+				break;
+			case GL_UNSIGNED_INT_VEC2:
+				varType = ShaderVarType::UIntVec2;
+				break;
+			case GL_UNSIGNED_INT_VEC3:
+				varType = ShaderVarType::UIntVec3;
+				break;
+			case GL_UNSIGNED_INT_VEC4:
+				varType = ShaderVarType::UIntVec4;
+				break;
+			case GL_FLOAT_MAT2:
+				varType = ShaderVarType::Matrix2x2;
+				break;
+			case GL_FLOAT_MAT3:
+				varType = ShaderVarType::Matrix3x3;
+				break;
+			case GL_FLOAT_MAT4:
+				varType = ShaderVarType::Matrix4x4;
+				break;
+			case GL_FLOAT_MAT2x3:
+				varType = ShaderVarType::Matrix2x3;
+				break;
+			case GL_FLOAT_MAT3x2:
+				varType = ShaderVarType::Matrix3x2;
+				break;
+			case GL_FLOAT_MAT2x4:
+				varType = ShaderVarType::Matrix2x4;
+				break;
+			case GL_FLOAT_MAT4x2:
+				varType = ShaderVarType::Matrix4x2;
+				break;
+			case GL_FLOAT_MAT3x4:
+				varType = ShaderVarType::Matrix3x4;
+				break;
+			case GL_FLOAT_MAT4x3:
+				varType = ShaderVarType::Matrix4x3;
+				break;
+			default:
+				// Unknown type, so it has to be set again by the application
+				variable.set = false;
+				continue;
+			}
+			UploadVariable(variable.location, varType, variable.shadow.data(), variable.shadow.size());
+		}
+	}
+
+	/// <summary>
+	/// Upload a variable's value to the active program
+	/// </summary>
+	/// <param name="location">Variable location</param>
+	/// <param name="type">Variable type</param>
+	/// <param name="data">Value to set</param>
+	/// <param name="size">Value size</param>
+	void Shader::UploadVariable(const int location, const ShaderVarType type, const void* data, const size_t size) {
+		GLsizei bytes = static_cast<GLsizei>(size);
+		switch (type) {
+		case ShaderVarType::Float:
+			glUniform1fv(location, bytes / (sizeof(GLfloat) * 1), (const GLfloat*)data);
+			break;
+		case ShaderVarType::Vec2:
+			glUniform2fv(location, bytes / (sizeof(GLfloat) * 2), (const GLfloat*)data);
+			break;
+		case ShaderVarType::Vec3:
+			glUniform3fv(location, bytes / (sizeof(GLfloat) * 3), (const GLfloat*)data);
+			break;
+		case ShaderVarType::Vec4:
+			glUniform4fv(location, bytes / (sizeof(GLfloat) * 4), (const GLfloat*)data);
+			break;
+		case ShaderVarType::Int:
+			glUniform1iv(location, bytes / (sizeof(GLint) * 1), (const GLint*)data);
+			break;
+		case ShaderVarType::IntVec2:
+			glUniform2iv(location, bytes / (sizeof(GLint) * 2), (const GLint*)data);
+			break;
+		case ShaderVarType::IntVec3:
+			glUniform3iv(location, bytes / (sizeof(GLint) * 3), (const GLint*)data);
+			break;
+		case ShaderVarType::IntVec4:
+			glUniform4iv(location, bytes / (sizeof(GLint) * 4), (const GLint*)data);
+			break;
+		case ShaderVarType::UInt:
+			glUniform1uiv(location, bytes / (sizeof(GLuint) * 1), (const GLuint*)data);
+			break;
+		case ShaderVarType::UIntVec2:
+			glUniform2uiv(location, bytes / (sizeof(GLuint) * 2), (const GLuint*)data);
+			break;
+		case ShaderVarType::UIntVec3:
+			glUniform3uiv(location, bytes / (sizeof(GLuint) * 3), (const GLuint*)data);
+			break;
+		case ShaderVarType::UIntVec4:
+			glUniform4uiv(location, bytes / (sizeof(GLuint) * 4), (const GLuint*)data);
+			break;
+		case ShaderVarType::Matrix2x2:
+			glUniformMatrix2fv(location, bytes / (sizeof(GLfloat) * 4), false, (const GLfloat*)data);
+			break;
+		case ShaderVarType::Matrix3x3:
+			glUniformMatrix3fv(location, bytes / (sizeof(GLfloat) * 9), false, (const GLfloat*)data);
+			break;
+		case ShaderVarType::Matrix4x4:
+			glUniformMatrix4fv(location, bytes / (sizeof(GLfloat) * 16), false, (const GLfloat*)data);
+			break;
+		case ShaderVarType::Matrix2x3:
+			glUniformMatrix2x3fv(location, bytes / (sizeof(GLfloat) * 6), false, (const GLfloat*)data);
+			break;
+		case ShaderVarType::Matrix3x2:
+			glUniformMatrix3x2fv(location, bytes / (sizeof(GLfloat) * 6), false, (const GLfloat*)data);
+			break;
+		case ShaderVarType::Matrix2x4:
+			glUniformMatrix2x4fv(location, bytes / (sizeof(GLfloat) * 8), false, (const GLfloat*)data);
+			break;
+		case ShaderVarType::Matrix4x2:
+			glUniformMatrix4x2fv(location, bytes / (sizeof(GLfloat) * 8), false, (const GLfloat*)data);
+			break;
+		case ShaderVarType::Matrix3x4:
+			glUniformMatrix3x4fv(location, bytes / (sizeof(GLfloat) * 12), false, (const GLfloat*)data);
+			break;
+		case ShaderVarType::Matrix4x3:
+			glUniformMatrix4x3fv(location, bytes / (sizeof(GLfloat) * 12), false, (const GLfloat*)data);
+			break;
 		}
 	}
 
 	/// <summary>
-	/// Set 2x4 matrices
+	/// Add variable
 	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrices to set</param>
-	void Shader::SetMatrices2x4(std::string name, std::initializer_list<Matrix2x4<float>> mat) {
-		if (variables.find(name) != variables.end()) {
-			Matrix2x4<float>* valArray = GetShaderArrayData<Matrix2x4<float>>(mat);
-			SetActive();
-			glUniformMatrix2x4fv(variables[name], static_cast<GLsizei>(mat.size()), false, (GLfloat*)(valArray));
-			delete[] valArray;
-		}
-	}
+	/// <param name="name">Variable name</param>
+	/// <returns>Variable handle</returns>
+	ShaderVar Shader::AddVariable(const std::string& name) {
+		ShaderVar var = GetVariable(name);
+		if (!var.IsValid()) {
+			GLuint program = static_cast<GLuint>(id);
+			var.index = static_cast<int>(variables.size());
+			variables.push_back({ glGetUniformLocation(program, name.c_str()) });
+			variableIDs[name] = var.index;
 
-	/// <summary>
-	/// Set 4x2 matrices
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrices to set</param>
-	void Shader::SetMatrices4x2(std::string name, std::initializer_list<Matrix4x2<float>> mat) {
-		if (variables.find(name) != variables.end()) {
-			Matrix4x2<float>* valArray = GetShaderArrayData<Matrix4x2<float>>(mat);
-			SetActive();
-			glUniformMatrix4x2fv(variables[name], static_cast<GLsizei>(mat.size()), false, (GLfloat*)(valArray));
-			delete[] valArray;
+			// Reserve room for the largest value (a 4x4 matrix per array element) so setting it never allocates
+			const char* uniformName = name.c_str();
+			GLuint index;
+			GLint count = 1;
+			glGetUniformIndices(program, 1, &uniformName, &index);
+			if (index != GL_INVALID_INDEX) {
+				glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_SIZE, &count);
+			}
+			variables.back().shadow.reserve(sizeof(GLfloat) * 16 * static_cast<size_t>((count > 1) ? count : 1));
 		}
+		return var;
 	}
 
 	/// <summary>
-	/// Set 3x4 matrices
+	/// Bind a uniform block to a uniform buffer binding point
 	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrices to set</param>
-	void Shader::SetMatrices3x4(std::string name, std::initializer_list<Matrix3x4<float>> mat) {
-		if (variables.find(name) != variables.end()) {
-			Matrix3x4<float>* valArray = GetShaderArrayData<Matrix3x4<float>>(mat);
-			SetActive();
-			glUniformMatrix3x4fv(variables[name], static_cast<GLsizei>(mat.size()), false, (GLfloat*)(valArray));
-			delete[] valArray;
-		}
-	}
+	/// <param name="name">Uniform block name</param>
+	/// <param name="binding">Binding point</param>
+	void Shader::AddUniformBlock(const std::string& name, const int binding) {
+		uniformBlocks[name] = binding;
 
-	/// <summary>
-	/// Set 4x3 matrices
-	/// </summary>
-	/// <param name="name">Name of variable</param>
-	/// <param name="mat">Matrices to set</param>
-	void Shader::SetMatrices4x3(std::string name, std::initializer_list<Matrix4x3<float>> mat) {
-		if (variables.find(name) != variables.end()) {
-			Matrix4x3<float>* valArray = GetShaderArrayData<Matrix4x3<float>>(mat);
-			SetActive();
-			glUniformMatrix4x3fv(variables[name], static_cast<GLsizei>(mat.size()), false, (GLfloat*)(valArray));
-			delete[] valArray;
+		GLuint index = glGetUniformBlockIndex(static_cast<GLuint>(id), name.c_str());
+		if (index == GL_INVALID_INDEX) {
+			Engine::Error("Uniform block \"" + name + "\" not found in shader.");
 		}
+		glUniformBlockBinding(static_cast<GLuint>(id), index, static_cast<GLuint>(binding));
 	}
 
 	/// <summary>
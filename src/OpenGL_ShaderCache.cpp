@@ -0,0 +1,171 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+// Program binaries are core in OpenGL 4.1 (or ARB_get_program_binary), which is newer than what the loader targets
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#endif
+#ifndef GL_PROGRAM_BINARY_LENGTH
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#endif
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#endif
+
+namespace Violet {
+
+	/// <summary>
+	/// glGetProgramBinary function type
+	/// </summary>
+	typedef void (APIENTRY* GetProgramBinaryFunc)(GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, void* binary);
+
+	/// <summary>
+	/// glProgramBinary function type
+	/// </summary>
+	typedef void (APIENTRY* ProgramBinaryFunc)(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length);
+
+	/// <summary>
+	/// glProgramParameteri function type
+	/// </summary>
+	typedef void (APIENTRY* ProgramParameteriFunc)(GLuint program, GLenum pname, GLint value);
+
+	/// <summary>
+	/// glGetProgramBinary function
+	/// </summary>
+	static GetProgramBinaryFunc getProgramBinary{ nullptr };
+
+	/// <summary>
+	/// glProgramBinary function
+	/// </summary>
+	static ProgramBinaryFunc programBinary{ nullptr };
+
+	/// <summary>
+	/// glProgramParameteri function
+	/// </summary>
+	static ProgramParameteriFunc programParameteri{ nullptr };
+
+	/// <summary>
+	/// Check if the graphics API can provide program binaries (and set up the functions for them)
+	/// </summary>
+	/// <returns>True if supported, false if not</returns>
+	bool ShaderCache::CheckSupport() {
+		GLint major = 0;
+		GLint minor = 0;
+		glGetIntegerv(GL_MAJOR_VERSION, &major);
+		glGetIntegerv(GL_MINOR_VERSION, &minor);
+
+		bool available = major > 4 || (major == 4 && minor >= 1);
+		if (!available) {
+			GLint extensionCount = 0;
+			glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+			for (GLint i = 0; i < extensionCount && !available; ++i) {
+				const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+				available = extension && strcmp(extension, "GL_ARB_get_program_binary") == 0;
+			}
+		}
+		if (!available) {
+			return false;
+		}
+
+		getProgramBinary = reinterpret_cast<GetProgramBinaryFunc>(Shell::GetProcAddress("glGetProgramBinary"));
+		programBinary = reinterpret_cast<ProgramBinaryFunc>(Shell::GetProcAddress("glProgramBinary"));
+		programParameteri = reinterpret_cast<ProgramParameteriFunc>(Shell::GetProcAddress("glProgramParameteri"));
+		if (!getProgramBinary || !programBinary || !programParameteri) {
+			return false;
+		}
+
+		// Some drivers support the functions, but don't have any formats to save in
+		GLint formatCount = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+		return formatCount > 0;
+	}
+
+	/// <summary>
+	/// Get a string identifying the graphics driver
+	/// </summary>
+	/// <returns>Driver string</returns>
+	std::string ShaderCache::GetDriverID() {
+		std::string id;
+		for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+			const char* str = reinterpret_cast<const char*>(glGetString(name));
+			id += std::string(str ? str : "") + "\n";
+		}
+		return id;
+	}
+
+	/// <summary>
+	/// Create a program from the cache
+	/// </summary>
+	/// <param name="key">Cache key</param>
+	/// <returns>Program ID (0 if not cached, or the driver rejected the binary)</returns>
+	Ptr ShaderCache::LoadProgram(const U64 key) {
+		if (!supported) {
+			return 0;
+		}
+
+		std::unordered_map<U64, Entry>::iterator found = entries.find(key);
+		if (found == entries.end()) {
+			return 0;
+		}
+
+		GLuint program = glCreateProgram();
+		programBinary(program, static_cast<GLenum>(found->second.format), found->second.binary.data(),
+			static_cast<GLsizei>(found->second.binary.size()));
+
+		int success;
+		glGetProgramiv(program, GL_LINK_STATUS, &success);
+		if (!success) {
+			// Drivers can reject binaries after an update without changing their version string
+			glDeleteProgram(program);
+			entries.erase(found);
+			dirty = true;
+			return 0;
+		}
+		return static_cast<Ptr>(program);
+	}
+
+	/// <summary>
+	/// Prepare a program for being cached (must be done before linking)
+	/// </summary>
+	/// <param name="program">Program ID</param>
+	void ShaderCache::PrepareProgram(const Ptr program) {
+		if (supported) {
+			programParameteri(static_cast<GLuint>(program), GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		}
+	}
+
+	/// <summary>
+	/// Add a linked program to the cache
+	/// </summary>
+	/// <param name="program">Program ID</param>
+	/// <param name="key">Cache key</param>
+	void ShaderCache::SaveProgram(const Ptr program, const U64 key) {
+		if (!supported) {
+			return;
+		}
+
+		GLint length = 0;
+		glGetProgramiv(static_cast<GLuint>(program), GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length <= 0) {
+			return;
+		}
+
+		Entry entry;
+		GLenum format = 0;
+		entry.binary.resize(length);
+		getProgramBinary(static_cast<GLuint>(program), length, &length, &format, entry.binary.data());
+		if (length <= 0) {
+			return;
+		}
+		entry.binary.resize(length);
+		entry.format = static_cast<U32>(format);
+
+		entries[key] = std::move(entry);
+		dirty = true;
+	}
+
+}
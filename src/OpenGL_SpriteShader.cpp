@@ -12,12 +12,16 @@ namespace Violet {
 		"layout (location = 0) in vec2 inPos;\n"
 		"layout (location = 1) in vec4 inColor;\n"
 		"layout (location = 2) in vec2 texCoord;\n"
-		"uniform mat4 projection;\n"
+		"layout (location = 3) in float inDepth;\n"
+		"layout (std140) uniform FrameData {\n"
+		"	mat4 projection;\n"
+		"	mat4 view;\n"
+		"};\n"
 		"out vec4 fragColor;\n"
 		"out vec2 fragTexCoord;\n"
 		"void main()\n"
 		"{\n"
-		"   gl_Position = projection * vec4(inPos.x, inPos.y, 0.0, 1.0);\n"
+		"   gl_Position = projection * view * vec4(inPos.x, inPos.y, inDepth, 1.0);\n"
 		"	fragColor = inColor;\n"
 		"	fragTexCoord = texCoord;\n"
 		"}";
@@ -26,27 +30,73 @@ namespace Violet {
 	static const char* fragCode =
 		"#version 330 core\n"
 		"uniform sampler2D texture0;\n"
+		"uniform float alphaCutoff;\n"
 		"in vec4 fragColor;\n"
 		"in vec2 fragTexCoord;\n"
 		"out vec4 outColor;\n"
 		"void main()\n"
 		"{\n"
 		"	outColor = texture(texture0, fragTexCoord) * fragColor;\n"
+		"	if (outColor.a <= alphaCutoff) {\n"
+		"		discard;\n"
+		"	}\n"
+		"}";
+
+	// Texture array sprite shader vertex shader code
+	static const char* arrayVertexCode =
+		"#version 330 core\n"
+		"layout (location = 0) in vec2 inPos;\n"
+		"layout (location = 1) in vec4 inColor;\n"
+		"layout (location = 2) in vec2 texCoord;\n"
+		"layout (location = 3) in float inDepth;\n"
+		"layout (location = 4) in float inArrayLayer;\n"
+		"layout (std140) uniform FrameData {\n"
+		"	mat4 projection;\n"
+		"	mat4 view;\n"
+		"};\n"
+		"out vec4 fragColor;\n"
+		"out vec2 fragTexCoord;\n"
+		"flat out float fragArrayLayer;\n"
+		"void main()\n"
+		"{\n"
+		"   gl_Position = projection * view * vec4(inPos.x, inPos.y, inDepth, 1.0);\n"
+		"	fragColor = inColor;\n"
+		"	fragTexCoord = texCoord;\n"
+		"	fragArrayLayer = inArrayLayer;\n"
+		"}";
+
+	// Texture array sprite shader fragment shader code
+	static const char* arrayFragCode =
+		"#version 330 core\n"
+		"uniform sampler2DArray texture0;\n"
+		"uniform float alphaCutoff;\n"
+		"in vec4 fragColor;\n"
+		"in vec2 fragTexCoord;\n"
+		"flat in float fragArrayLayer;\n"
+		"out vec4 outColor;\n"
+		"void main()\n"
+		"{\n"
+		"	outColor = texture(texture0, vec3(fragTexCoord, fragArrayLayer)) * fragColor;\n"
+		"	if (outColor.a <= alphaCutoff) {\n"
+		"		discard;\n"
+		"	}\n"
 		"}";
 
 	/// <summary>
 	/// Get sprite shader vertex shader code
 	/// </summary>
+	/// <param name="array">Texture array flag</param>
 	/// <returns>Sprite shader vertex shader code</returns>
-	const char* SpriteShader::GetVertexShader() {
-		return vertexCode;
+	const char* SpriteShader::GetVertexShader(const bool array) {
+		return array ? arrayVertexCode : vertexCode;
 	}
 
 	/// <summary>
 	/// Get sprite shader fragment shader code
 	/// </summary>
+	/// <param name="array">Texture array flag</param>
 	/// <returns>Sprite shader fragment shader code</returns>
-	const char* SpriteShader::GetFragmentShader() {
-		return fragCode;
+	const char* SpriteShader::GetFragmentShader(const bool array) {
+		return array ? arrayFragCode : fragCode;
 	}
 }
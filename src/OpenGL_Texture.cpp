@@ -12,9 +12,31 @@ namespace Violet {
 	/// </summary>
 	/// <param name="fileName">File name</param>
 	/// <param name="wrap">Wrap mode</param>
-	Texture::Texture(std::string fileName, TextureWrap wrap) {
-		this->fileName = fileName;
-		std::shared_ptr<Image> image = Engine::OpenImage(fileName);
+	Texture::Texture(std::string fileName, TextureWrap wrap) : Texture(Engine::OpenImage(fileName), wrap) {
+	}
+
+	/// <summary>
+	/// Texture constructor
+	/// </summary>
+	/// <param name="image">Image</param>
+	/// <param name="wrap">Wrap mode</param>
+	Texture::Texture(std::shared_ptr<Image> image, TextureWrap wrap) : Texture(std::vector<std::shared_ptr<Image>>{ image }, wrap, false) {
+	}
+
+	/// <summary>
+	/// Texture constructor
+	/// </summary>
+	/// <param name="images">Images (1 per layer, all the same size)</param>
+	/// <param name="wrap">Wrap mode</param>
+	/// <param name="array">Texture array flag</param>
+	Texture::Texture(const std::vector<std::shared_ptr<Image>>& images, TextureWrap wrap, const bool array) {
+		if (array) {
+			arrayLayers = static_cast<int>(images.size());
+		}
+		else {
+			this->fileName = images[0]->fileName;
+		}
+		GLenum target = array ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D;
 
 		GLuint ids[2];
 		glGenTextures(2, ids);
@@ -36,25 +58,82 @@ namespace Violet {
 		}
 
 		SetActive(TextureFilter::Bilinear);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, glWrap);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, glWrap);
+		glTexParameteri(target, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(target, GL_TEXTURE_WRAP_S, glWrap);
+		glTexParameteri(target, GL_TEXTURE_WRAP_T, glWrap);
+
+		SetActive(TextureFilter::Nearest);
+		glTexParameteri(target, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_LINEAR);
+		glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(target, GL_TEXTURE_WRAP_S, glWrap);
+		glTexParameteri(target, GL_TEXTURE_WRAP_T, glWrap);
+
+		if (array) {
+			UploadArray(images);
+			Engine::DebugMessage("TEXTURE ARRAY:       " + std::to_string(arrayLayers) + " layers");
+		}
+		else {
+			Upload(images[0]);
+			Engine::DebugMessage("IMAGE -> TEXTURE:    " + fileName);
+		}
+	}
+
+	/// <summary>
+	/// Replace the texture's image in place (the wrap mode is kept)
+	/// </summary>
+	/// <param name="image">Image</param>
+	void Texture::Reload(std::shared_ptr<Image> image) {
+		if (arrayLayers) {
+			Engine::Error("Texture arrays can't be reloaded from a single image.");
+		}
+		Upload(image);
+		Engine::DebugMessage("TEXTURE RELOAD:      " + fileName);
+	}
+
+	/// <summary>
+	/// Upload image to the texture
+	/// </summary>
+	/// <param name="image">Image</param>
+	void Texture::Upload(std::shared_ptr<Image> image) {
+		SetActive(TextureFilter::Bilinear);
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image->size.w, image->size.h, 0, GL_RGBA, GL_FLOAT, (const void*)(image->pixels));
 		glGenerateMipmap(GL_TEXTURE_2D);
 
 		SetActive(TextureFilter::Nearest);
-		glBindTexture(GL_TEXTURE_2D, ids[1]);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, glWrap);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, glWrap);
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image->size.w, image->size.h, 0, GL_RGBA, GL_FLOAT, (const void*)(image->pixels));
 		glGenerateMipmap(GL_TEXTURE_2D);
 
 		size = image->size;
+		translucent = HasTranslucentPixels(*image);
+	}
 
-		Engine::DebugMessage("IMAGE -> TEXTURE:    " + fileName);
+	/// <summary>
+	/// Upload images to the texture array's layers
+	/// </summary>
+	/// <param name="images">Images</param>
+	void Texture::UploadArray(const std::vector<std::shared_ptr<Image>>& images) {
+		Size2D<int> layerSize = images[0]->size;
+		int layers = static_cast<int>(images.size());
+		TextureFilter filters[2] = { TextureFilter::Bilinear, TextureFilter::Nearest };
+
+		for (TextureFilter filter : filters) {
+			SetActive(filter);
+			glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA, layerSize.w, layerSize.h, layers, 0, GL_RGBA, GL_FLOAT, nullptr);
+			for (int i = 0; i < layers; ++i) {
+				glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, i, layerSize.w, layerSize.h, 1, GL_RGBA, GL_FLOAT, (const void*)(images[i]->pixels));
+			}
+			glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+		}
+
+		size = layerSize;
+		translucent = false;
+		for (const std::shared_ptr<Image>& image : images) {
+			if (HasTranslucentPixels(*image)) {
+				translucent = true;
+				break;
+			}
+		}
 	}
 
 	/// <summary>
@@ -85,18 +164,26 @@ namespace Violet {
 	/// <param name="unit">Unit ID</param>
 	void Texture::SetActive(TextureFilter filter, int unit) {
 		if (active[unit].texture != this || active[unit].filter != filter) {
+			// Each target has its own binding in a unit, so the other one is cleared to not leave a texture behind
+			bool array = arrayLayers != 0;
+			if (active[unit].texture && active[unit].array != array) {
+				Unset(unit);
+			}
+
 			glActiveTexture(GL_TEXTURE0 + unit);
+			GLenum target = array ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D;
 			switch (filter) {
 			case TextureFilter::Bilinear:
-				glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(idBilinear));
+				glBindTexture(target, static_cast<GLuint>(idBilinear));
 				break;
 			case TextureFilter::Nearest:
-				glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(idNearest));
+				glBindTexture(target, static_cast<GLuint>(idNearest));
 				break;
 			}
 
 			active[unit].texture = this;
 			active[unit].filter = filter;
+			active[unit].array = array;
 		}
 	}
 
@@ -107,7 +194,7 @@ namespace Violet {
 	void Texture::Unset(int unit) {
 		if (active[unit].texture) {
 			glActiveTexture(GL_TEXTURE0 + unit);
-			glBindTexture(GL_TEXTURE_2D, 0);
+			glBindTexture(active[unit].array ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D, 0);
 			active[unit].texture = nullptr;
 		}
 	}
@@ -128,7 +215,53 @@ namespace Violet {
 	/// <param name="wrap">Wrap mode</param>
 	/// <returns>Opened texture</returns>
 	std::shared_ptr<Texture> Engine::OpenTexture(std::string fileName, TextureWrap wrap) {
+		AllocScope allocScope(AllocTag::Asset);
 		return std::shared_ptr<Texture>(new Texture(fileName, wrap));
 	}
 
+	/// <summary>
+	/// Create texture from an image
+	/// </summary>
+	/// <param name="image">Image</param>
+	/// <param name="wrap">Wrap mode</param>
+	/// <returns>Created texture</returns>
+	std::shared_ptr<Texture> Engine::CreateTexture(std::shared_ptr<Image> image, TextureWrap wrap) {
+		AllocScope allocScope(AllocTag::Asset);
+		return std::shared_ptr<Texture>(new Texture(image, wrap));
+	}
+
+	/// <summary>
+	/// Open texture array
+	/// </summary>
+	/// <param name="fileNames">File names (1 per layer, all the same size)</param>
+	/// <param name="wrap">Wrap mode</param>
+	/// <returns>Opened texture array</returns>
+	std::shared_ptr<Texture> Engine::OpenTextureArray(std::vector<std::string> fileNames, TextureWrap wrap) {
+		AllocScope allocScope(AllocTag::Asset);
+		std::vector<std::shared_ptr<Image>> images;
+		for (const std::string& fileName : fileNames) {
+			images.push_back(Engine::OpenImage(fileName));
+		}
+		return CreateTextureArray(images, wrap);
+	}
+
+	/// <summary>
+	/// Create texture array from images
+	/// </summary>
+	/// <param name="images">Images (1 per layer, all the same size)</param>
+	/// <param name="wrap">Wrap mode</param>
+	/// <returns>Created texture array</returns>
+	std::shared_ptr<Texture> Engine::CreateTextureArray(std::vector<std::shared_ptr<Image>> images, TextureWrap wrap) {
+		AllocScope allocScope(AllocTag::Asset);
+		if (images.empty()) {
+			Engine::Error("A texture array needs at least 1 image.");
+		}
+		for (const std::shared_ptr<Image>& image : images) {
+			if (image->size.w != images[0]->size.w || image->size.h != images[0]->size.h) {
+				Engine::Error("Texture array images must all be the same size (\"" + image->fileName + "\" doesn't match).");
+			}
+		}
+		return std::shared_ptr<Texture>(new Texture(images, wrap, true));
+	}
+
 }
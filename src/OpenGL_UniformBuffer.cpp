@@ -0,0 +1,60 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+namespace Violet {
+
+	/// <summary>
+	/// Uniform buffer constructor
+	/// </summary>
+	/// <param name="size">Size</param>
+	/// <param name="binding">Binding point</param>
+	UniformBuffer::UniformBuffer(const int size, const int binding) : binding(binding), data(size, 0) {
+		GLuint id;
+		glGenBuffers(1, &id);
+		this->id = static_cast<Ptr>(id);
+
+		glBindBuffer(GL_UNIFORM_BUFFER, id);
+		glBufferData(GL_UNIFORM_BUFFER, size, data.data(), GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+
+	/// <summary>
+	/// Uniform buffer destructor
+	/// </summary>
+	UniformBuffer::~UniformBuffer() {
+		GLuint id = static_cast<GLuint>(this->id);
+		glDeleteBuffers(1, &id);
+	}
+
+	/// <summary>
+	/// Set active (uploads changed data and binds the buffer to its binding point)
+	/// </summary>
+	void UniformBuffer::SetActive() {
+		GLuint id = static_cast<GLuint>(this->id);
+		if (dirtyEnd > dirtyStart) {
+			glBindBuffer(GL_UNIFORM_BUFFER, id);
+			glBufferSubData(GL_UNIFORM_BUFFER, dirtyStart, dirtyEnd - dirtyStart, data.data() + dirtyStart);
+			dirtyStart = 0;
+			dirtyEnd = 0;
+		}
+		glBindBufferBase(GL_UNIFORM_BUFFER, static_cast<GLuint>(binding), id);
+	}
+
+	/// <summary>
+	/// Create uniform buffer
+	/// </summary>
+	/// <param name="size">Size</param>
+	/// <param name="binding">Binding point</param>
+	/// <returns>Created uniform buffer</returns>
+	std::shared_ptr<UniformBuffer> Engine::CreateUniformBuffer(const int size, const int binding) {
+		if (size <= 0) {
+			Engine::Error("Invalid uniform buffer size \"" + std::to_string(size) + "\".");
+		}
+		return std::shared_ptr<UniformBuffer>(new UniformBuffer(size, binding));
+	}
+
+}
@@ -41,6 +41,12 @@ namespace Violet {
 		glDeleteVertexArrays(1, &id);
 		glDeleteBuffers(1, &dataID);
 
+		// The render thread vertex array can only be deleted by the render thread
+		if (renderID) {
+			std::lock_guard<std::mutex> lock(orphanMutex);
+			orphans.push_back(renderID);
+		}
+
 		if (data) {
 			free(data);
 		}
@@ -51,7 +57,21 @@ namespace Violet {
 	/// </summary>
 	void VertexBuffer::SetActive() {
 		if (active != this) {
-			glBindVertexArray(static_cast<GLuint>(id));
+			if (Graphics::IsRenderThread()) {
+				// Vertex arrays aren't shared, so the render thread needs its own
+				if (!renderID) {
+					GLuint vao;
+					glGenVertexArrays(1, &vao);
+					glBindVertexArray(vao);
+					glBindBuffer(GL_ARRAY_BUFFER, static_cast<GLuint>(dataID));
+					renderID = static_cast<Ptr>(vao);
+					SetupAttributes();
+				}
+				glBindVertexArray(static_cast<GLuint>(renderID));
+			}
+			else {
+				glBindVertexArray(static_cast<GLuint>(id));
+			}
 			active = this;
 		}
 	}
@@ -62,27 +82,39 @@ namespace Violet {
 	/// <param name="type">Attribute type</param>
 	/// <param name="size">Attribute size</param>
 	void VertexBuffer::AddAttribute(AttribType type, int size) {
-		GLenum type_gl = 0;
-		int type_size = 0;
-
 		if (size == 0) {
 			Engine::Error("Vertex buffer attribute size cannot be 0.");
 		}
-
-		switch (type) {
-		case AttribType::Float:
-			type_gl = GL_FLOAT;
-			type_size = sizeof(float);
-			break;
-		}
-		if (type_gl == 0) {
+		if (type != AttribType::Float) {
 			Engine::Error("Invalid vertex buffer attribute type.");
 		}
 
+		attributes.push_back({ type, size });
 		SetActive();
-		glVertexAttribPointer(attribCount, size, type_gl, GL_FALSE, vertexSize, (void*)attribPtr);
-		glEnableVertexAttribArray(attribCount++);
-		attribPtr += static_cast<Ptr>(size) * type_size;
+		glBindBuffer(GL_ARRAY_BUFFER, static_cast<GLuint>(dataID));
+		SetupAttributes();
+	}
+
+	/// <summary>
+	/// Set up attribute pointers for the currently bound vertex array
+	/// </summary>
+	void VertexBuffer::SetupAttributes() {
+		Ptr attribPtr = 0;
+		for (int i = 0; i < static_cast<int>(attributes.size()); ++i) {
+			GLenum type_gl = 0;
+			int type_size = 0;
+
+			switch (attributes[i].type) {
+			case AttribType::Float:
+				type_gl = GL_FLOAT;
+				type_size = sizeof(float);
+				break;
+			}
+
+			glVertexAttribPointer(i, attributes[i].size, type_gl, GL_FALSE, vertexSize, (void*)attribPtr);
+			glEnableVertexAttribArray(i);
+			attribPtr += static_cast<Ptr>(attributes[i].size) * type_size;
+		}
 	}
 
 	/// <summary>
@@ -127,4 +159,16 @@ namespace Violet {
 		active = nullptr;
 	}
 
+	/// <summary>
+	/// Delete render thread vertex arrays of destroyed vertex buffers
+	/// </summary>
+	void VertexBuffer::DeleteOrphans() {
+		std::lock_guard<std::mutex> lock(orphanMutex);
+		for (Ptr orphan : orphans) {
+			GLuint vao = static_cast<GLuint>(orphan);
+			glDeleteVertexArrays(1, &vao);
+		}
+		orphans.clear();
+	}
+
 }
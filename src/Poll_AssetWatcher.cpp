@@ -0,0 +1,99 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+#ifndef __linux__
+
+#include <sys/stat.h>
+
+namespace Violet {
+
+	/// <summary>
+	/// Time between file checks (in milliseconds)
+	/// </summary>
+	constexpr double PollInterval = 500;
+
+	/// <summary>
+	/// Watched files' last modification times
+	/// </summary>
+	static std::unordered_map<std::string, time_t> watchFiles;
+
+	/// <summary>
+	/// Time of the last file check
+	/// </summary>
+	static double lastPollTick{ 0 };
+
+	/// <summary>
+	/// Get a file's last modification time
+	/// </summary>
+	/// <param name="fileName">File name</param>
+	/// <returns>Modification time (0 if the file can't be found)</returns>
+	static time_t GetModifyTime(const std::string& fileName) {
+		struct stat info;
+		if (stat(fileName.c_str(), &info) != 0) {
+			return 0;
+		}
+		return info.st_mtime;
+	}
+
+	/// <summary>
+	/// Start watching for file changes
+	/// </summary>
+	void AssetWatcher::StartWatching() {
+		lastPollTick = Engine::GetTicks();
+	}
+
+	/// <summary>
+	/// Watch a file for changes
+	/// </summary>
+	/// <param name="fileName">File name</param>
+	void AssetWatcher::AddFile(const std::string& fileName) {
+		time_t modifyTime = GetModifyTime(fileName);
+		if (modifyTime == 0) {
+			Engine::Error("Failed to find \"" + fileName + "\" to watch.");
+		}
+		watchFiles[fileName] = modifyTime;
+	}
+
+	/// <summary>
+	/// Stop watching a file
+	/// </summary>
+	/// <param name="fileName">File name (as it was added)</param>
+	void AssetWatcher::RemoveFile(const std::string& fileName) {
+		watchFiles.erase(fileName);
+	}
+
+	/// <summary>
+	/// Get files that changed since the last check (never blocks)
+	/// </summary>
+	/// <param name="changed">List to add the changed file names to (as they were added)</param>
+	void AssetWatcher::GetChanges(std::vector<std::string>& changed) {
+		// There's no change notification here, so check the modification times every so often
+		double tick = Engine::GetTicks();
+		if (tick - lastPollTick < PollInterval) {
+			return;
+		}
+		lastPollTick = tick;
+
+		for (std::pair<const std::string, time_t>& file : watchFiles) {
+			time_t modifyTime = GetModifyTime(file.first);
+			if (modifyTime != 0 && modifyTime != file.second) {
+				file.second = modifyTime;
+				changed.push_back(file.first);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Stop watching for file changes
+	/// </summary>
+	void AssetWatcher::StopWatching() {
+		watchFiles.clear();
+	}
+
+}
+
+#endif // __linux__
@@ -0,0 +1,49 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+namespace Violet {
+
+	/// <summary>
+	/// Post processing shader constructor
+	/// </summary>
+	/// <param name="fragCode">Fragment shader code</param>
+	PostShader::PostShader(std::string fragCode) : ScreenShader(fragCode) {
+	}
+
+	/// <summary>
+	/// Set enabled flag (disabled passes are left out of the chain entirely)
+	/// </summary>
+	/// <param name="enable">Enable flag</param>
+	void PostShader::SetEnabled(const bool enable) {
+		enabled = enable;
+	}
+
+	/// <summary>
+	/// Check if enabled
+	/// </summary>
+	/// <returns>True if enabled, false if not</returns>
+	bool PostShader::IsEnabled() const {
+		return enabled;
+	}
+
+	/// <summary>
+	/// Set the filter used to read the previous pass
+	/// </summary>
+	/// <param name="filter">Texture filter</param>
+	void PostShader::SetFilter(const TextureFilter filter) {
+		this->filter = filter;
+	}
+
+	/// <summary>
+	/// Get the filter used to read the previous pass
+	/// </summary>
+	/// <returns>Texture filter</returns>
+	TextureFilter PostShader::GetFilter() const {
+		return filter;
+	}
+
+}
@@ -0,0 +1,60 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#ifndef VIOLET_POST_SHADER_HPP
+#define VIOLET_POST_SHADER_HPP
+
+namespace Violet {
+
+	/// <summary>
+	/// Post processing shader (full screen pass run over the low resolution layers before they're scaled up)
+	/// </summary>
+	class PostShader : public ScreenShader {
+	public:
+		/// <summary>
+		/// Post processing shader constructor
+		/// </summary>
+		/// <param name="fragCode">Fragment shader code</param>
+		PostShader(std::string fragCode);
+
+		/// <summary>
+		/// Set enabled flag (disabled passes are left out of the chain entirely)
+		/// </summary>
+		/// <param name="enable">Enable flag</param>
+		void SetEnabled(const bool enable);
+
+		/// <summary>
+		/// Check if enabled
+		/// </summary>
+		/// <returns>True if enabled, false if not</returns>
+		bool IsEnabled() const;
+
+		/// <summary>
+		/// Set the filter used to read the previous pass
+		/// </summary>
+		/// <param name="filter">Texture filter</param>
+		void SetFilter(const TextureFilter filter);
+
+		/// <summary>
+		/// Get the filter used to read the previous pass
+		/// </summary>
+		/// <returns>Texture filter</returns>
+		TextureFilter GetFilter() const;
+
+	private:
+		/// <summary>
+		/// Enabled flag
+		/// </summary>
+		bool enabled{ true };
+
+		/// <summary>
+		/// Texture filter
+		/// </summary>
+		TextureFilter filter{ TextureFilter::Nearest };
+	};
+
+}
+
+#endif // VIOLET_POST_SHADER_HPP
@@ -0,0 +1,46 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+namespace Violet {
+
+	/// <summary>
+	/// Active render target (per thread, as each thread has its own context)
+	/// </summary>
+	thread_local RenderTarget* RenderTarget::active{ nullptr };
+
+	/// <summary>
+	/// Render thread framebuffers left to delete
+	/// </summary>
+	std::vector<Ptr> RenderTarget::orphans;
+
+	/// <summary>
+	/// Orphaned framebuffer mutex
+	/// </summary>
+	std::mutex RenderTarget::orphanMutex;
+
+	/// <summary>
+	/// Get size
+	/// </summary>
+	/// <returns>Size</returns>
+	Size2D<int> RenderTarget::GetSize() const {
+		return size;
+	}
+
+	/// <summary>
+	/// Create render target
+	/// </summary>
+	/// <param name="size">Size</param>
+	/// <param name="depth">Depth buffer flag</param>
+	/// <returns>Created render target</returns>
+	std::shared_ptr<RenderTarget> Engine::CreateRenderTarget(const Size2D<int> size, const bool depth) {
+		if (size.w <= 0 || size.h <= 0) {
+			Engine::Error("Invalid render target size \"" + std::to_string(size.w) + "x" + std::to_string(size.h) + "\".");
+		}
+		return std::shared_ptr<RenderTarget>(new RenderTarget(size, depth));
+	}
+
+}
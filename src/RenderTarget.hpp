@@ -0,0 +1,115 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#ifndef VIOLET_RENDER_TARGET_HPP
+#define VIOLET_RENDER_TARGET_HPP
+
+namespace Violet {
+
+	/// <summary>
+	/// Render target (offscreen image that can be drawn into, and then drawn from)
+	/// </summary>
+	class RenderTarget {
+	public:
+		// Friend classes
+		friend class Engine;
+		friend class Graphics;
+
+		/// <summary>
+		/// Render target destructor
+		/// </summary>
+		~RenderTarget();
+
+		/// <summary>
+		/// Get size
+		/// </summary>
+		/// <returns>Size</returns>
+		Size2D<int> GetSize() const;
+
+		/// <summary>
+		/// Resize (the contents are lost if the size changes)
+		/// </summary>
+		/// <param name="size">Size</param>
+		void Resize(const Size2D<int> size);
+
+		/// <summary>
+		/// Set active (following draws go into the render target, over its whole area)
+		/// </summary>
+		void SetActive();
+
+		/// <summary>
+		/// Bind the render target's image to a texture unit
+		/// </summary>
+		/// <param name="filter">Texture filter</param>
+		/// <param name="unit">Unit ID</param>
+		void BindTexture(const TextureFilter filter, const int unit = 0);
+
+		/// <summary>
+		/// Unset render target (following draws go to the window)
+		/// </summary>
+		static void Unset();
+
+	private:
+		/// <summary>
+		/// Render target constructor
+		/// </summary>
+		/// <param name="size">Size</param>
+		/// <param name="depth">Depth buffer flag</param>
+		RenderTarget(const Size2D<int> size, const bool depth);
+
+		/// <summary>
+		/// Delete render thread framebuffers of destroyed render targets
+		/// </summary>
+		static void DeleteOrphans();
+
+		/// <summary>
+		/// Framebuffer ID
+		/// </summary>
+		Ptr id{ 0 };
+
+		/// <summary>
+		/// Render thread framebuffer ID (framebuffers aren't shared between contexts)
+		/// </summary>
+		Ptr renderID{ 0 };
+
+		/// <summary>
+		/// Texture ID
+		/// </summary>
+		Ptr textureID{ 0 };
+
+		/// <summary>
+		/// Depth buffer ID (0 if there is none)
+		/// </summary>
+		Ptr depthID{ 0 };
+
+		/// <summary>
+		/// Size
+		/// </summary>
+		Size2D<int> size;
+
+		/// <summary>
+		/// Texture filter
+		/// </summary>
+		TextureFilter filter{ TextureFilter::Nearest };
+
+		/// <summary>
+		/// Active render target (per thread, as each thread has its own context)
+		/// </summary>
+		static thread_local RenderTarget* active;
+
+		/// <summary>
+		/// Render thread framebuffers left to delete
+		/// </summary>
+		static std::vector<Ptr> orphans;
+
+		/// <summary>
+		/// Orphaned framebuffer mutex
+		/// </summary>
+		static std::mutex orphanMutex;
+	};
+
+}
+
+#endif // VIOLET_RENDER_TARGET_HPP
@@ -0,0 +1,204 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define VIOLET_RESAMPLER_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace Violet {
+
+	/// <summary>
+	/// Resampler constructor
+	/// </summary>
+	/// <param name="inRate">Input sample rate</param>
+	/// <param name="outRate">Output sample rate</param>
+	/// <param name="maxPush">Maximum number of frames pushed at once</param>
+	Resampler::Resampler(const int inRate, const int outRate, const int maxPush) {
+		step = static_cast<double>(inRate) / outRate;
+
+		// Room for a full push on top of what's left after a pull, plus the silence added by Flush
+		capacity = maxPush + (ResamplerTaps * 2) + ResamplerHalfTaps + static_cast<int>(step) + 1;
+		historyL.resize(capacity * 2);
+		historyR.resize(capacity * 2);
+
+		// Cut off just below the lower of the 2 Nyquist frequencies
+		double cutoff = 0.5 * Math::Min(1.0, static_cast<double>(outRate) / inRate) * 0.97;
+
+		coefs.resize((ResamplerPhases + 1) * ResamplerTaps);
+		for (int p = 0; p <= ResamplerPhases; ++p) {
+			float* row = &coefs[p * ResamplerTaps];
+			double sum = 0;
+
+			for (int t = 0; t < ResamplerTaps; ++t) {
+				double x = (t - ResamplerHalfTaps + 1) - static_cast<double>(p) / ResamplerPhases;
+				double sinc = 2 * cutoff;
+				if (x != 0) {
+					sinc = Math::Sin(2 * Pi * cutoff * x) / (Pi * x);
+				}
+
+				// Blackman window
+				double n = x / ResamplerHalfTaps;
+				double window = 0;
+				if (n > -1 && n < 1) {
+					window = 0.42 + 0.5 * Math::Cos(Pi * n) + 0.08 * Math::Cos(2 * Pi * n);
+				}
+
+				row[t] = static_cast<float>(sinc * window);
+				sum += row[t];
+			}
+
+			// Normalize for unity gain
+			for (int t = 0; t < ResamplerTaps; ++t) {
+				row[t] = static_cast<float>(row[t] / sum);
+			}
+		}
+
+		Reset();
+	}
+
+	/// <summary>
+	/// Get the number of input frames needed to produce a number of output frames
+	/// </summary>
+	/// <param name="outFrames">Number of output frames</param>
+	/// <returns>Number of input frames needed</returns>
+	int Resampler::GetFramesNeeded(const int outFrames) const {
+		if (outFrames <= 0) {
+			return 0;
+		}
+		int last = static_cast<int>(pos + (outFrames - 1) * step);
+		return Math::Max(0, last + ResamplerHalfTaps + 1 - count);
+	}
+
+	/// <summary>
+	/// Get the number of input frames that can be pushed before the history is full
+	/// </summary>
+	/// <returns>Number of free frames</returns>
+	int Resampler::GetFramesFree() const {
+		// Keep room for Flush
+		return Math::Max(0, capacity - ResamplerHalfTaps - count);
+	}
+
+	/// <summary>
+	/// Push input frames
+	/// </summary>
+	/// <param name="in">Interleaved stereo input frames</param>
+	/// <param name="frames">Number of frames</param>
+	void Resampler::Push(const float* const in, const int frames) {
+		int pushed = Math::Min(frames, capacity - count);
+		for (int i = 0; i < pushed; ++i) {
+			Append(in[i * 2], in[i * 2 + 1]);
+		}
+	}
+
+	/// <summary>
+	/// Push silence to flush out the remaining input
+	/// </summary>
+	void Resampler::Flush() {
+		int pushed = Math::Min(ResamplerHalfTaps, capacity - count);
+		for (int i = 0; i < pushed; ++i) {
+			Append(0, 0);
+		}
+	}
+
+	/// <summary>
+	/// Add a frame to the end of the history
+	/// </summary>
+	/// <param name="l">Left sample</param>
+	/// <param name="r">Right sample</param>
+	void Resampler::Append(const float l, const float r) {
+		int index = (start + count) % capacity;
+		historyL[index] = l;
+		historyL[index + capacity] = l;
+		historyR[index] = r;
+		historyR[index + capacity] = r;
+		++count;
+	}
+
+	/// <summary>
+	/// Pull output frames
+	/// </summary>
+	/// <param name="out">Interleaved stereo output frames</param>
+	/// <param name="frames">Maximum number of frames</param>
+	/// <returns>Number of frames pulled</returns>
+	int Resampler::Pull(float* const out, const int frames) {
+		int pulled = 0;
+
+		while (pulled < frames) {
+			int index = static_cast<int>(pos);
+			if (index + ResamplerHalfTaps >= count) {
+				break;
+			}
+
+			// Get the 2 nearest filter phases and how far between them we are
+			double phase = (pos - index) * ResamplerPhases;
+			int phaseIndex = static_cast<int>(phase);
+			float frac = static_cast<float>(phase - phaseIndex);
+
+			const float* c0 = &coefs[phaseIndex * ResamplerTaps];
+			const float* c1 = c0 + ResamplerTaps;
+			int tap = (start + index - ResamplerHalfTaps + 1) % capacity;
+			const float* l = &historyL[tap];
+			const float* r = &historyR[tap];
+
+#ifdef VIOLET_RESAMPLER_SSE
+			__m128 fracVec = _mm_set1_ps(frac);
+			__m128 accL = _mm_setzero_ps();
+			__m128 accR = _mm_setzero_ps();
+			for (int t = 0; t < ResamplerTaps; t += 4) {
+				__m128 a = _mm_loadu_ps(c0 + t);
+				__m128 c = _mm_add_ps(a, _mm_mul_ps(fracVec, _mm_sub_ps(_mm_loadu_ps(c1 + t), a)));
+				accL = _mm_add_ps(accL, _mm_mul_ps(c, _mm_loadu_ps(l + t)));
+				accR = _mm_add_ps(accR, _mm_mul_ps(c, _mm_loadu_ps(r + t)));
+			}
+
+			float sumL[4];
+			float sumR[4];
+			_mm_storeu_ps(sumL, accL);
+			_mm_storeu_ps(sumR, accR);
+			out[pulled * 2] = (sumL[0] + sumL[1]) + (sumL[2] + sumL[3]);
+			out[pulled * 2 + 1] = (sumR[0] + sumR[1]) + (sumR[2] + sumR[3]);
+#else
+			float accL = 0;
+			float accR = 0;
+			for (int t = 0; t < ResamplerTaps; ++t) {
+				float c = c0[t] + frac * (c1[t] - c0[t]);
+				accL += c * l[t];
+				accR += c * r[t];
+			}
+			out[pulled * 2] = accL;
+			out[pulled * 2 + 1] = accR;
+#endif
+
+			pos += step;
+			++pulled;
+		}
+
+		// Drop history that is no longer needed
+		int discard = Math::Min(static_cast<int>(pos) - ResamplerHalfTaps + 1, count);
+		if (discard > 0) {
+			start = (start + discard) % capacity;
+			count -= discard;
+			pos -= discard;
+		}
+
+		return pulled;
+	}
+
+	/// <summary>
+	/// Reset resampler state
+	/// </summary>
+	void Resampler::Reset() {
+		// Start with enough silence for the first frame to be centered in the filter
+		std::fill(historyL.begin(), historyL.end(), 0.0f);
+		std::fill(historyR.begin(), historyR.end(), 0.0f);
+		start = 0;
+		count = ResamplerHalfTaps - 1;
+		pos = ResamplerHalfTaps - 1;
+	}
+
+}
@@ -0,0 +1,128 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#ifndef VIOLET_RESAMPLER_HPP
+#define VIOLET_RESAMPLER_HPP
+
+namespace Violet {
+
+	/// <summary>
+	/// Resampler half tap count
+	/// </summary>
+	constexpr int ResamplerHalfTaps = 16;
+
+	/// <summary>
+	/// Resampler tap count
+	/// </summary>
+	constexpr int ResamplerTaps = ResamplerHalfTaps * 2;
+
+	/// <summary>
+	/// Resampler phase count
+	/// </summary>
+	constexpr int ResamplerPhases = 128;
+
+	/// <summary>
+	/// Streaming stereo resampler (polyphase windowed sinc)
+	/// </summary>
+	class Resampler {
+	public:
+		/// <summary>
+		/// Resampler constructor
+		/// </summary>
+		/// <param name="inRate">Input sample rate</param>
+		/// <param name="outRate">Output sample rate</param>
+		/// <param name="maxPush">Maximum number of frames pushed at once</param>
+		Resampler(const int inRate, const int outRate, const int maxPush);
+
+		/// <summary>
+		/// Get the number of input frames needed to produce a number of output frames
+		/// </summary>
+		/// <param name="outFrames">Number of output frames</param>
+		/// <returns>Number of input frames needed</returns>
+		int GetFramesNeeded(const int outFrames) const;
+
+		/// <summary>
+		/// Get the number of input frames that can be pushed before the history is full
+		/// </summary>
+		/// <returns>Number of free frames</returns>
+		int GetFramesFree() const;
+
+		/// <summary>
+		/// Push input frames
+		/// </summary>
+		/// <param name="in">Interleaved stereo input frames</param>
+		/// <param name="frames">Number of frames</param>
+		void Push(const float* const in, const int frames);
+
+		/// <summary>
+		/// Push silence to flush out the remaining input
+		/// </summary>
+		void Flush();
+
+		/// <summary>
+		/// Pull output frames
+		/// </summary>
+		/// <param name="out">Interleaved stereo output frames</param>
+		/// <param name="frames">Maximum number of frames</param>
+		/// <returns>Number of frames pulled</returns>
+		int Pull(float* const out, const int frames);
+
+		/// <summary>
+		/// Reset resampler state
+		/// </summary>
+		void Reset();
+
+	private:
+		/// <summary>
+		/// Filter coefficients (one row of taps per phase, plus one extra row for interpolation)
+		/// </summary>
+		std::vector<float> coefs;
+
+		/// <summary>
+		/// Left channel history (ring buffer, stored twice so that the filter taps are always contiguous)
+		/// </summary>
+		std::vector<float> historyL;
+
+		/// <summary>
+		/// Right channel history (ring buffer, stored twice so that the filter taps are always contiguous)
+		/// </summary>
+		std::vector<float> historyR;
+
+		/// <summary>
+		/// History capacity
+		/// </summary>
+		int capacity{ 0 };
+
+		/// <summary>
+		/// Ring buffer index of the oldest frame in the history
+		/// </summary>
+		int start{ 0 };
+
+		/// <summary>
+		/// Number of frames in the history
+		/// </summary>
+		int count{ 0 };
+
+		/// <summary>
+		/// Current position in the history
+		/// </summary>
+		double pos{ 0 };
+
+		/// <summary>
+		/// Input frames per output frame
+		/// </summary>
+		double step{ 1 };
+
+		/// <summary>
+		/// Add a frame to the end of the history
+		/// </summary>
+		/// <param name="l">Left sample</param>
+		/// <param name="r">Right sample</param>
+		void Append(const float l, const float r);
+	};
+
+}
+
+#endif // VIOLET_RESAMPLER_HPP
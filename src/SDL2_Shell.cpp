@@ -5,6 +5,8 @@
 
 #include "Violet.hpp"
 
+#ifdef VIOLET_SHELL_SDL2
+
 namespace Violet {
 
 	/// <summary>
@@ -21,6 +23,20 @@ namespace Violet {
 	/// <returns>Display mode</returns>
 	static SDL_DisplayMode GetDisplayMode();
 
+	/// <summary>
+	/// Convert an event timestamp to a tick
+	/// </summary>
+	/// <param name="timestamp">Event timestamp</param>
+	/// <returns>Tick</returns>
+	static double GetEventTick(const Uint32 timestamp);
+
+	/// <summary>
+	/// Get the player that a controller is assigned to
+	/// </summary>
+	/// <param name="id">Joystick instance ID</param>
+	/// <returns>Player ID, or -1 if not assigned</returns>
+	static int GetControllerPlayer(const SDL_JoystickID id);
+
 	/// <summary>
 	/// Window
 	/// </summary>
@@ -31,6 +47,31 @@ namespace Violet {
 	/// </summary>
 	static SDL_GLContext context{ nullptr };
 
+	/// <summary>
+	/// Render thread OpenGL context (shares objects with the main context)
+	/// </summary>
+	static SDL_GLContext renderContext{ nullptr };
+
+	/// <summary>
+	/// Swap interval set for the calling thread's context
+	/// </summary>
+	static thread_local int swapInterval{ -1 };
+
+	/// <summary>
+	/// Controllers assigned to each player
+	/// </summary>
+	static SDL_GameController* controllers[MaxPlayers]{ nullptr };
+
+	/// <summary>
+	/// Quit requested flag
+	/// </summary>
+	static bool quitRequested{ false };
+
+	/// <summary>
+	/// Audio device
+	/// </summary>
+	static SDL_AudioDeviceID audioDevice{ 0 };
+
 	/// <summary>
 	/// Window size back up
 	/// </summary>
@@ -73,21 +114,47 @@ namespace Violet {
 			Engine::Error("Failed to set up OpenGL loader.");
 		}
 
-		// Initialize sound
-		SDL_AudioSpec audio_specs = {0};
-		audio_specs.freq = SoundSampleRate;
-		audio_specs.format = AUDIO_S16SYS;
-		audio_specs.channels = 2;
-		audio_specs.samples = SoundBufferLen / 4;
-		audio_specs.callback = SoundCallback;
-		audio_specs.userdata = UpdateSound;
-		if (SDL_OpenAudio(&audio_specs, nullptr) < 0) {
-			Engine::Error("Failed to initialize audio.");
+		// Create render thread context
+		if (Graphics::renderThreaded) {
+			SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
+			renderContext = SDL_GL_CreateContext(window);
+			if (!renderContext) {
+				Engine::Error("Failed to create render thread OpenGL context.");
+			}
+			if (SDL_GL_MakeCurrent(window, context) < 0) {
+				Engine::Error("Failed to set current OpenGL context.");
+			}
 		}
-		SDL_PauseAudio(0);
 
 		// Initialize ticks
 		tickFreq = SDL_GetPerformanceFrequency() / 1000.0;
+
+		// Initialize input (controllers get assigned as their device added events come in)
+		if (Input::GetBindings().empty()) {
+			Input::ResetBindings();
+		}
+
+		// Initialize sound
+		if (Sound::device == SoundDevice::Shell) {
+			SDL_AudioSpec audio_specs = {0};
+			SDL_AudioSpec obtained_specs = {0};
+			audio_specs.freq = Sound::GetSampleRate();
+			audio_specs.format = AUDIO_S16SYS;
+			audio_specs.channels = 2;
+			audio_specs.samples = SoundBufferLen / 4;
+			audio_specs.callback = SoundCallback;
+			audio_specs.userdata = reinterpret_cast<void*>(UpdateSound);
+
+			// Only let the device pick its own rate if no rate was requested
+			audioDevice = SDL_OpenAudioDevice(nullptr, 0, &audio_specs, &obtained_specs,
+				(Sound::sampleRate == 0) ? SDL_AUDIO_ALLOW_FREQUENCY_CHANGE : 0);
+			if (audioDevice == 0) {
+				Engine::Error("Failed to initialize audio.");
+			}
+			Sound::sampleRate = obtained_specs.freq;
+			Engine::DebugMessage("SOUND DEVICE:        " + std::to_string(obtained_specs.freq) + " Hz");
+			SDL_PauseAudioDevice(audioDevice, 0);
+		}
 	}
 
 	/// <summary>
@@ -95,28 +162,34 @@ namespace Violet {
 	/// </summary>
 	/// <returns>True if running, false if not</returns>
 	bool Shell::UpdateEvents() {
-		// Update keyboard input
-		const U8* keyboard = SDL_GetKeyboardState(nullptr);
-		Input::buttons[static_cast<int>(Button::Left)] = keyboard[SDL_SCANCODE_LEFT];
-		Input::buttons[static_cast<int>(Button::Right)] = keyboard[SDL_SCANCODE_RIGHT];
-		Input::buttons[static_cast<int>(Button::Up)] = keyboard[SDL_SCANCODE_UP];
-		Input::buttons[static_cast<int>(Button::Down)] = keyboard[SDL_SCANCODE_DOWN];
-
-		// Event
+		UpdateInput();
+		return !quitRequested;
+	}
+
+	/// <summary>
+	/// Sample input state
+	/// </summary>
+	void Shell::UpdateInput() {
 		SDL_Event ev;
 		while (SDL_PollEvent(&ev)) {
 			switch (ev.type) {
 			case SDL_QUIT:
-				return false;
+				quitRequested = true;
+				break;
 
 			case SDL_WINDOWEVENT:
 				// Window close
 				if (ev.window.event == SDL_WINDOWEVENT_CLOSE &&
 					ev.window.windowID == SDL_GetWindowID(window))
-					return false;
+					quitRequested = true;
 				break;
 
 			case SDL_KEYDOWN:
+				if (ev.key.repeat) {
+					break;
+				}
+				Input::QueueInput(InputSource::Key, ev.key.keysym.scancode, -1, true, GetEventTick(ev.key.timestamp));
+
 				if (ev.key.keysym.scancode == SDL_SCANCODE_F1) {
 					SetVSync(!vsync);
 				}
@@ -147,10 +220,119 @@ namespace Violet {
 						Graphics::viewResizeModeY = ViewResize::Expand;
 					}
 				}
+				break;
+
+			case SDL_KEYUP:
+				Input::QueueInput(InputSource::Key, ev.key.keysym.scancode, -1, false, GetEventTick(ev.key.timestamp));
+				break;
+
+			case SDL_CONTROLLERDEVICEADDED: {
+				// Assign to the first free player
+				if (GetControllerPlayer(SDL_JoystickGetDeviceInstanceID(ev.cdevice.which)) >= 0) {
+					break;
+				}
+				for (int i = 0; i < MaxPlayers; ++i) {
+					if (!controllers[i]) {
+						controllers[i] = SDL_GameControllerOpen(ev.cdevice.which);
+						if (controllers[i]) {
+							Input::players[i].controller = true;
+							Engine::DebugMessage("CONTROLLER ADDED:    Player " + std::to_string(i + 1));
+						}
+						break;
+					}
+				}
+				break;
+			}
+
+			case SDL_CONTROLLERDEVICEREMOVED: {
+				int player = GetControllerPlayer(ev.cdevice.which);
+				if (player >= 0) {
+					Input::QueueRelease(player, GetEventTick(ev.cdevice.timestamp));
+					SDL_GameControllerClose(controllers[player]);
+					controllers[player] = nullptr;
+					Input::players[player].controller = false;
+					Engine::DebugMessage("CONTROLLER REMOVED:  Player " + std::to_string(player + 1));
+				}
+				break;
+			}
+
+			case SDL_CONTROLLERBUTTONDOWN:
+			case SDL_CONTROLLERBUTTONUP: {
+				int player = GetControllerPlayer(ev.cbutton.which);
+				if (player >= 0) {
+					Input::QueueInput(InputSource::ControllerButton, ev.cbutton.button, player,
+						ev.type == SDL_CONTROLLERBUTTONDOWN, GetEventTick(ev.cbutton.timestamp));
+				}
+				break;
+			}
+
+			case SDL_CONTROLLERAXISMOTION: {
+				int player = GetControllerPlayer(ev.caxis.which);
+				if (player < 0) {
+					break;
+				}
+
+				float value = Math::Max(ev.caxis.value / 32767.0f, -1.0f);
+				double tick = GetEventTick(ev.caxis.timestamp);
+				switch (ev.caxis.axis) {
+				case SDL_CONTROLLER_AXIS_LEFTX:
+					Input::QueueAnalog(player, Analog::LeftStick, 0, value, tick);
+					break;
+				case SDL_CONTROLLER_AXIS_LEFTY:
+					Input::QueueAnalog(player, Analog::LeftStick, 1, value, tick);
+					break;
+				case SDL_CONTROLLER_AXIS_RIGHTX:
+					Input::QueueAnalog(player, Analog::RightStick, 0, value, tick);
+					break;
+				case SDL_CONTROLLER_AXIS_RIGHTY:
+					Input::QueueAnalog(player, Analog::RightStick, 1, value, tick);
+					break;
+				case SDL_CONTROLLER_AXIS_TRIGGERLEFT:
+					Input::QueueAnalog(player, Analog::LeftTrigger, 0, value, tick);
+					break;
+				case SDL_CONTROLLER_AXIS_TRIGGERRIGHT:
+					Input::QueueAnalog(player, Analog::RightTrigger, 0, value, tick);
+					break;
+				}
+				break;
+			}
 			}
 		}
 
-		return true;
+		Input::sampleTick = Engine::GetTicks();
+	}
+
+	/// <summary>
+	/// Bind default inputs
+	/// </summary>
+	void Shell::BindDefaultInput() {
+		// Keyboard (player 1)
+		Input::Bind(Button::A, InputSource::Key, SDL_SCANCODE_Z);
+		Input::Bind(Button::B, InputSource::Key, SDL_SCANCODE_X);
+		Input::Bind(Button::X, InputSource::Key, SDL_SCANCODE_A);
+		Input::Bind(Button::Y, InputSource::Key, SDL_SCANCODE_S);
+		Input::Bind(Button::Left, InputSource::Key, SDL_SCANCODE_LEFT);
+		Input::Bind(Button::Right, InputSource::Key, SDL_SCANCODE_RIGHT);
+		Input::Bind(Button::Up, InputSource::Key, SDL_SCANCODE_UP);
+		Input::Bind(Button::Down, InputSource::Key, SDL_SCANCODE_DOWN);
+		Input::Bind(Button::LeftBumper, InputSource::Key, SDL_SCANCODE_Q);
+		Input::Bind(Button::RightBumper, InputSource::Key, SDL_SCANCODE_W);
+
+		// Controllers
+		for (int i = 0; i < MaxPlayers; ++i) {
+			Input::Bind(Button::A, InputSource::ControllerButton, SDL_CONTROLLER_BUTTON_A, i);
+			Input::Bind(Button::B, InputSource::ControllerButton, SDL_CONTROLLER_BUTTON_B, i);
+			Input::Bind(Button::X, InputSource::ControllerButton, SDL_CONTROLLER_BUTTON_X, i);
+			Input::Bind(Button::Y, InputSource::ControllerButton, SDL_CONTROLLER_BUTTON_Y, i);
+			Input::Bind(Button::Left, InputSource::ControllerButton, SDL_CONTROLLER_BUTTON_DPAD_LEFT, i);
+			Input::Bind(Button::Right, InputSource::ControllerButton, SDL_CONTROLLER_BUTTON_DPAD_RIGHT, i);
+			Input::Bind(Button::Up, InputSource::ControllerButton, SDL_CONTROLLER_BUTTON_DPAD_UP, i);
+			Input::Bind(Button::Down, InputSource::ControllerButton, SDL_CONTROLLER_BUTTON_DPAD_DOWN, i);
+			Input::Bind(Button::LeftBumper, InputSource::ControllerButton, SDL_CONTROLLER_BUTTON_LEFTSHOULDER, i);
+			Input::Bind(Button::LeftStick, InputSource::ControllerButton, SDL_CONTROLLER_BUTTON_LEFTSTICK, i);
+			Input::Bind(Button::RightBumper, InputSource::ControllerButton, SDL_CONTROLLER_BUTTON_RIGHTSHOULDER, i);
+			Input::Bind(Button::RightStick, InputSource::ControllerButton, SDL_CONTROLLER_BUTTON_RIGHTSTICK, i);
+		}
 	}
 
 	/// <summary>
@@ -168,9 +350,31 @@ namespace Violet {
 	/// Update graphics end
 	/// </summary>
 	void Shell::UpdateGraphicsEnd() {
+		// The swap interval belongs to the context, so apply it from the thread that swaps
+		int interval = vsync ? 1 : 0;
+		if (swapInterval != interval) {
+			SDL_GL_SetSwapInterval(interval);
+			swapInterval = interval;
+		}
 		SDL_GL_SwapWindow(window);
 	}
 
+	/// <summary>
+	/// Make the render context current on the calling thread
+	/// </summary>
+	void Shell::StartRenderContext() {
+		if (SDL_GL_MakeCurrent(window, renderContext) < 0) {
+			Engine::Error("Failed to set current render thread OpenGL context.");
+		}
+	}
+
+	/// <summary>
+	/// Release the render context from the calling thread
+	/// </summary>
+	void Shell::StopRenderContext() {
+		SDL_GL_MakeCurrent(window, nullptr);
+	}
+
 	/// <summary>
 	/// Update sound
 	/// </summary>
@@ -183,7 +387,9 @@ namespace Violet {
 	/// Stop shell
 	/// </summary>
 	void Shell::Stop() {
-		SDL_PauseAudio(1);
+		if (audioDevice != 0) {
+			SDL_PauseAudioDevice(audioDevice, 1);
+		}
 	}
 
 	/// <summary>
@@ -191,7 +397,20 @@ namespace Violet {
 	/// </summary>
 	void Shell::Dispose() {
 		Stop();
-		SDL_CloseAudio();
+		if (audioDevice != 0) {
+			SDL_CloseAudioDevice(audioDevice);
+			audioDevice = 0;
+		}
+		if (renderContext) {
+			SDL_GL_DeleteContext(renderContext);
+			renderContext = nullptr;
+		}
+		for (int i = 0; i < MaxPlayers; ++i) {
+			if (controllers[i]) {
+				SDL_GameControllerClose(controllers[i]);
+				controllers[i] = nullptr;
+			}
+		}
 		SDL_GL_DeleteContext(context);
 		SDL_DestroyWindow(window);
 		SDL_Quit();
@@ -234,12 +453,13 @@ namespace Violet {
 			}
 			break;
 
-		case ScreenMode::Fullscreen:
+		case ScreenMode::Fullscreen: {
 			SDL_DisplayMode displayMode = GetDisplayMode();
 			SDL_ShowCursor(0);
 			SDL_SetWindowSize(window, displayMode.w, displayMode.h);
 			SDL_SetWindowFullscreen(window, SDL_WINDOW_FULLSCREEN);
 			break;
+		}
 
 		case ScreenMode::FullscreenBorderless:
 			SDL_ShowCursor(0);
@@ -256,7 +476,6 @@ namespace Violet {
 	/// <param name="enable">VSync enable flag</param>
 	void Shell::SetVSync(const bool enable) {
 		vsync = enable;
-		SDL_GL_SetSwapInterval(vsync ? 1 : 0);
 	}
 
 	/// <summary>
@@ -268,14 +487,22 @@ namespace Violet {
 	}
 
 	/// <summary>
-	/// Mix sound buffer
+	/// Sleep the calling thread
+	/// </summary>
+	/// <param name="time">Time to sleep (in milliseconds, rounded down)</param>
+	void Shell::Sleep(const double time) {
+		if (time >= 1) {
+			SDL_Delay(static_cast<Uint32>(time));
+		}
+	}
+
+	/// <summary>
+	/// Get the address of a graphics API function
 	/// </summary>
-	/// <param name="inBuffer">Input buffer</param>
-	/// <param name="outBuffer">Output buffer</param>
-	/// <param name="length">Buffer length</param>
-	/// <param name="volume">Volume</param>
-	void Shell::MixSound(S16* inBuffer, S16* outBuffer, const int length, const float volume) {
-		SDL_MixAudio((U8*)outBuffer, (U8*)inBuffer, length, static_cast<int>(SDL_MIX_MAXVOLUME * volume));
+	/// <param name="name">Function name</param>
+	/// <returns>Function address (nullptr if not available)</returns>
+	void* Shell::GetProcAddress(const char* name) {
+		return SDL_GL_GetProcAddress(name);
 	}
 
 	/// <summary>
@@ -288,6 +515,31 @@ namespace Violet {
 		return mode;
 	}
 
+	/// <summary>
+	/// Convert an event timestamp to a tick
+	/// </summary>
+	/// <param name="timestamp">Event timestamp</param>
+	/// <returns>Tick</returns>
+	double GetEventTick(const Uint32 timestamp) {
+		// Event timestamps are in milliseconds since SDL was initialized, so measure back from now
+		double now = Engine::GetTicks();
+		return now - Math::Max(static_cast<double>(static_cast<Sint32>(SDL_GetTicks() - timestamp)), 0.0);
+	}
+
+	/// <summary>
+	/// Get the player that a controller is assigned to
+	/// </summary>
+	/// <param name="id">Joystick instance ID</param>
+	/// <returns>Player ID, or -1 if not assigned</returns>
+	int GetControllerPlayer(const SDL_JoystickID id) {
+		for (int i = 0; i < MaxPlayers; ++i) {
+			if (controllers[i] && SDL_JoystickInstanceID(SDL_GameControllerGetJoystick(controllers[i])) == id) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
 	/// <summary>
 	/// Sound callback
 	/// </summary>
@@ -304,6 +556,7 @@ namespace Violet {
 	/// <param name="type">Message type</param>
 	/// <param name="msg">Message</param>
 	void Engine::Message(MessageType type, std::string msg) {
+		AllocScope allocScope(AllocTag::Message);
 		int flags = 0;
 		std::string title = GetAppName();
 
@@ -328,3 +581,5 @@ namespace Violet {
 	}
 
 }
+
+#endif // VIOLET_SHELL_SDL2
@@ -0,0 +1,60 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+namespace Violet {
+
+	/// <summary>
+	/// Screen vertex data
+	/// </summary>
+	struct ScreenVertex {
+		Vec2D<float> pos;
+		Vec2D<float> texCoord;
+	};
+
+	/// <summary>
+	/// Screen shader constructor
+	/// </summary>
+	/// <param name="fragCode">Fragment shader code (uses the copy shader if empty)</param>
+	ScreenShader::ScreenShader(std::string fragCode) : Shader(sizeof(ScreenVertex), 6, GetVertexShader(), fragCode.empty() ? GetCopyShader() : fragCode) {
+		vertexBuffer->AddAttribute(VertexBuffer::AttribType::Float, 2);
+		vertexBuffer->AddAttribute(VertexBuffer::AttribType::Float, 2);
+
+		// The quad always covers the viewport, which is set to the area being drawn over
+		ScreenVertex* vertexData = (ScreenVertex*)(vertexBuffer->GetDataBuffer());
+		vertexData[0] = { { -1, -1 }, { 0, 0 } };
+		vertexData[1] = { { 1, -1 }, { 1, 0 } };
+		vertexData[2] = { { -1, 1 }, { 0, 1 } };
+		vertexData[3] = vertexData[2];
+		vertexData[4] = vertexData[1];
+		vertexData[5] = { { 1, 1 }, { 1, 1 } };
+		vertexBuffer->RefreshData();
+
+		sourceSizeVar = AddVariable("sourceSize");
+		outputSizeVar = AddVariable("outputSize");
+	}
+
+	/// <summary>
+	/// Start sprite draw (screen shaders don't draw sprites)
+	/// </summary>
+	void ScreenShader::StartSpriteDraw() {
+	}
+
+	/// <summary>
+	/// Add sprite draw data (screen shaders don't draw sprites)
+	/// </summary>
+	/// <param name="textures">Sprite textures</param>
+	/// <param name="sprite">Sprite data</param>
+	void ScreenShader::AddSprite(std::shared_ptr<std::vector<TextureBind>> textures, SpriteData& sprite) {
+	}
+
+	/// <summary>
+	/// Flush sprites (screen shaders don't draw sprites)
+	/// </summary>
+	void ScreenShader::FlushSprites() {
+	}
+
+}
@@ -0,0 +1,83 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#ifndef VIOLET_SCREEN_SHADER_HPP
+#define VIOLET_SCREEN_SHADER_HPP
+
+namespace Violet {
+
+	/// <summary>
+	/// Screen shader (draws a render target's image over an area with a single quad; the fragment shader
+	/// gets "source" on unit 0, and the "sourceSize" and "outputSize" in pixels if it declares them)
+	/// </summary>
+	class ScreenShader : public Shader {
+	public:
+		// Friend classes
+		friend class Graphics;
+
+		/// <summary>
+		/// Screen shader constructor
+		/// </summary>
+		/// <param name="fragCode">Fragment shader code (uses the copy shader if empty)</param>
+		ScreenShader(std::string fragCode = "");
+
+		/// <summary>
+		/// Draw a render target's image
+		/// </summary>
+		/// <param name="source">Render target to draw</param>
+		/// <param name="filter">Texture filter</param>
+		/// <param name="area">Area of the current target to draw over (in pixels)</param>
+		void DrawScreen(RenderTarget& source, const TextureFilter filter, const Rect<int> area);
+
+		// <summary>
+		/// Start sprite draw (screen shaders don't draw sprites)
+		/// </summary>
+		void StartSpriteDraw();
+
+		/// <summary>
+		/// Add sprite draw data (screen shaders don't draw sprites)
+		/// </summary>
+		/// <param name="textures">Sprite textures</param>
+		/// <param name="sprite">Sprite data</param>
+		void AddSprite(std::shared_ptr<std::vector<TextureBind>> textures, SpriteData& sprite);
+
+		/// <summary>
+		/// Flush sprites (screen shaders don't draw sprites)
+		/// </summary>
+		void FlushSprites();
+
+		/// <summary>
+		/// Get screen shader vertex shader code
+		/// </summary>
+		/// <returns>Screen shader vertex shader code</returns>
+		static const char* GetVertexShader();
+
+		/// <summary>
+		/// Get copy fragment shader code (draws the source as is)
+		/// </summary>
+		/// <returns>Copy fragment shader code</returns>
+		static const char* GetCopyShader();
+
+		/// <summary>
+		/// Get sharp bilinear fragment shader code (scales the source with sharp pixels, blending only along their edges)
+		/// </summary>
+		/// <returns>Sharp bilinear fragment shader code</returns>
+		static const char* GetSharpBilinearShader();
+
+	private:
+		/// <summary>
+		/// Source size variable
+		/// </summary>
+		ShaderVar sourceSizeVar;
+
+		/// <summary>
+		/// Output size variable
+		/// </summary>
+		ShaderVar outputSizeVar;
+	};
+
+}
+
+#endif // VIOLET_SCREEN_SHADER_HPP
@@ -8,8 +8,955 @@
 namespace Violet {
 
 	/// <summary>
-	/// Active shader
+	/// Active shader (per thread, as each thread has its own context)
 	/// </summary>
-	Shader* Shader::active = nullptr;
+	thread_local Shader* Shader::active = nullptr;
+
+	/// <summary>
+	/// Get variable
+	/// </summary>
+	/// <param name="name">Variable name</param>
+	/// <returns>Variable handle (invalid if the variable wasn't added)</returns>
+	ShaderVar Shader::GetVariable(const std::string& name) const {
+		ShaderVar var;
+		std::unordered_map<std::string, int>::const_iterator found = variableIDs.find(name);
+		if (found != variableIDs.end()) {
+			var.index = found->second;
+		}
+		return var;
+	}
+
+	/// <summary>
+	/// Read shader code from a file
+	/// </summary>
+	/// <param name="fileName">File name</param>
+	/// <returns>Shader code</returns>
+	std::string Shader::ReadCode(const std::string& fileName) {
+		FILE* fp = nullptr;
+		if (fopen_s(&fp, fileName.c_str(), "rb") || !fp) {
+			Engine::Error("Failed to open shader file \"" + fileName + "\".");
+		}
+
+		std::string code;
+		char buffer[4096];
+		size_t read;
+		while ((read = fread(buffer, 1, sizeof(buffer), fp)) > 0) {
+			code.append(buffer, read);
+		}
+		fclose(fp);
+		return code;
+	}
+
+	/// <summary>
+	/// Update a variable's shadow copy
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="data">Value to set</param>
+	/// <param name="size">Value size</param>
+	/// <returns>Variable location if the value changed, -1 if it didn't (or the variable isn't used)</returns>
+	int Shader::UpdateVariable(const ShaderVar var, const void* data, const size_t size) {
+		if (!var.IsValid() || var.index >= static_cast<int>(variables.size())) {
+			return -1;
+		}
+
+		Variable& variable = variables[var.index];
+		if (variable.location < 0) {
+			return -1;
+		}
+
+		// Skip setting the same value again
+		if (variable.set && variable.shadow.size() == size && memcmp(variable.shadow.data(), data, size) == 0) {
+			return -1;
+		}
+		variable.shadow.resize(size);
+		memcpy(variable.shadow.data(), data, size);
+		variable.set = true;
+		return variable.location;
+	}
+
+	/// <summary>
+	/// Set a variable (queued for the render thread if it's running and this isn't it)
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="type">Variable type</param>
+	/// <param name="data">Value to set</param>
+	/// <param name="size">Value size</param>
+	void Shader::SetVariable(const ShaderVar var, const ShaderVarType type, const void* data, const size_t size) {
+		// The render thread may be drawing with this shader, so it applies the value itself before its next frame
+		if (Graphics::IsShaderVarDeferred()) {
+			Graphics::QueueShaderVar(this, var, type, data, size);
+			return;
+		}
+
+		int location = UpdateVariable(var, data, size);
+		if (location >= 0) {
+			SetActive();
+			UploadVariable(location, type, data, size);
+		}
+	}
+
+	/// <summary>
+	/// Set float
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="val">Value to set</param>
+	void Shader::SetFloat(const ShaderVar var, float val) {
+		SetVariable(var, ShaderVarType::Float, &val, sizeof(val));
+	}
+
+	/// <summary>
+	/// Set float
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="val">Value to set</param>
+	void Shader::SetFloat(const std::string& name, float val) {
+		SetFloat(GetVariable(name), val);
+	}
+
+	/// <summary>
+	/// Set signed integer
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="val">Value to set</param>
+	void Shader::SetInt(const ShaderVar var, S32 val) {
+		SetVariable(var, ShaderVarType::Int, &val, sizeof(val));
+	}
+
+	/// <summary>
+	/// Set signed integer
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="val">Value to set</param>
+	void Shader::SetInt(const std::string& name, S32 val) {
+		SetInt(GetVariable(name), val);
+	}
+
+	/// <summary>
+	/// Set unsigned integer
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="val">Value to set</param>
+	void Shader::SetUInt(const ShaderVar var, U32 val) {
+		SetVariable(var, ShaderVarType::UInt, &val, sizeof(val));
+	}
+
+	/// <summary>
+	/// Set unsigned integer
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="val">Value to set</param>
+	void Shader::SetUInt(const std::string& name, U32 val) {
+		SetUInt(GetVariable(name), val);
+	}
+
+	/// <summary>
+	/// Set 1-dimensional vector
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetVec1(const ShaderVar var, Vec1D<float> vec) {
+		SetVariable(var, ShaderVarType::Float, &vec, sizeof(vec));
+	}
+
+	/// <summary>
+	/// Set 1-dimensional vector
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetVec1(const std::string& name, Vec1D<float> vec) {
+		SetVec1(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 2-dimensional vector
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetVec2(const ShaderVar var, Vec2D<float> vec) {
+		SetVariable(var, ShaderVarType::Vec2, &vec, sizeof(vec));
+	}
+
+	/// <summary>
+	/// Set 2-dimensional vector
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetVec2(const std::string& name, Vec2D<float> vec) {
+		SetVec2(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 3-dimensional vector
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetVec3(const ShaderVar var, Vec3D<float> vec) {
+		SetVariable(var, ShaderVarType::Vec3, &vec, sizeof(vec));
+	}
+
+	/// <summary>
+	/// Set 3-dimensional vector
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetVec3(const std::string& name, Vec3D<float> vec) {
+		SetVec3(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 4-dimensional vector
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetVec4(const ShaderVar var, Vec4D<float> vec) {
+		SetVariable(var, ShaderVarType::Vec4, &vec, sizeof(vec));
+	}
+
+	/// <summary>
+	/// Set 4-dimensional vector
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetVec4(const std::string& name, Vec4D<float> vec) {
+		SetVec4(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 1-dimensional signed integer vector
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetIntVec1(const ShaderVar var, Vec1D<S32> vec) {
+		SetVariable(var, ShaderVarType::Int, &vec, sizeof(vec));
+	}
+
+	/// <summary>
+	/// Set 1-dimensional signed integer vector
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetIntVec1(const std::string& name, Vec1D<S32> vec) {
+		SetIntVec1(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 2-dimensional signed integer vector
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetIntVec2(const ShaderVar var, Vec2D<S32> vec) {
+		SetVariable(var, ShaderVarType::IntVec2, &vec, sizeof(vec));
+	}
+
+	/// <summary>
+	/// Set 2-dimensional signed integer vector
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetIntVec2(const std::string& name, Vec2D<S32> vec) {
+		SetIntVec2(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 3-dimensional signed integer vector
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetIntVec3(const ShaderVar var, Vec3D<S32> vec) {
+		SetVariable(var, ShaderVarType::IntVec3, &vec, sizeof(vec));
+	}
+
+	/// <summary>
+	/// Set 3-dimensional signed integer vector
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetIntVec3(const std::string& name, Vec3D<S32> vec) {
+		SetIntVec3(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 4-dimensional signed integer vector
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetIntVec4(const ShaderVar var, Vec4D<S32> vec) {
+		SetVariable(var, ShaderVarType::IntVec4, &vec, sizeof(vec));
+	}
+
+	/// <summary>
+	/// Set 4-dimensional signed integer vector
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetIntVec4(const std::string& name, Vec4D<S32> vec) {
+		SetIntVec4(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 1-dimensional unsigned integer vector
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetUIntVec1(const ShaderVar var, Vec1D<U32> vec) {
+		SetVariable(var, ShaderVarType::UInt, &vec, sizeof(vec));
+	}
+
+	/// <summary>
+	/// Set 1-dimensional unsigned integer vector
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetUIntVec1(const std::string& name, Vec1D<U32> vec) {
+		SetUIntVec1(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 2-dimensional unsigned integer vector
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetUIntVec2(const ShaderVar var, Vec2D<U32> vec) {
+		SetVariable(var, ShaderVarType::UIntVec2, &vec, sizeof(vec));
+	}
+
+	/// <summary>
+	/// Set 2-dimensional unsigned integer vector
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetUIntVec2(const std::string& name, Vec2D<U32> vec) {
+		SetUIntVec2(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 3-dimensional unsigned integer vector
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetUIntVec3(const ShaderVar var, Vec3D<U32> vec) {
+		SetVariable(var, ShaderVarType::UIntVec3, &vec, sizeof(vec));
+	}
+
+	/// <summary>
+	/// Set 3-dimensional unsigned integer vector
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetUIntVec3(const std::string& name, Vec3D<U32> vec) {
+		SetUIntVec3(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 4-dimensional unsigned integer vector
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetUIntVec4(const ShaderVar var, Vec4D<U32> vec) {
+		SetVariable(var, ShaderVarType::UIntVec4, &vec, sizeof(vec));
+	}
+
+	/// <summary>
+	/// Set 4-dimensional unsigned integer vector
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vector to set</param>
+	void Shader::SetUIntVec4(const std::string& name, Vec4D<U32> vec) {
+		SetUIntVec4(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set floats
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="val">Values to set</param>
+	void Shader::SetFloats(const ShaderVar var, std::initializer_list<float> val) {
+		SetVariable(var, ShaderVarType::Float, val.begin(), val.size() * sizeof(float));
+	}
+
+	/// <summary>
+	/// Set floats
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="val">Values to set</param>
+	void Shader::SetFloats(const std::string& name, std::initializer_list<float> val) {
+		SetFloats(GetVariable(name), val);
+	}
+
+	/// <summary>
+	/// Set signed integers
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="val">Values to set</param>
+	void Shader::SetInts(const ShaderVar var, std::initializer_list<S32> val) {
+		SetVariable(var, ShaderVarType::Int, val.begin(), val.size() * sizeof(S32));
+	}
+
+	/// <summary>
+	/// Set signed integers
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="val">Values to set</param>
+	void Shader::SetInts(const std::string& name, std::initializer_list<S32> val) {
+		SetInts(GetVariable(name), val);
+	}
+
+	/// <summary>
+	/// Set unsigned integers
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="val">Values to set</param>
+	void Shader::SetUInts(const ShaderVar var, std::initializer_list<U32> val) {
+		SetVariable(var, ShaderVarType::UInt, val.begin(), val.size() * sizeof(U32));
+	}
+
+	/// <summary>
+	/// Set unsigned integers
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="val">Values to set</param>
+	void Shader::SetUInts(const std::string& name, std::initializer_list<U32> val) {
+		SetUInts(GetVariable(name), val);
+	}
+
+	/// <summary>
+	/// Set 1-dimensional vectors
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetVec1s(const ShaderVar var, std::initializer_list<Vec1D<float>> vec) {
+		SetVariable(var, ShaderVarType::Float, vec.begin(), vec.size() * sizeof(Vec1D<float>));
+	}
+
+	/// <summary>
+	/// Set 1-dimensional vectors
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetVec1s(const std::string& name, std::initializer_list<Vec1D<float>> vec) {
+		SetVec1s(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 2-dimensional vectors
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetVec2s(const ShaderVar var, std::initializer_list<Vec2D<float>> vec) {
+		SetVariable(var, ShaderVarType::Vec2, vec.begin(), vec.size() * sizeof(Vec2D<float>));
+	}
+
+	/// <summary>
+	/// Set 2-dimensional vectors
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetVec2s(const std::string& name, std::initializer_list<Vec2D<float>> vec) {
+		SetVec2s(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 3-dimensional vectors
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetVec3s(const ShaderVar var, std::initializer_list<Vec3D<float>> vec) {
+		SetVariable(var, ShaderVarType::Vec3, vec.begin(), vec.size() * sizeof(Vec3D<float>));
+	}
+
+	/// <summary>
+	/// Set 3-dimensional vectors
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetVec3s(const std::string& name, std::initializer_list<Vec3D<float>> vec) {
+		SetVec3s(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 4-dimensional vectors
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetVec4s(const ShaderVar var, std::initializer_list<Vec4D<float>> vec) {
+		SetVariable(var, ShaderVarType::Vec4, vec.begin(), vec.size() * sizeof(Vec4D<float>));
+	}
+
+	/// <summary>
+	/// Set 4-dimensional vectors
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetVec4s(const std::string& name, std::initializer_list<Vec4D<float>> vec) {
+		SetVec4s(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 1-dimensional signed integer vectors
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetIntVec1s(const ShaderVar var, std::initializer_list<Vec1D<S32>> vec) {
+		SetVariable(var, ShaderVarType::Int, vec.begin(), vec.size() * sizeof(Vec1D<S32>));
+	}
+
+	/// <summary>
+	/// Set 1-dimensional signed integer vectors
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetIntVec1s(const std::string& name, std::initializer_list<Vec1D<S32>> vec) {
+		SetIntVec1s(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 2-dimensional signed integer vectors
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetIntVec2s(const ShaderVar var, std::initializer_list<Vec2D<S32>> vec) {
+		SetVariable(var, ShaderVarType::IntVec2, vec.begin(), vec.size() * sizeof(Vec2D<S32>));
+	}
+
+	/// <summary>
+	/// Set 2-dimensional signed integer vectors
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetIntVec2s(const std::string& name, std::initializer_list<Vec2D<S32>> vec) {
+		SetIntVec2s(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 3-dimensional signed integer vectors
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetIntVec3s(const ShaderVar var, std::initializer_list<Vec3D<S32>> vec) {
+		SetVariable(var, ShaderVarType::IntVec3, vec.begin(), vec.size() * sizeof(Vec3D<S32>));
+	}
+
+	/// <summary>
+	/// Set 3-dimensional signed integer vectors
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetIntVec3s(const std::string& name, std::initializer_list<Vec3D<S32>> vec) {
+		SetIntVec3s(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 4-dimensional signed integer vectors
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetIntVec4s(const ShaderVar var, std::initializer_list<Vec4D<S32>> vec) {
+		SetVariable(var, ShaderVarType::IntVec4, vec.begin(), vec.size() * sizeof(Vec4D<S32>));
+	}
+
+	/// <summary>
+	/// Set 4-dimensional signed integer vectors
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetIntVec4s(const std::string& name, std::initializer_list<Vec4D<S32>> vec) {
+		SetIntVec4s(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 1-dimensional unsigned integer vectors
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetUIntVec1s(const ShaderVar var, std::initializer_list<Vec1D<U32>> vec) {
+		SetVariable(var, ShaderVarType::UInt, vec.begin(), vec.size() * sizeof(Vec1D<U32>));
+	}
+
+	/// <summary>
+	/// Set 1-dimensional unsigned integer vectors
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetUIntVec1s(const std::string& name, std::initializer_list<Vec1D<U32>> vec) {
+		SetUIntVec1s(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 2-dimensional unsigned integer vectors
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetUIntVec2s(const ShaderVar var, std::initializer_list<Vec2D<U32>> vec) {
+		SetVariable(var, ShaderVarType::UIntVec2, vec.begin(), vec.size() * sizeof(Vec2D<U32>));
+	}
+
+	/// <summary>
+	/// Set 2-dimensional unsigned integer vectors
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetUIntVec2s(const std::string& name, std::initializer_list<Vec2D<U32>> vec) {
+		SetUIntVec2s(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 3-dimensional unsigned integer vectors
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetUIntVec3s(const ShaderVar var, std::initializer_list<Vec3D<U32>> vec) {
+		SetVariable(var, ShaderVarType::UIntVec3, vec.begin(), vec.size() * sizeof(Vec3D<U32>));
+	}
+
+	/// <summary>
+	/// Set 3-dimensional unsigned integer vectors
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetUIntVec3s(const std::string& name, std::initializer_list<Vec3D<U32>> vec) {
+		SetUIntVec3s(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 4-dimensional unsigned integer vectors
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetUIntVec4s(const ShaderVar var, std::initializer_list<Vec4D<U32>> vec) {
+		SetVariable(var, ShaderVarType::UIntVec4, vec.begin(), vec.size() * sizeof(Vec4D<U32>));
+	}
+
+	/// <summary>
+	/// Set 4-dimensional unsigned integer vectors
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="vec">Vectors to set</param>
+	void Shader::SetUIntVec4s(const std::string& name, std::initializer_list<Vec4D<U32>> vec) {
+		SetUIntVec4s(GetVariable(name), vec);
+	}
+
+	/// <summary>
+	/// Set 2x2 matrix
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix2x2(const ShaderVar var, Matrix2x2<float> mat) {
+		SetVariable(var, ShaderVarType::Matrix2x2, &mat, sizeof(mat));
+	}
+
+	/// <summary>
+	/// Set 2x2 matrix
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix2x2(const std::string& name, Matrix2x2<float> mat) {
+		SetMatrix2x2(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 3x3 matrix
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix3x3(const ShaderVar var, Matrix3x3<float> mat) {
+		SetVariable(var, ShaderVarType::Matrix3x3, &mat, sizeof(mat));
+	}
+
+	/// <summary>
+	/// Set 3x3 matrix
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix3x3(const std::string& name, Matrix3x3<float> mat) {
+		SetMatrix3x3(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 4x4 matrix
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix4x4(const ShaderVar var, Matrix4x4<float> mat) {
+		SetVariable(var, ShaderVarType::Matrix4x4, &mat, sizeof(mat));
+	}
+
+	/// <summary>
+	/// Set 4x4 matrix
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix4x4(const std::string& name, Matrix4x4<float> mat) {
+		SetMatrix4x4(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 2x3 matrix
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix2x3(const ShaderVar var, Matrix2x3<float> mat) {
+		SetVariable(var, ShaderVarType::Matrix2x3, &mat, sizeof(mat));
+	}
+
+	/// <summary>
+	/// Set 2x3 matrix
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix2x3(const std::string& name, Matrix2x3<float> mat) {
+		SetMatrix2x3(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 3x2 matrix
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix3x2(const ShaderVar var, Matrix3x2<float> mat) {
+		SetVariable(var, ShaderVarType::Matrix3x2, &mat, sizeof(mat));
+	}
+
+	/// <summary>
+	/// Set 3x2 matrix
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix3x2(const std::string& name, Matrix3x2<float> mat) {
+		SetMatrix3x2(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 2x4 matrix
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix2x4(const ShaderVar var, Matrix2x4<float> mat) {
+		SetVariable(var, ShaderVarType::Matrix2x4, &mat, sizeof(mat));
+	}
+
+	/// <summary>
+	/// Set 2x4 matrix
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix2x4(const std::string& name, Matrix2x4<float> mat) {
+		SetMatrix2x4(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 4x2 matrix
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix4x2(const ShaderVar var, Matrix4x2<float> mat) {
+		SetVariable(var, ShaderVarType::Matrix4x2, &mat, sizeof(mat));
+	}
+
+	/// <summary>
+	/// Set 4x2 matrix
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix4x2(const std::string& name, Matrix4x2<float> mat) {
+		SetMatrix4x2(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 3x4 matrix
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix3x4(const ShaderVar var, Matrix3x4<float> mat) {
+		SetVariable(var, ShaderVarType::Matrix3x4, &mat, sizeof(mat));
+	}
+
+	/// <summary>
+	/// Set 3x4 matrix
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix3x4(const std::string& name, Matrix3x4<float> mat) {
+		SetMatrix3x4(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 4x3 matrix
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix4x3(const ShaderVar var, Matrix4x3<float> mat) {
+		SetVariable(var, ShaderVarType::Matrix4x3, &mat, sizeof(mat));
+	}
+
+	/// <summary>
+	/// Set 4x3 matrix
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrix to set</param>
+	void Shader::SetMatrix4x3(const std::string& name, Matrix4x3<float> mat) {
+		SetMatrix4x3(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 2x2 matrices
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices2x2(const ShaderVar var, std::initializer_list<Matrix2x2<float>> mat) {
+		SetVariable(var, ShaderVarType::Matrix2x2, mat.begin(), mat.size() * sizeof(Matrix2x2<float>));
+	}
+
+	/// <summary>
+	/// Set 2x2 matrices
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices2x2(const std::string& name, std::initializer_list<Matrix2x2<float>> mat) {
+		SetMatrices2x2(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 3x3 matrices
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices3x3(const ShaderVar var, std::initializer_list<Matrix3x3<float>> mat) {
+		SetVariable(var, ShaderVarType::Matrix3x3, mat.begin(), mat.size() * sizeof(Matrix3x3<float>));
+	}
+
+	/// <summary>
+	/// Set 3x3 matrices
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices3x3(const std::string& name, std::initializer_list<Matrix3x3<float>> mat) {
+		SetMatrices3x3(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 4x4 matrices
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices4x4(const ShaderVar var, std::initializer_list<Matrix4x4<float>> mat) {
+		SetVariable(var, ShaderVarType::Matrix4x4, mat.begin(), mat.size() * sizeof(Matrix4x4<float>));
+	}
+
+	/// <summary>
+	/// Set 4x4 matrices
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices4x4(const std::string& name, std::initializer_list<Matrix4x4<float>> mat) {
+		SetMatrices4x4(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 2x3 matrices
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices2x3(const ShaderVar var, std::initializer_list<Matrix2x3<float>> mat) {
+		SetVariable(var, ShaderVarType::Matrix2x3, mat.begin(), mat.size() * sizeof(Matrix2x3<float>));
+	}
+
+	/// <summary>
+	/// Set 2x3 matrices
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices2x3(const std::string& name, std::initializer_list<Matrix2x3<float>> mat) {
+		SetMatrices2x3(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 3x2 matrices
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices3x2(const ShaderVar var, std::initializer_list<Matrix3x2<float>> mat) {
+		SetVariable(var, ShaderVarType::Matrix3x2, mat.begin(), mat.size() * sizeof(Matrix3x2<float>));
+	}
+
+	/// <summary>
+	/// Set 3x2 matrices
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices3x2(const std::string& name, std::initializer_list<Matrix3x2<float>> mat) {
+		SetMatrices3x2(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 2x4 matrices
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices2x4(const ShaderVar var, std::initializer_list<Matrix2x4<float>> mat) {
+		SetVariable(var, ShaderVarType::Matrix2x4, mat.begin(), mat.size() * sizeof(Matrix2x4<float>));
+	}
+
+	/// <summary>
+	/// Set 2x4 matrices
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices2x4(const std::string& name, std::initializer_list<Matrix2x4<float>> mat) {
+		SetMatrices2x4(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 4x2 matrices
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices4x2(const ShaderVar var, std::initializer_list<Matrix4x2<float>> mat) {
+		SetVariable(var, ShaderVarType::Matrix4x2, mat.begin(), mat.size() * sizeof(Matrix4x2<float>));
+	}
+
+	/// <summary>
+	/// Set 4x2 matrices
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices4x2(const std::string& name, std::initializer_list<Matrix4x2<float>> mat) {
+		SetMatrices4x2(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 3x4 matrices
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices3x4(const ShaderVar var, std::initializer_list<Matrix3x4<float>> mat) {
+		SetVariable(var, ShaderVarType::Matrix3x4, mat.begin(), mat.size() * sizeof(Matrix3x4<float>));
+	}
+
+	/// <summary>
+	/// Set 3x4 matrices
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices3x4(const std::string& name, std::initializer_list<Matrix3x4<float>> mat) {
+		SetMatrices3x4(GetVariable(name), mat);
+	}
+
+	/// <summary>
+	/// Set 4x3 matrices
+	/// </summary>
+	/// <param name="var">Variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices4x3(const ShaderVar var, std::initializer_list<Matrix4x3<float>> mat) {
+		SetVariable(var, ShaderVarType::Matrix4x3, mat.begin(), mat.size() * sizeof(Matrix4x3<float>));
+	}
+
+	/// <summary>
+	/// Set 4x3 matrices
+	/// </summary>
+	/// <param name="name">Name of variable</param>
+	/// <param name="mat">Matrices to set</param>
+	void Shader::SetMatrices4x3(const std::string& name, std::initializer_list<Matrix4x3<float>> mat) {
+		SetMatrices4x3(GetVariable(name), mat);
+	}
 
 }
@@ -8,12 +8,146 @@
 
 namespace Violet {
 
+	/// <summary>
+	/// Frame uniform buffer binding point (FrameData uniform block)
+	/// </summary>
+	constexpr int FrameUniformBinding = 0;
+
+	/// <summary>
+	/// Shader variable handle
+	/// </summary>
+	struct ShaderVar {
+		/// <summary>
+		/// Index into the shader's variables
+		/// </summary>
+		int index{ -1 };
+
+		/// <summary>
+		/// Check if the handle refers to a variable
+		/// </summary>
+		/// <returns>True if valid, false if not</returns>
+		bool IsValid() const {
+			return index >= 0;
+		}
+	};
+
+	/// <summary>
+	/// Shader variable type
+	/// </summary>
+	enum class ShaderVarType {
+		/// <summary>
+		/// Float (or 1-dimensional vector)
+		/// </summary>
+		Float = 0,
+
+		/// <summary>
+		/// 2-dimensional vector
+		/// </summary>
+		Vec2,
+
+		/// <summary>
+		/// 3-dimensional vector
+		/// </summary>
+		Vec3,
+
+		/// <summary>
+		/// 4-dimensional vector
+		/// </summary>
+		Vec4,
+
+		/// <summary>
+		/// Signed integer (or 1-dimensional signed integer vector, or sampler)
+		/// </summary>
+		Int,
+
+		/// <summary>
+		/// 2-dimensional signed integer vector
+		/// </summary>
+		IntVec2,
+
+		/// <summary>
+		/// 3-dimensional signed integer vector
+		/// </summary>
+		IntVec3,
+
+		/// <summary>
+		/// 4-dimensional signed integer vector
+		/// </summary>
+		IntVec4,
+
+		/// <summary>
+		/// Unsigned integer (or 1-dimensional unsigned integer vector)
+		/// </summary>
+		UInt,
+
+		/// <summary>
+		/// 2-dimensional unsigned integer vector
+		/// </summary>
+		UIntVec2,
+
+		/// <summary>
+		/// 3-dimensional unsigned integer vector
+		/// </summary>
+		UIntVec3,
+
+		/// <summary>
+		/// 4-dimensional unsigned integer vector
+		/// </summary>
+		UIntVec4,
+
+		/// <summary>
+		/// 2x2 matrix
+		/// </summary>
+		Matrix2x2,
+
+		/// <summary>
+		/// 3x3 matrix
+		/// </summary>
+		Matrix3x3,
+
+		/// <summary>
+		/// 4x4 matrix
+		/// </summary>
+		Matrix4x4,
+
+		/// <summary>
+		/// 2x3 matrix
+		/// </summary>
+		Matrix2x3,
+
+		/// <summary>
+		/// 3x2 matrix
+		/// </summary>
+		Matrix3x2,
+
+		/// <summary>
+		/// 2x4 matrix
+		/// </summary>
+		Matrix2x4,
+
+		/// <summary>
+		/// 4x2 matrix
+		/// </summary>
+		Matrix4x2,
+
+		/// <summary>
+		/// 3x4 matrix
+		/// </summary>
+		Matrix3x4,
+
+		/// <summary>
+		/// 4x3 matrix
+		/// </summary>
+		Matrix4x3
+	};
+
 	/// <summary>
 	/// Shader
 	/// </summary>
 	class Shader {
 	public:
 		// Friend classes
+		friend class AssetWatcher;
 		friend class Engine;
 		friend class Graphics;
 
@@ -42,348 +176,715 @@ namespace Violet {
 		/// </summary>
 		void SetActive();
 
+		/// <summary>
+		/// Rebuild the shader from new code (variables, uniform blocks and the values set to them are kept,
+		/// and the current program is kept if the new one fails to build)
+		/// </summary>
+		/// <param name="vertexCode">Vertex shader code</param>
+		/// <param name="fragCode">Fragment shader code</param>
+		/// <returns>True if rebuilt, false if not</returns>
+		bool Reload(std::string vertexCode, std::string fragCode);
+
+		/// <summary>
+		/// Read shader code from a file
+		/// </summary>
+		/// <param name="fileName">File name</param>
+		/// <returns>Shader code</returns>
+		static std::string ReadCode(const std::string& fileName);
+
 		/// <summary>
 		/// Add variable
 		/// </summary>
 		/// <param name="name">Variable name</param>
-		void AddVariable(std::string name);
+		/// <returns>Variable handle</returns>
+		ShaderVar AddVariable(const std::string& name);
+
+		/// <summary>
+		/// Get variable
+		/// </summary>
+		/// <param name="name">Variable name</param>
+		/// <returns>Variable handle (invalid if the variable wasn't added)</returns>
+		ShaderVar GetVariable(const std::string& name) const;
+
+		/// <summary>
+		/// Bind a uniform block to a uniform buffer binding point
+		/// </summary>
+		/// <param name="name">Uniform block name</param>
+		/// <param name="binding">Binding point</param>
+		void AddUniformBlock(const std::string& name, const int binding);
+
+		/// <summary>
+		/// Set float
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="val">Value to set</param>
+		void SetFloat(const ShaderVar var, float val);
 
 		/// <summary>
 		/// Set float
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="val">Value to set</param>
-		void SetFloat(std::string name, float val);
+		void SetFloat(const std::string& name, float val);
+
+		/// <summary>
+		/// Set signed integer
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="val">Value to set</param>
+		void SetInt(const ShaderVar var, S32 val);
 
 		/// <summary>
 		/// Set signed integer
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="val">Value to set</param>
-		void SetInt(std::string name, S32 val);
+		void SetInt(const std::string& name, S32 val);
+
+		/// <summary>
+		/// Set unsigned integer
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="val">Value to set</param>
+		void SetUInt(const ShaderVar var, U32 val);
 
 		/// <summary>
 		/// Set unsigned integer
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="val">Value to set</param>
-		void SetUInt(std::string name, U32 val);
+		void SetUInt(const std::string& name, U32 val);
+
+		/// <summary>
+		/// Set 1-dimensional vector
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vector to set</param>
+		void SetVec1(const ShaderVar var, Vec1D<float> vec);
 
 		/// <summary>
 		/// Set 1-dimensional vector
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vector to set</param>
-		void SetVec1(std::string name, Vec1D<float> vec);
+		void SetVec1(const std::string& name, Vec1D<float> vec);
+
+		/// <summary>
+		/// Set 2-dimensional vector
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vector to set</param>
+		void SetVec2(const ShaderVar var, Vec2D<float> vec);
 
 		/// <summary>
 		/// Set 2-dimensional vector
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vector to set</param>
-		void SetVec2(std::string name, Vec2D<float> vec);
+		void SetVec2(const std::string& name, Vec2D<float> vec);
+
+		/// <summary>
+		/// Set 3-dimensional vector
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vector to set</param>
+		void SetVec3(const ShaderVar var, Vec3D<float> vec);
 
 		/// <summary>
 		/// Set 3-dimensional vector
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vector to set</param>
-		void SetVec3(std::string name,Vec3D<float> vec);
+		void SetVec3(const std::string& name, Vec3D<float> vec);
+
+		/// <summary>
+		/// Set 4-dimensional vector
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vector to set</param>
+		void SetVec4(const ShaderVar var, Vec4D<float> vec);
 
 		/// <summary>
 		/// Set 4-dimensional vector
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vector to set</param>
-		void SetVec4(std::string name, Vec4D<float> vec);
+		void SetVec4(const std::string& name, Vec4D<float> vec);
+
+		/// <summary>
+		/// Set 1-dimensional signed integer vector
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vector to set</param>
+		void SetIntVec1(const ShaderVar var, Vec1D<S32> vec);
 
 		/// <summary>
 		/// Set 1-dimensional signed integer vector
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vector to set</param>
-		void SetIntVec1(std::string name, Vec1D<S32> vec);
+		void SetIntVec1(const std::string& name, Vec1D<S32> vec);
+
+		/// <summary>
+		/// Set 2-dimensional signed integer vector
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vector to set</param>
+		void SetIntVec2(const ShaderVar var, Vec2D<S32> vec);
 
 		/// <summary>
 		/// Set 2-dimensional signed integer vector
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vector to set</param>
-		void SetIntVec2(std::string name, Vec2D<S32> vec);
+		void SetIntVec2(const std::string& name, Vec2D<S32> vec);
+
+		/// <summary>
+		/// Set 3-dimensional signed integer vector
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vector to set</param>
+		void SetIntVec3(const ShaderVar var, Vec3D<S32> vec);
 
 		/// <summary>
 		/// Set 3-dimensional signed integer vector
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vector to set</param>
-		void SetIntVec3(std::string name, Vec3D<S32> vec);
+		void SetIntVec3(const std::string& name, Vec3D<S32> vec);
+
+		/// <summary>
+		/// Set 4-dimensional signed integer vector
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vector to set</param>
+		void SetIntVec4(const ShaderVar var, Vec4D<S32> vec);
 
 		/// <summary>
 		/// Set 4-dimensional signed integer vector
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vector to set</param>
-		void SetIntVec4(std::string name, Vec4D<S32> vec);
+		void SetIntVec4(const std::string& name, Vec4D<S32> vec);
+
+		/// <summary>
+		/// Set 1-dimensional unsigned integer vector
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vector to set</param>
+		void SetUIntVec1(const ShaderVar var, Vec1D<U32> vec);
 
 		/// <summary>
 		/// Set 1-dimensional unsigned integer vector
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vector to set</param>
-		void SetUIntVec1(std::string name, Vec1D<U32> vec);
+		void SetUIntVec1(const std::string& name, Vec1D<U32> vec);
+
+		/// <summary>
+		/// Set 2-dimensional unsigned integer vector
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vector to set</param>
+		void SetUIntVec2(const ShaderVar var, Vec2D<U32> vec);
 
 		/// <summary>
 		/// Set 2-dimensional unsigned integer vector
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vector to set</param>
-		void SetUIntVec2(std::string name, Vec2D<U32> vec);
+		void SetUIntVec2(const std::string& name, Vec2D<U32> vec);
+
+		/// <summary>
+		/// Set 3-dimensional unsigned integer vector
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vector to set</param>
+		void SetUIntVec3(const ShaderVar var, Vec3D<U32> vec);
 
 		/// <summary>
 		/// Set 3-dimensional unsigned integer vector
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vector to set</param>
-		void SetUIntVec3(std::string name, Vec3D<U32> vec);
+		void SetUIntVec3(const std::string& name, Vec3D<U32> vec);
+
+		/// <summary>
+		/// Set 4-dimensional unsigned integer vector
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vector to set</param>
+		void SetUIntVec4(const ShaderVar var, Vec4D<U32> vec);
 
 		/// <summary>
 		/// Set 4-dimensional unsigned integer vector
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vector to set</param>
-		void SetUIntVec4(std::string name, Vec4D<U32> vec);
+		void SetUIntVec4(const std::string& name, Vec4D<U32> vec);
+
+		/// <summary>
+		/// Set floats
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="val">Values to set</param>
+		void SetFloats(const ShaderVar var, std::initializer_list<float> val);
 
 		/// <summary>
 		/// Set floats
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="val">Values to set</param>
-		void SetFloats(std::string name, std::initializer_list<float> val);
+		void SetFloats(const std::string& name, std::initializer_list<float> val);
+
+		/// <summary>
+		/// Set signed integers
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="val">Values to set</param>
+		void SetInts(const ShaderVar var, std::initializer_list<S32> val);
 
 		/// <summary>
 		/// Set signed integers
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="val">Values to set</param>
-		void SetInts(std::string name, std::initializer_list<S32> val);
+		void SetInts(const std::string& name, std::initializer_list<S32> val);
+
+		/// <summary>
+		/// Set unsigned integers
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="val">Values to set</param>
+		void SetUInts(const ShaderVar var, std::initializer_list<U32> val);
 
 		/// <summary>
 		/// Set unsigned integers
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="val">Values to set</param>
-		void SetUInts(std::string name, std::initializer_list<U32> val);
+		void SetUInts(const std::string& name, std::initializer_list<U32> val);
+
+		/// <summary>
+		/// Set 1-dimensional vectors
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vectors to set</param>
+		void SetVec1s(const ShaderVar var, std::initializer_list<Vec1D<float>> vec);
 
 		/// <summary>
 		/// Set 1-dimensional vectors
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vectors to set</param>
-		void SetVec1s(std::string name, std::initializer_list<Vec1D<float>> vec);
+		void SetVec1s(const std::string& name, std::initializer_list<Vec1D<float>> vec);
+
+		/// <summary>
+		/// Set 2-dimensional vectors
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vectors to set</param>
+		void SetVec2s(const ShaderVar var, std::initializer_list<Vec2D<float>> vec);
 
 		/// <summary>
 		/// Set 2-dimensional vectors
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vectors to set</param>
-		void SetVec2s(std::string name, std::initializer_list<Vec2D<float>> vec);
+		void SetVec2s(const std::string& name, std::initializer_list<Vec2D<float>> vec);
+
+		/// <summary>
+		/// Set 3-dimensional vectors
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vectors to set</param>
+		void SetVec3s(const ShaderVar var, std::initializer_list<Vec3D<float>> vec);
 
 		/// <summary>
 		/// Set 3-dimensional vectors
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vectors to set</param>
-		void SetVec3s(std::string name, std::initializer_list<Vec3D<float>> vec);
+		void SetVec3s(const std::string& name, std::initializer_list<Vec3D<float>> vec);
+
+		/// <summary>
+		/// Set 4-dimensional vectors
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vectors to set</param>
+		void SetVec4s(const ShaderVar var, std::initializer_list<Vec4D<float>> vec);
 
 		/// <summary>
 		/// Set 4-dimensional vectors
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vectors to set</param>
-		void SetVec4s(std::string name, std::initializer_list<Vec4D<float>> vec);
+		void SetVec4s(const std::string& name, std::initializer_list<Vec4D<float>> vec);
+
+		/// <summary>
+		/// Set 1-dimensional signed integer vectors
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vectors to set</param>
+		void SetIntVec1s(const ShaderVar var, std::initializer_list<Vec1D<S32>> vec);
 
 		/// <summary>
 		/// Set 1-dimensional signed integer vectors
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vectors to set</param>
-		void SetIntVec1s(std::string name, std::initializer_list<Vec1D<S32>> vec);
+		void SetIntVec1s(const std::string& name, std::initializer_list<Vec1D<S32>> vec);
+
+		/// <summary>
+		/// Set 2-dimensional signed integer vectors
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vectors to set</param>
+		void SetIntVec2s(const ShaderVar var, std::initializer_list<Vec2D<S32>> vec);
 
 		/// <summary>
 		/// Set 2-dimensional signed integer vectors
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vectors to set</param>
-		void SetIntVec2s(std::string name, std::initializer_list<Vec2D<S32>> vec);
+		void SetIntVec2s(const std::string& name, std::initializer_list<Vec2D<S32>> vec);
+
+		/// <summary>
+		/// Set 3-dimensional signed integer vectors
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vectors to set</param>
+		void SetIntVec3s(const ShaderVar var, std::initializer_list<Vec3D<S32>> vec);
 
 		/// <summary>
 		/// Set 3-dimensional signed integer vectors
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vectors to set</param>
-		void SetIntVec3s(std::string name, std::initializer_list<Vec3D<S32>> vec);
+		void SetIntVec3s(const std::string& name, std::initializer_list<Vec3D<S32>> vec);
+
+		/// <summary>
+		/// Set 4-dimensional signed integer vectors
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vectors to set</param>
+		void SetIntVec4s(const ShaderVar var, std::initializer_list<Vec4D<S32>> vec);
 
 		/// <summary>
 		/// Set 4-dimensional signed integer vectors
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vectors to set</param>
-		void SetIntVec4s(std::string name, std::initializer_list<Vec4D<S32>> vec);
+		void SetIntVec4s(const std::string& name, std::initializer_list<Vec4D<S32>> vec);
+
+		/// <summary>
+		/// Set 1-dimensional unsigned integer vectors
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vectors to set</param>
+		void SetUIntVec1s(const ShaderVar var, std::initializer_list<Vec1D<U32>> vec);
 
 		/// <summary>
 		/// Set 1-dimensional unsigned integer vectors
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vectors to set</param>
-		void SetUIntVec1s(std::string name, std::initializer_list<Vec1D<U32>> vec);
+		void SetUIntVec1s(const std::string& name, std::initializer_list<Vec1D<U32>> vec);
+
+		/// <summary>
+		/// Set 2-dimensional unsigned integer vectors
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vectors to set</param>
+		void SetUIntVec2s(const ShaderVar var, std::initializer_list<Vec2D<U32>> vec);
 
 		/// <summary>
 		/// Set 2-dimensional unsigned integer vectors
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vectors to set</param>
-		void SetUIntVec2s(std::string name, std::initializer_list<Vec2D<U32>> vec);
+		void SetUIntVec2s(const std::string& name, std::initializer_list<Vec2D<U32>> vec);
+
+		/// <summary>
+		/// Set 3-dimensional unsigned integer vectors
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vectors to set</param>
+		void SetUIntVec3s(const ShaderVar var, std::initializer_list<Vec3D<U32>> vec);
 
 		/// <summary>
 		/// Set 3-dimensional unsigned integer vectors
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vectors to set</param>
-		void SetUIntVec3s(std::string name, std::initializer_list<Vec3D<U32>> vec);
+		void SetUIntVec3s(const std::string& name, std::initializer_list<Vec3D<U32>> vec);
+
+		/// <summary>
+		/// Set 4-dimensional unsigned integer vectors
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="vec">Vectors to set</param>
+		void SetUIntVec4s(const ShaderVar var, std::initializer_list<Vec4D<U32>> vec);
 
 		/// <summary>
 		/// Set 4-dimensional unsigned integer vectors
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="vec">Vectors to set</param>
-		void SetUIntVec4s(std::string name, std::initializer_list<Vec4D<U32>> vec);
+		void SetUIntVec4s(const std::string& name, std::initializer_list<Vec4D<U32>> vec);
+
+		/// <summary>
+		/// Set 2x2 matrix
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrix to set</param>
+		void SetMatrix2x2(const ShaderVar var, Matrix2x2<float> mat);
 
 		/// <summary>
 		/// Set 2x2 matrix
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrix to set</param>
-		void SetMatrix2x2(std::string name, Matrix2x2<float> mat);
+		void SetMatrix2x2(const std::string& name, Matrix2x2<float> mat);
+
+		/// <summary>
+		/// Set 3x3 matrix
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrix to set</param>
+		void SetMatrix3x3(const ShaderVar var, Matrix3x3<float> mat);
 
 		/// <summary>
 		/// Set 3x3 matrix
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrix to set</param>
-		void SetMatrix3x3(std::string name, Matrix3x3<float> mat);
+		void SetMatrix3x3(const std::string& name, Matrix3x3<float> mat);
+
+		/// <summary>
+		/// Set 4x4 matrix
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrix to set</param>
+		void SetMatrix4x4(const ShaderVar var, Matrix4x4<float> mat);
 
 		/// <summary>
 		/// Set 4x4 matrix
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrix to set</param>
-		void SetMatrix4x4(std::string name, Matrix4x4<float> mat);
+		void SetMatrix4x4(const std::string& name, Matrix4x4<float> mat);
+
+		/// <summary>
+		/// Set 2x3 matrix
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrix to set</param>
+		void SetMatrix2x3(const ShaderVar var, Matrix2x3<float> mat);
 
 		/// <summary>
 		/// Set 2x3 matrix
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrix to set</param>
-		void SetMatrix2x3(std::string name, Matrix2x3<float> mat);
+		void SetMatrix2x3(const std::string& name, Matrix2x3<float> mat);
+
+		/// <summary>
+		/// Set 3x2 matrix
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrix to set</param>
+		void SetMatrix3x2(const ShaderVar var, Matrix3x2<float> mat);
 
 		/// <summary>
 		/// Set 3x2 matrix
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrix to set</param>
-		void SetMatrix3x2(std::string name, Matrix3x2<float> mat);
+		void SetMatrix3x2(const std::string& name, Matrix3x2<float> mat);
+
+		/// <summary>
+		/// Set 2x4 matrix
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrix to set</param>
+		void SetMatrix2x4(const ShaderVar var, Matrix2x4<float> mat);
 
 		/// <summary>
 		/// Set 2x4 matrix
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrix to set</param>
-		void SetMatrix2x4(std::string name, Matrix2x4<float> mat);
+		void SetMatrix2x4(const std::string& name, Matrix2x4<float> mat);
+
+		/// <summary>
+		/// Set 4x2 matrix
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrix to set</param>
+		void SetMatrix4x2(const ShaderVar var, Matrix4x2<float> mat);
 
 		/// <summary>
 		/// Set 4x2 matrix
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrix to set</param>
-		void SetMatrix4x2(std::string name, Matrix4x2<float> mat);
+		void SetMatrix4x2(const std::string& name, Matrix4x2<float> mat);
+
+		/// <summary>
+		/// Set 3x4 matrix
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrix to set</param>
+		void SetMatrix3x4(const ShaderVar var, Matrix3x4<float> mat);
 
 		/// <summary>
 		/// Set 3x4 matrix
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrix to set</param>
-		void SetMatrix3x4(std::string name, Matrix3x4<float> mat);
+		void SetMatrix3x4(const std::string& name, Matrix3x4<float> mat);
+
+		/// <summary>
+		/// Set 4x3 matrix
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrix to set</param>
+		void SetMatrix4x3(const ShaderVar var, Matrix4x3<float> mat);
 
 		/// <summary>
 		/// Set 4x3 matrix
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrix to set</param>
-		void SetMatrix4x3(std::string name, Matrix4x3<float> mat);
+		void SetMatrix4x3(const std::string& name, Matrix4x3<float> mat);
+
+		/// <summary>
+		/// Set 2x2 matrices
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrices to set</param>
+		void SetMatrices2x2(const ShaderVar var, std::initializer_list<Matrix2x2<float>> mat);
 
 		/// <summary>
 		/// Set 2x2 matrices
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrices to set</param>
-		void SetMatrices2x2(std::string name, std::initializer_list<Matrix2x2<float>> mat);
+		void SetMatrices2x2(const std::string& name, std::initializer_list<Matrix2x2<float>> mat);
+
+		/// <summary>
+		/// Set 3x3 matrices
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrices to set</param>
+		void SetMatrices3x3(const ShaderVar var, std::initializer_list<Matrix3x3<float>> mat);
 
 		/// <summary>
 		/// Set 3x3 matrices
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrices to set</param>
-		void SetMatrices3x3(std::string name, std::initializer_list<Matrix3x3<float>> mat);
+		void SetMatrices3x3(const std::string& name, std::initializer_list<Matrix3x3<float>> mat);
+
+		/// <summary>
+		/// Set 4x4 matrices
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrices to set</param>
+		void SetMatrices4x4(const ShaderVar var, std::initializer_list<Matrix4x4<float>> mat);
 
 		/// <summary>
 		/// Set 4x4 matrices
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrices to set</param>
-		void SetMatrices4x4(std::string name, std::initializer_list<Matrix4x4<float>> mat);
+		void SetMatrices4x4(const std::string& name, std::initializer_list<Matrix4x4<float>> mat);
+
+		/// <summary>
+		/// Set 2x3 matrices
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrices to set</param>
+		void SetMatrices2x3(const ShaderVar var, std::initializer_list<Matrix2x3<float>> mat);
 
 		/// <summary>
 		/// Set 2x3 matrices
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrices to set</param>
-		void SetMatrices2x3(std::string name, std::initializer_list<Matrix2x3<float>> mat);
+		void SetMatrices2x3(const std::string& name, std::initializer_list<Matrix2x3<float>> mat);
+
+		/// <summary>
+		/// Set 3x2 matrices
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrices to set</param>
+		void SetMatrices3x2(const ShaderVar var, std::initializer_list<Matrix3x2<float>> mat);
 
 		/// <summary>
 		/// Set 3x2 matrices
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrices to set</param>
-		void SetMatrices3x2(std::string name, std::initializer_list<Matrix3x2<float>> mat);
+		void SetMatrices3x2(const std::string& name, std::initializer_list<Matrix3x2<float>> mat);
+
+		/// <summary>
+		/// Set 2x4 matrices
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrices to set</param>
+		void SetMatrices2x4(const ShaderVar var, std::initializer_list<Matrix2x4<float>> mat);
 
 		/// <summary>
 		/// Set 2x4 matrices
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrices to set</param>
-		void SetMatrices2x4(std::string name, std::initializer_list<Matrix2x4<float>> mat);
+		void SetMatrices2x4(const std::string& name, std::initializer_list<Matrix2x4<float>> mat);
+
+		/// <summary>
+		/// Set 4x2 matrices
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrices to set</param>
+		void SetMatrices4x2(const ShaderVar var, std::initializer_list<Matrix4x2<float>> mat);
 
 		/// <summary>
 		/// Set 4x2 matrices
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrices to set</param>
-		void SetMatrices4x2(std::string name, std::initializer_list<Matrix4x2<float>> mat);
+		void SetMatrices4x2(const std::string& name, std::initializer_list<Matrix4x2<float>> mat);
+
+		/// <summary>
+		/// Set 3x4 matrices
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrices to set</param>
+		void SetMatrices3x4(const ShaderVar var, std::initializer_list<Matrix3x4<float>> mat);
 
 		/// <summary>
 		/// Set 3x4 matrices
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrices to set</param>
-		void SetMatrices3x4(std::string name, std::initializer_list<Matrix3x4<float>> mat);
+		void SetMatrices3x4(const std::string& name, std::initializer_list<Matrix3x4<float>> mat);
+
+		/// <summary>
+		/// Set 4x3 matrices
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="mat">Matrices to set</param>
+		void SetMatrices4x3(const ShaderVar var, std::initializer_list<Matrix4x3<float>> mat);
 
 		/// <summary>
 		/// Set 4x3 matrices
 		/// </summary>
 		/// <param name="name">Name of variable</param>
 		/// <param name="mat">Matrices to set</param>
-		void SetMatrices4x3(std::string name, std::initializer_list<Matrix4x3<float>> mat);
-		
+		void SetMatrices4x3(const std::string& name, std::initializer_list<Matrix4x3<float>> mat);
+
 		// <summary>
 		/// Start sprite draw
 		/// </summary>
@@ -418,15 +919,92 @@ namespace Violet {
 		/// </summary>
 		static void Unset();
 
+		/// <summary>
+		/// Create a shader program (from the cache if possible)
+		/// </summary>
+		/// <param name="vertexCode">Vertex shader code</param>
+		/// <param name="fragCode">Fragment shader code</param>
+		/// <param name="cached">Loaded from the cache flag</param>
+		/// <param name="cacheKey">Cache key</param>
+		/// <returns>Program ID</returns>
+		static Ptr CreateProgram(const std::string& vertexCode, const std::string& fragCode, bool& cached, U64& cacheKey);
+
+		/// <summary>
+		/// Update a variable's shadow copy
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="data">Value to set</param>
+		/// <param name="size">Value size</param>
+		/// <returns>Variable location if the value changed, -1 if it didn't (or the variable isn't used)</returns>
+		int UpdateVariable(const ShaderVar var, const void* data, const size_t size);
+
+		/// <summary>
+		/// Set a variable (queued for the render thread if it's running and this isn't it)
+		/// </summary>
+		/// <param name="var">Variable</param>
+		/// <param name="type">Variable type</param>
+		/// <param name="data">Value to set</param>
+		/// <param name="size">Value size</param>
+		void SetVariable(const ShaderVar var, const ShaderVarType type, const void* data, const size_t size);
+
+		/// <summary>
+		/// Upload a variable's value to the active program
+		/// </summary>
+		/// <param name="location">Variable location</param>
+		/// <param name="type">Variable type</param>
+		/// <param name="data">Value to set</param>
+		/// <param name="size">Value size</param>
+		static void UploadVariable(const int location, const ShaderVarType type, const void* data, const size_t size);
+
+		/// <summary>
+		/// Look up variables in the current program again and set their last values to it
+		/// </summary>
+		void RestoreVariables();
+
+		/// <summary>
+		/// Shader variable
+		/// </summary>
+		struct Variable {
+			/// <summary>
+			/// Location
+			/// </summary>
+			int location{ -1 };
+
+			/// <summary>
+			/// Shadow copy of the value last set
+			/// </summary>
+			std::vector<U8> shadow;
+
+			/// <summary>
+			/// Set flag (the shadow copy is only valid once the value was set)
+			/// </summary>
+			bool set{ false };
+		};
+
 		/// <summary>
 		/// Variables
 		/// </summary>
-		std::unordered_map<std::string, int> variables;
+		std::vector<Variable> variables;
+
+		/// <summary>
+		/// Shader cache key of the current program
+		/// </summary>
+		U64 cacheKey{ 0 };
+
+		/// <summary>
+		/// Variable indices by name
+		/// </summary>
+		std::unordered_map<std::string, int> variableIDs;
+
+		/// <summary>
+		/// Uniform block bindings by name
+		/// </summary>
+		std::unordered_map<std::string, int> uniformBlocks;
 
 		/// <summary>
-		/// Active shader
+		/// Active shader (per thread, as each thread has its own context)
 		/// </summary>
-		static Shader* active;
+		static thread_local Shader* active;
 	};
 
 }
@@ -0,0 +1,189 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+namespace Violet {
+
+	/// <summary>
+	/// Cache file signature
+	/// </summary>
+	static const char* cacheSignature = "VSHC";
+
+	/// <summary>
+	/// Cache file version
+	/// </summary>
+	constexpr U32 CacheVersion = 1;
+
+	/// <summary>
+	/// Cache file name
+	/// </summary>
+	std::string ShaderCache::fileName{ "ShaderCache.bin" };
+
+	/// <summary>
+	/// Graphics driver string
+	/// </summary>
+	std::string ShaderCache::driverID{ "" };
+
+	/// <summary>
+	/// Supported flag
+	/// </summary>
+	bool ShaderCache::supported{ false };
+
+	/// <summary>
+	/// Changed flag
+	/// </summary>
+	bool ShaderCache::dirty{ false };
+
+	/// <summary>
+	/// Cache entries
+	/// </summary>
+	std::unordered_map<U64, ShaderCache::Entry> ShaderCache::entries;
+
+	/// <summary>
+	/// Shader cache statistics
+	/// </summary>
+	ShaderCacheStats ShaderCache::stats;
+
+	/// <summary>
+	/// Set cache file name (must be set before the engine is run)
+	/// </summary>
+	/// <param name="fileName">File name (empty = disable the cache)</param>
+	void ShaderCache::SetFileName(std::string fileName) {
+		ShaderCache::fileName = fileName;
+	}
+
+	/// <summary>
+	/// Get cache file name
+	/// </summary>
+	/// <returns>File name</returns>
+	std::string ShaderCache::GetFileName() {
+		return fileName;
+	}
+
+	/// <summary>
+	/// Get shader cache statistics
+	/// </summary>
+	/// <returns>Shader cache statistics</returns>
+	ShaderCacheStats ShaderCache::GetStats() {
+		return stats;
+	}
+
+	/// <summary>
+	/// Load cache file
+	/// </summary>
+	void ShaderCache::Load() {
+		entries.clear();
+		dirty = false;
+		stats = {};
+		supported = !fileName.empty() && CheckSupport();
+		if (!supported) {
+			return;
+		}
+		driverID = GetDriverID();
+
+		try {
+			std::shared_ptr<BinaryFile> file = Engine::OpenBinaryFile(fileName, true);
+			if (file->ReadString(4) != cacheSignature || file->ReadUInt32() != CacheVersion) {
+				Engine::DebugMessage("SHADER CACHE:        INVALID (" + fileName + ")");
+				return;
+			}
+
+			// Programs built by another driver are no use, so start over
+			if (file->ReadString() != driverID) {
+				Engine::DebugMessage("SHADER CACHE:        DRIVER CHANGED (" + fileName + ")");
+				dirty = true;
+				return;
+			}
+
+			U32 count = file->ReadUInt32();
+			for (U32 i = 0; i < count; ++i) {
+				U64 key = file->ReadUInt64();
+				Entry entry;
+				entry.format = file->ReadUInt32();
+				entry.binary.resize(file->ReadUInt32());
+				file->ReadData(entry.binary.data(), entry.binary.size());
+				entries[key] = std::move(entry);
+			}
+			Engine::DebugMessage("SHADER CACHE:        " + std::to_string(entries.size()) + " PROGRAMS (" + fileName + ")");
+		}
+		catch (const std::exception&) {
+			// No cache yet, or it's unreadable; it gets rebuilt as shaders are compiled
+			entries.clear();
+		}
+	}
+
+	/// <summary>
+	/// Save cache file (if anything was added)
+	/// </summary>
+	void ShaderCache::Save() {
+		if (!supported || !dirty) {
+			return;
+		}
+
+		try {
+			std::shared_ptr<BinaryFile> file = Engine::OpenBinaryFile(fileName, false);
+			file->WriteString(cacheSignature, false);
+			file->WriteUInt32(CacheVersion);
+			file->WriteString(driverID);
+			file->WriteUInt32(static_cast<U32>(entries.size()));
+			for (const std::pair<const U64, Entry>& entry : entries) {
+				file->WriteUInt64(entry.first);
+				file->WriteUInt32(entry.second.format);
+				file->WriteUInt32(static_cast<U32>(entry.second.binary.size()));
+				file->WriteData(entry.second.binary.data(), entry.second.binary.size());
+			}
+			dirty = false;
+		}
+		catch (const std::exception& e) {
+			// Not being able to cache shaders isn't fatal
+			Engine::DebugMessage("SHADER CACHE:        " + std::string(e.what()));
+		}
+	}
+
+	/// <summary>
+	/// Get cache key for shader code
+	/// </summary>
+	/// <param name="vertexCode">Vertex shader code</param>
+	/// <param name="fragCode">Fragment shader code</param>
+	/// <returns>Cache key</returns>
+	U64 ShaderCache::GetKey(const std::string& vertexCode, const std::string& fragCode) {
+		// 64-bit FNV-1a hash of the driver and both shaders, including their terminators
+		// so that moving code from one shader to the other changes the key
+		U64 hash = 0xCBF29CE484222325ULL;
+		const std::string* strs[] = { &driverID, &vertexCode, &fragCode };
+		for (const std::string* str : strs) {
+			for (size_t i = 0; i <= str->length(); ++i) {
+				hash ^= static_cast<U8>(str->c_str()[i]);
+				hash *= 0x100000001B3ULL;
+			}
+		}
+		return hash;
+	}
+
+	/// <summary>
+	/// Add a created shader to the statistics
+	/// </summary>
+	/// <param name="time">Time taken to create it (in milliseconds)</param>
+	/// <param name="cached">Loaded from the cache flag</param>
+	void ShaderCache::AddShader(const double time, const bool cached) {
+		++stats.shaders;
+		if (cached) {
+			++stats.cached;
+		}
+		stats.time += time;
+	}
+
+	/// <summary>
+	/// Remove a program from the cache
+	/// </summary>
+	/// <param name="key">Cache key</param>
+	void ShaderCache::RemoveProgram(const U64 key) {
+		if (entries.erase(key) > 0) {
+			dirty = true;
+		}
+	}
+
+}
@@ -0,0 +1,170 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#ifndef VIOLET_SHADER_CACHE_HPP
+#define VIOLET_SHADER_CACHE_HPP
+
+namespace Violet {
+
+	/// <summary>
+	/// Shader cache statistics
+	/// </summary>
+	struct ShaderCacheStats {
+		/// <summary>
+		/// Number of shaders created
+		/// </summary>
+		U32 shaders{ 0 };
+
+		/// <summary>
+		/// Number of shaders loaded from the cache
+		/// </summary>
+		U32 cached{ 0 };
+
+		/// <summary>
+		/// Time spent creating shaders (in milliseconds)
+		/// </summary>
+		double time{ 0 };
+	};
+
+	/// <summary>
+	/// Shader cache (keeps linked shader programs on disk so that they don't have to be compiled again)
+	/// </summary>
+	class ShaderCache {
+	public:
+		/// <summary>
+		/// Set cache file name (must be set before the engine is run)
+		/// </summary>
+		/// <param name="fileName">File name (empty = disable the cache)</param>
+		static void SetFileName(std::string fileName);
+
+		/// <summary>
+		/// Get cache file name
+		/// </summary>
+		/// <returns>File name</returns>
+		static std::string GetFileName();
+
+		/// <summary>
+		/// Get shader cache statistics
+		/// </summary>
+		/// <returns>Shader cache statistics</returns>
+		static ShaderCacheStats GetStats();
+
+		// Friend classes
+		friend class Graphics;
+		friend class Shader;
+
+	private:
+		/// <summary>
+		/// Cache entry
+		/// </summary>
+		struct Entry {
+			/// <summary>
+			/// Program binary format
+			/// </summary>
+			U32 format{ 0 };
+
+			/// <summary>
+			/// Program binary
+			/// </summary>
+			std::vector<U8> binary;
+		};
+
+		/// <summary>
+		/// Load cache file
+		/// </summary>
+		static void Load();
+
+		/// <summary>
+		/// Save cache file (if anything was added)
+		/// </summary>
+		static void Save();
+
+		/// <summary>
+		/// Get cache key for shader code
+		/// </summary>
+		/// <param name="vertexCode">Vertex shader code</param>
+		/// <param name="fragCode">Fragment shader code</param>
+		/// <returns>Cache key</returns>
+		static U64 GetKey(const std::string& vertexCode, const std::string& fragCode);
+
+		/// <summary>
+		/// Add a created shader to the statistics
+		/// </summary>
+		/// <param name="time">Time taken to create it (in milliseconds)</param>
+		/// <param name="cached">Loaded from the cache flag</param>
+		static void AddShader(const double time, const bool cached);
+
+		/// <summary>
+		/// Check if the graphics API can provide program binaries (and set up the functions for them)
+		/// </summary>
+		/// <returns>True if supported, false if not</returns>
+		static bool CheckSupport();
+
+		/// <summary>
+		/// Get a string identifying the graphics driver
+		/// </summary>
+		/// <returns>Driver string</returns>
+		static std::string GetDriverID();
+
+		/// <summary>
+		/// Create a program from the cache
+		/// </summary>
+		/// <param name="key">Cache key</param>
+		/// <returns>Program ID (0 if not cached, or the driver rejected the binary)</returns>
+		static Ptr LoadProgram(const U64 key);
+
+		/// <summary>
+		/// Prepare a program for being cached (must be done before linking)
+		/// </summary>
+		/// <param name="program">Program ID</param>
+		static void PrepareProgram(const Ptr program);
+
+		/// <summary>
+		/// Add a linked program to the cache
+		/// </summary>
+		/// <param name="program">Program ID</param>
+		/// <param name="key">Cache key</param>
+		static void SaveProgram(const Ptr program, const U64 key);
+
+		/// <summary>
+		/// Remove a program from the cache
+		/// </summary>
+		/// <param name="key">Cache key</param>
+		static void RemoveProgram(const U64 key);
+
+		/// <summary>
+		/// Cache file name
+		/// </summary>
+		static std::string fileName;
+
+		/// <summary>
+		/// Graphics driver string
+		/// </summary>
+		static std::string driverID;
+
+		/// <summary>
+		/// Supported flag
+		/// </summary>
+		static bool supported;
+
+		/// <summary>
+		/// Changed flag
+		/// </summary>
+		static bool dirty;
+
+		/// <summary>
+		/// Cache entries
+		/// </summary>
+		static std::unordered_map<U64, Entry> entries;
+
+		/// <summary>
+		/// Shader cache statistics
+		/// </summary>
+		static ShaderCacheStats stats;
+	};
+
+}
+
+#endif // VIOLET_SHADER_CACHE_HPP
@@ -70,38 +70,71 @@ namespace Violet {
 	/// <param name="frame">Frame ID</param>
 	/// <param name="spriteParams">Sprite draw parameters</param>
 	void Sheet::Draw(std::initializer_list<TextureBind> textures, const int frame, SpriteParams spriteParams) {
+		AllocScope allocScope(AllocTag::Graphics);
 		if (frame >= 0 && frame < frames.size()) {
 			std::shared_ptr<std::vector<TextureBind>> textureBinds = std::make_shared<std::vector<TextureBind>>();
 			for (int i = 0; i < textures.size(); ++i) {
 				textureBinds->push_back(textures.begin()[i]);
 			}
+			DrawBinds(textureBinds, 0, frame, spriteParams);
+		}
+	}
 
-			SpriteData sprite = {
-				{
-					frames[frame].bounds.x,
-					frames[frame].bounds.y,
-					frames[frame].bounds.w,
-					frames[frame].bounds.h,
-				},
-				spriteParams.layer,
-				spriteParams.pos,
-				frames[frame].origin,
-				spriteParams.scale,
-				spriteParams.angle,
-				spriteParams.color,
-				spriteParams.shader,
-				spriteParams.userData };
-
-			Graphics::AddSprite(textureBinds, sprite);
+	/// <summary>
+	/// Draw a sprite from a texture array layer (sheets of the same size can share an array, so that they're batched together)
+	/// </summary>
+	/// <param name="texture">Texture array</param>
+	/// <param name="arrayLayer">Array layer</param>
+	/// <param name="filter">Texture filter</param>
+	/// <param name="frame">Frame ID</param>
+	/// <param name="spriteParams">Sprite draw parameters</param>
+	void Sheet::Draw(std::shared_ptr<Texture> texture, const int arrayLayer, TextureFilter filter, const int frame, SpriteParams spriteParams) {
+		AllocScope allocScope(AllocTag::Graphics);
+		if (arrayLayer < 0 || arrayLayer >= texture->GetArrayLayers()) {
+			Engine::Error("Invalid texture array layer \"" + std::to_string(arrayLayer) + "\".");
+		}
+		if (frame >= 0 && frame < frames.size()) {
+			std::shared_ptr<std::vector<TextureBind>> textureBinds = std::make_shared<std::vector<TextureBind>>();
+			textureBinds->push_back({ texture, 0, filter });
+			DrawBinds(textureBinds, arrayLayer, frame, spriteParams);
 		}
 	}
 
+	/// <summary>
+	/// Draw a sprite
+	/// </summary>
+	/// <param name="textureBinds">Texture bindings</param>
+	/// <param name="arrayLayer">Texture array layer</param>
+	/// <param name="frame">Frame ID</param>
+	/// <param name="spriteParams">Sprite draw parameters</param>
+	void Sheet::DrawBinds(std::shared_ptr<std::vector<TextureBind>> textureBinds, const int arrayLayer, const int frame, SpriteParams spriteParams) {
+		SpriteData sprite = {
+			{
+				frames[frame].bounds.x,
+				frames[frame].bounds.y,
+				frames[frame].bounds.w,
+				frames[frame].bounds.h,
+			},
+			spriteParams.layer,
+			spriteParams.pos,
+			frames[frame].origin,
+			spriteParams.scale,
+			spriteParams.angle,
+			spriteParams.color,
+			spriteParams.shader,
+			spriteParams.userData };
+		sprite.arrayLayer = arrayLayer;
+
+		Graphics::AddSprite(textureBinds, sprite);
+	}
+
 	/// <summary>
 	/// Open sheet
 	/// </summary>
 	/// <param name="fileName">File name</param>
 	/// <returns>Opened sheet</returns>
 	std::shared_ptr<Sheet> Engine::OpenSheet(std::string fileName) {
+		AllocScope allocScope(AllocTag::Asset);
 		return std::shared_ptr<Sheet>(new Sheet(fileName));
 	}
 
@@ -35,11 +35,30 @@ namespace Violet {
 		/// <param name="spriteParams">Sprite draw parameters</param>
 		void Draw(std::initializer_list<TextureBind> textures, const int frame, SpriteParams spriteParams);
 
+		/// <summary>
+		/// Draw a sprite from a texture array layer (sheets of the same size can share an array, so that they're batched together)
+		/// </summary>
+		/// <param name="texture">Texture array</param>
+		/// <param name="arrayLayer">Array layer</param>
+		/// <param name="filter">Texture filter</param>
+		/// <param name="frame">Frame ID</param>
+		/// <param name="spriteParams">Sprite draw parameters</param>
+		void Draw(std::shared_ptr<Texture> texture, const int arrayLayer, TextureFilter filter, const int frame, SpriteParams spriteParams);
+
 		// Friend classes
 		friend class Engine;
 		friend class Map;
 
 	private:
+		/// <summary>
+		/// Draw a sprite
+		/// </summary>
+		/// <param name="textureBinds">Texture bindings</param>
+		/// <param name="arrayLayer">Texture array layer</param>
+		/// <param name="frame">Frame ID</param>
+		/// <param name="spriteParams">Sprite draw parameters</param>
+		void DrawBinds(std::shared_ptr<std::vector<TextureBind>> textureBinds, const int arrayLayer, const int frame, SpriteParams spriteParams);
+
 		/// <summary>
 		/// Sheet constructor
 		/// </summary>
@@ -10,7 +10,7 @@ namespace Violet {
 	/// <summary>
 	/// VSync flag
 	/// </summary>
-	bool Shell::vsync{ true };
+	std::atomic<bool> Shell::vsync{ true };
 
 	/// <summary>
 	/// Screen mode
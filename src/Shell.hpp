@@ -26,6 +26,8 @@ namespace Violet {
 		friend class Engine;
 		friend class EngineTimer;
 		friend class Graphics;
+		friend class Input;
+		friend class ShaderCache;
 		friend class Sound;
 
 		/// <summary>
@@ -39,11 +41,31 @@ namespace Violet {
 		/// <returns>True if running, false if not</returns>
 		static bool UpdateEvents();
 
+		/// <summary>
+		/// Sample input state
+		/// </summary>
+		static void UpdateInput();
+
+		/// <summary>
+		/// Bind default inputs
+		/// </summary>
+		static void BindDefaultInput();
+
 		/// <summary>
 		/// Update graphics start
 		/// </summary>
 		static void UpdateGraphicsStart();
 
+		/// <summary>
+		/// Make the render context current on the calling thread
+		/// </summary>
+		static void StartRenderContext();
+
+		/// <summary>
+		/// Release the render context from the calling thread
+		/// </summary>
+		static void StopRenderContext();
+
 		/// <summary>
 		/// Update graphics end
 		/// </summary>
@@ -96,18 +118,22 @@ namespace Violet {
 		static double GetTick();
 
 		/// <summary>
-		/// Mix sound buffer
+		/// Sleep the calling thread
+		/// </summary>
+		/// <param name="time">Time to sleep (in milliseconds, rounded down)</param>
+		static void Sleep(const double time);
+
+		/// <summary>
+		/// Get the address of a graphics API function
 		/// </summary>
-		/// <param name="inBuffer">Input buffer</param>
-		/// <param name="outBuffer">Output buffer</param>
-		/// <param name="length">Buffer length</param>
-		/// <param name="volume">Volume</param>
-		static void MixSound(S16* inBuffer, S16* outBuffer, const int length, const float volume);
+		/// <param name="name">Function name</param>
+		/// <returns>Function address (nullptr if not available)</returns>
+		static void* GetProcAddress(const char* name);
 
 		/// <summary>
 		/// VSync flag
 		/// </summary>
-		static bool vsync;
+		static std::atomic<bool> vsync;
 
 		/// <summary>
 		/// Screen mode
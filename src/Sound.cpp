@@ -18,27 +18,107 @@ namespace Violet {
 	std::unique_ptr<std::vector<std::shared_ptr<SoundSource>>> Sound::musicStack;
 
 	/// <summary>
-	/// Music commands
+	/// Music commands (queued by the game)
 	/// </summary>
 	std::unique_ptr<std::vector<Sound::MusicCmd>> Sound::musicCmds;
 
 	/// <summary>
-	/// Music fade mode
+	/// Music commands (being processed by the mixer)
 	/// </summary>
-	Sound::MusicFadeMode Sound::musicFadeMode{ MusicFadeMode::None };
+	std::unique_ptr<std::vector<Sound::MusicCmd>> Sound::musicQueue;
+
+	/// <summary>
+	/// Songs fading out in the background
+	/// </summary>
+	std::unique_ptr<std::vector<std::shared_ptr<SoundSource>>> Sound::musicFades;
+
+	/// <summary>
+	/// Song that must finish fading out before the next music command is applied
+	/// </summary>
+	std::shared_ptr<SoundSource> Sound::musicWait{ nullptr };
 
 	/// <summary>
 	/// Sound pool
 	/// </summary>
 	std::unique_ptr<std::vector<std::shared_ptr<SoundSource>>> Sound::sfx;
 
+	/// <summary>
+	/// Sound effects queued by the game
+	/// </summary>
+	std::unique_ptr<std::vector<std::shared_ptr<SoundSource>>> Sound::sfxQueue;
+
+	/// <summary>
+	/// Positional sound effects (game side)
+	/// </summary>
+	std::unique_ptr<std::vector<std::weak_ptr<SoundSource>>> Sound::positionalSFX;
+
+	/// <summary>
+	/// Listener origin (game side)
+	/// </summary>
+	Vec2D<float> Sound::listenerOrigin{ 0, 0 };
+
+	/// <summary>
+	/// Positional sound effect range (game side)
+	/// </summary>
+	Vec2D<float> Sound::sfxRange{ 0, 0 };
+
+	/// <summary>
+	/// Listener position (sent to the mixer, guarded by the command mutex)
+	/// </summary>
+	Vec2D<float> Sound::sentListenerPos{ 0, 0 };
+
+	/// <summary>
+	/// Distance for full panning (sent to the mixer, guarded by the command mutex)
+	/// </summary>
+	float Sound::sentPanDist{ 1 };
+
+	/// <summary>
+	/// Positional sound effect range (sent to the mixer, guarded by the command mutex)
+	/// </summary>
+	Vec2D<float> Sound::sentSFXRange{ 1, 2 };
+
+	/// <summary>
+	/// Listener position (mixer side)
+	/// </summary>
+	Vec2D<float> Sound::mixListenerPos{ 0, 0 };
+
+	/// <summary>
+	/// Distance for full panning (mixer side)
+	/// </summary>
+	float Sound::mixPanDist{ 1 };
+
+	/// <summary>
+	/// Positional sound effect range (mixer side)
+	/// </summary>
+	Vec2D<float> Sound::mixSFXRange{ 1, 2 };
+
+	/// <summary>
+	/// Mix buffer
+	/// </summary>
+	std::unique_ptr<float[]> Sound::mixBuffer;
+
+	/// <summary>
+	/// Command queue mutex
+	/// </summary>
+	std::mutex Sound::cmdMutex;
+
+	/// <summary>
+	/// Output sample rate
+	/// </summary>
+	int Sound::sampleRate{ SoundSampleRate };
+
 	/// <summary>
 	/// Initialize sound data
 	/// </summary>
 	void Sound::Initialize() {
 		musicStack = std::make_unique<std::vector<std::shared_ptr<SoundSource>>>();
 		musicCmds = std::make_unique<std::vector<Sound::MusicCmd>>();
+		musicQueue = std::make_unique<std::vector<Sound::MusicCmd>>();
+		musicFades = std::make_unique<std::vector<std::shared_ptr<SoundSource>>>();
 		sfx = std::make_unique<std::vector<std::shared_ptr<SoundSource>>>();
+		sfxQueue = std::make_unique<std::vector<std::shared_ptr<SoundSource>>>();
+		positionalSFX = std::make_unique<std::vector<std::weak_ptr<SoundSource>>>();
+		mixBuffer = std::make_unique<float[]>(SoundBufferLen / sizeof(S16));
 	}
 
 	/// <summary>
@@ -48,10 +128,20 @@ namespace Violet {
 		mainMusic = nullptr;
 		musicStack->clear();
 		musicStack = nullptr;
+		musicWait = nullptr;
 		musicCmds->clear();
 		musicCmds = nullptr;
+		musicQueue->clear();
+		musicQueue = nullptr;
+		musicFades->clear();
+		musicFades = nullptr;
 		sfx->clear();
 		sfx = nullptr;
+		sfxQueue->clear();
+		sfxQueue = nullptr;
+		positionalSFX->clear();
+		positionalSFX = nullptr;
+		mixBuffer = nullptr;
 	}
 
 	/// <summary>
@@ -59,147 +149,422 @@ namespace Violet {
 	/// </summary>
 	/// <param name="buffer">Output sound buffer</param>
 	void Sound::Update(S16* const buffer) {
-		if (musicCmds && musicStack && sfx) {
+		AllocScope allocScope(AllocTag::Sound);
+		if (!musicCmds || !musicStack || !sfx) {
 			memset(buffer, 0, SoundBufferLen);
+			return;
+		}
+		double startTick = Shell::GetTick();
+
+		const int samples = SoundBufferLen / sizeof(S16);
+		memset(mixBuffer.get(), 0, samples * sizeof(float));
+
+		// Take in new commands from the game
+		{
+			std::lock_guard<std::mutex> lock(cmdMutex);
+			musicQueue->insert(musicQueue->end(), musicCmds->begin(), musicCmds->end());
+			musicCmds->clear();
+			sfx->insert(sfx->end(), sfxQueue->begin(), sfxQueue->end());
+			sfxQueue->clear();
+			ReceivePositions();
+		}
+
+		// Music
+		ProcessMusicCmds();
+
+		// Songs fading out
+		size_t i = 0;
+		while (i < musicFades->size()) {
+			SoundSource* fade = musicFades->at(i).get();
+			if (fade->Stream()) {
+				MixSource(fade);
+			}
+			if (fade->ended || (fade->volume <= 0 && fade->volumeStep == 0)) {
+				musicFades->erase(musicFades->begin() + i);
+			}
+			else {
+				++i;
+			}
+		}
+
+		// Start the next song right away if the current one just finished fading out
+		if (musicWait) {
+			ProcessMusicCmds();
+		}
 
-			// Music
-			MusicCmd musicCmd = { };
-			if (musicCmds->size() > 0) {
-				musicCmd = musicCmds->at(0);
+		std::shared_ptr<SoundSource> song = GetCurrentMusic();
+		if (song && song != musicWait) {
+			if (song->Stream()) {
+				MixSource(song.get());
+			}
+			else if (song == mainMusic) {
+				// Delete song if no longer playing
+				mainMusic = nullptr;
+			}
+			else {
+				musicQueue->push_back({ MusicCmdType::Pop, nullptr });
 			}
+		}
 
-			std::shared_ptr<SoundSource> song = mainMusic;
-			if (musicStack->size() > 0) {
-				song = musicStack->at(musicStack->size() - 1);
+		// SFX
+		i = 0;
+		while (i < sfx->size()) {
+			SoundSource* source = sfx->at(i).get();
+			bool active = true;
+
+			if (source->positional && !UpdatePan(source)) {
+				// Inaudible, so just keep time
+				active = source->Skip(SoundBufferLen / (sizeof(S16) * 2));
 			}
+			else if (source->ApplySkip() && source->Stream()) {
+				if (source->positional) {
+					MixPositional(source);
+				}
+				else {
+					MixSource(source);
+				}
+			}
+			else {
+				active = false;
+			}
+
+			if (active) {
+				++i;
+			}
+			else {
+				sfx->erase(sfx->begin() + i);
+			}
+		}
+
+		// Output
+		for (int j = 0; j < samples; ++j) {
+			float sample = mixBuffer[j];
+			if (sample > 32767.0f) {
+				sample = 32767.0f;
+			}
+			else if (sample < -32768.0f) {
+				sample = -32768.0f;
+			}
+			buffer[j] = static_cast<S16>(sample);
+		}
+
+		std::lock_guard<std::mutex> lock(cmdMutex);
+		++deviceStats.blocks;
+		deviceStats.time += Shell::GetTick() - startTick;
+	}
+
+	/// <summary>
+	/// Process queued music commands
+	/// </summary>
+	void Sound::ProcessMusicCmds() {
+		while (musicQueue->size() > 0) {
+			MusicCmd musicCmd = musicQueue->at(0);
 
-			bool playing = false;
-			if (song) {
-				playing = song->Stream();
-				if (playing) {
-					if (song->fadeIn) {
-						if (song->volume < 1) {
-							song->volume += 0.05f;
-							if (song->volume >= 1) {
-								song->volume = 1;
-								song->fadeIn = false;
-							}
-							else {
-								// Don't process music command until fully faded in
-								musicCmd.type = MusicCmdType::None;
-							}
-						}
+			if (musicWait) {
+				// Wait for the current song to finish fading out
+				for (auto& fade : *musicFades) {
+					if (fade == musicWait) {
+						return;
 					}
-					Shell::MixSound(song->streamBuffer, buffer, SoundBufferLen, song->volume);
 				}
+				musicWait = nullptr;
+				ApplyMusicCmd(musicCmd, false);
+				musicQueue->erase(musicQueue->begin());
+				continue;
 			}
 
-			if (musicCmd.type != MusicCmdType::None) {
-				if (musicCmd.type == MusicCmdType::SetMain && song != mainMusic) {
-					// Don't interrupt stack if just setting a new main song
+			std::shared_ptr<SoundSource> song = GetCurrentMusic();
+			if ((musicCmd.type == MusicCmdType::SetMain && song != mainMusic) ||
+				(musicCmd.type == MusicCmdType::Pop && musicStack->size() == 0)) {
+				// Don't interrupt stack if just setting a new main song
+				if (musicCmd.type == MusicCmdType::SetMain) {
 					mainMusic = musicCmd.sound;
-					musicCmds->erase(musicCmds->begin());
 				}
-				else {
-					if (musicCmd.curFade && playing && song->volume > 0 &&
-						!(musicCmd.type == MusicCmdType::Pop && song == mainMusic)) {
-						if (song->volume > 0) {
-							song->volume -= 0.05f;
-							if (song->volume <= 0) {
-								song->volume = 0;
-								playing = false;
-							}
-						}
-					}
-					else {
-						playing = false;
-					}
+				musicQueue->erase(musicQueue->begin());
+				continue;
+			}
 
-					bool checkFade = false;
-					switch (musicCmd.type) {
-					case MusicCmdType::Play:
-						if (!playing) {
-							mainMusic = musicCmd.sound;
-							musicStack->clear();
-							checkFade = true;
-						}
-						break;
-
-					case MusicCmdType::SetMain:
-						if (!playing) {
-							mainMusic = musicCmd.sound;
-							checkFade = true;
-						}
-						break;
-
-					case MusicCmdType::Push:
-						if (!playing) {
-							musicStack->push_back(musicCmd.sound);
-							checkFade = true;
-						}
-						break;
-
-					case MusicCmdType::Pop:
-						if (!playing) {
-							if (musicStack->size() > 0) {
-								musicStack->pop_back();
-								if (musicStack->size() > 0) {
-									musicCmd.sound = musicStack->at(musicStack->size() - 1);
-								}
-								else {
-									musicCmd.sound = mainMusic;
-								}
-								checkFade = true;
-							}
-						}
-						break;
-
-					case MusicCmdType::Stop:
-						if (!playing) {
-							mainMusic = nullptr;
-							musicStack->clear();
-						}
-						break;
-					}
+			if (song && !musicCmd.crossfade && musicCmd.fadeOut > 0 && !song->ended && song->volume > 0) {
+				// Fade the current song out before moving on
+				FadeOutMusic(song, musicCmd.fadeOut);
+				musicWait = song;
+				continue;
+			}
 
-					if (!playing) {
-						if (checkFade && musicCmd.sound) {
-							if (musicCmd.nextFade) {
-								musicCmd.sound->fadeIn = true;
-								musicCmd.sound->volume = 0;
-							}
-							else {
-								musicCmd.sound->volume = 1;
-							}
-						}
-						musicCmds->erase(musicCmds->begin());
-					}
-				}
+			ApplyMusicCmd(musicCmd, true);
+			musicQueue->erase(musicQueue->begin());
+		}
+	}
+
+	/// <summary>
+	/// Apply a music command
+	/// </summary>
+	/// <param name="cmd">Music command</param>
+	/// <param name="fadeCurrent">Fade out current song flag</param>
+	void Sound::ApplyMusicCmd(const MusicCmd& cmd, const bool fadeCurrent) {
+		std::shared_ptr<SoundSource> prevSong = GetCurrentMusic();
+
+		switch (cmd.type) {
+		case MusicCmdType::Play:
+			mainMusic = cmd.sound;
+			musicStack->clear();
+			break;
+
+		case MusicCmdType::SetMain:
+			mainMusic = cmd.sound;
+			break;
+
+		case MusicCmdType::Push:
+			musicStack->push_back(cmd.sound);
+			break;
+
+		case MusicCmdType::Pop:
+			if (musicStack->size() > 0) {
+				musicStack->pop_back();
 			}
-			else if (!playing) {
-				// Delete song if no longer playing
-				if (song == mainMusic) {
-					song = nullptr;
+			break;
+
+		case MusicCmdType::Stop:
+			mainMusic = nullptr;
+			musicStack->clear();
+			break;
+
+		default:
+			break;
+		}
+
+		std::shared_ptr<SoundSource> nextSong = GetCurrentMusic();
+		if (prevSong == nextSong) {
+			return;
+		}
+
+		if (prevSong && fadeCurrent) {
+			FadeOutMusic(prevSong, cmd.fadeOut);
+		}
+
+		if (nextSong) {
+			// Take the song back if it was still fading out
+			bool fading = false;
+			for (size_t i = 0; i < musicFades->size(); ++i) {
+				if (musicFades->at(i) == nextSong) {
+					musicFades->erase(musicFades->begin() + i);
+					fading = true;
+					break;
 				}
-				else if (musicStack->size() > 0) {
-					musicCmds->push_back({ MusicCmdType::Pop, nullptr });
+			}
+
+			if (cmd.fadeIn > 0) {
+				if (!fading) {
+					nextSong->volume = 0;
 				}
+				nextSong->Fade(1, cmd.fadeIn);
+			}
+			else {
+				nextSong->Fade(1, 0);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Get current song
+	/// </summary>
+	/// <returns>Current song</returns>
+	std::shared_ptr<SoundSource> Sound::GetCurrentMusic() {
+		if (musicStack->size() > 0) {
+			return musicStack->at(musicStack->size() - 1);
+		}
+		return mainMusic;
+	}
+
+	/// <summary>
+	/// Fade out a song in the background
+	/// </summary>
+	/// <param name="song">Song</param>
+	/// <param name="time">Fade out time (in milliseconds)</param>
+	void Sound::FadeOutMusic(std::shared_ptr<SoundSource> song, const int time) {
+		if (time <= 0 || song->ended) {
+			return;
+		}
+
+		song->Fade(0, time);
+		for (auto& fade : *musicFades) {
+			if (fade == song) {
+				return;
+			}
+		}
+		musicFades->push_back(song);
+	}
+
+	/// <summary>
+	/// Mix a sound source into the mix buffer
+	/// </summary>
+	/// <param name="source">Sound source</param>
+	void Sound::MixSource(SoundSource* const source) {
+		const int samples = SoundBufferLen / sizeof(S16);
+		const S16* in = source->streamBuffer;
+		float* out = mixBuffer.get();
+		float volume = source->volume;
+		float step = source->volumeStep;
+
+		if (step == 0) {
+			for (int i = 0; i < samples; ++i) {
+				out[i] += in[i] * volume;
 			}
+			return;
+		}
 
-			// SFX
-			int i = 0;
-			while (i < sfx->size()) {
-				S16* stream_buf = sfx->at(i)->streamBuffer;
-				if (!sfx->at(i)->Stream()) {
-					sfx->at(i) = nullptr;
-					sfx->erase(sfx->begin() + i);
+		// Ramp volume per sample frame
+		const float target = source->volumeTarget;
+		for (int i = 0; i < samples; i += 2) {
+			out[i] += in[i] * volume;
+			out[i + 1] += in[i + 1] * volume;
+
+			if (step != 0) {
+				volume += step;
+				if ((step > 0 && volume >= target) || (step < 0 && volume <= target)) {
+					volume = target;
+					step = 0;
 				}
-				else {
-					Shell::MixSound(stream_buf, buffer, SoundBufferLen, 1);
-					++i;
+			}
+		}
+
+		source->volume = volume;
+		source->volumeStep = step;
+	}
+
+	/// <summary>
+	/// Mix a positional sound source into the mix buffer
+	/// </summary>
+	/// <param name="source">Sound source</param>
+	void Sound::MixPositional(SoundSource* const source) {
+		const int frames = SoundBufferLen / (sizeof(S16) * 2);
+		const S16* in = source->streamBuffer;
+		float* out = mixBuffer.get();
+		float volume = source->volume;
+		float step = source->volumeStep;
+		const float target = source->volumeTarget;
+
+		// Ramp pan gains over the block to avoid zipper noise, and the volume per sample frame while fading
+		float l = source->panL;
+		float r = source->panR;
+		float stepL = (source->panTargetL - l) / frames;
+		float stepR = (source->panTargetR - r) / frames;
+
+		for (int i = 0; i < frames; ++i) {
+			out[i * 2] += in[i * 2] * l * volume;
+			out[i * 2 + 1] += in[i * 2 + 1] * r * volume;
+			l += stepL;
+			r += stepR;
+
+			if (step != 0) {
+				volume += step;
+				if ((step > 0 && volume >= target) || (step < 0 && volume <= target)) {
+					volume = target;
+					step = 0;
 				}
 			}
 		}
+
+		source->panL = source->panTargetL;
+		source->panR = source->panTargetR;
+		source->volume = volume;
+		source->volumeStep = step;
+	}
+
+	/// <summary>
+	/// Update a positional sound source's gains
+	/// </summary>
+	/// <param name="source">Sound source</param>
+	/// <returns>True if audible, false if culled</returns>
+	bool Sound::UpdatePan(SoundSource* const source) {
+		float dx = source->mixPos.x - mixListenerPos.x;
+		float dy = source->mixPos.y - mixListenerPos.y;
+		float dist = Math::Sqrt(dx * dx + dy * dy);
+
+		// Distance attenuation
+		float gain = 0;
+		if (dist <= mixSFXRange.x) {
+			gain = 1;
+		}
+		else if (dist < mixSFXRange.y) {
+			gain = (mixSFXRange.y - dist) / (mixSFXRange.y - mixSFXRange.x);
+			gain *= gain;
+		}
+
+		// Constant power panning
+		float pan = Math::Max(-1.0f, Math::Min(1.0f, dx / mixPanDist));
+		float angle = (pan + 1) * Pi / 4;
+		source->panTargetL = gain * Math::Min(1.0f, Math::Cos(angle) * 1.41421356f);
+		source->panTargetR = gain * Math::Min(1.0f, Math::Sin(angle) * 1.41421356f);
+		if (source->panL < 0) {
+			// First block, start at the right gains
+			source->panL = source->panTargetL;
+			source->panR = source->panTargetR;
+		}
+
+		// A source fading in counts at its target volume, so that it isn't culled before the fade gets going
+		float volume = (source->volumeStep > 0) ? source->volumeTarget : source->volume;
+		bool audible = (gain * volume > 1.0f / 32768.0f);
+		if (!audible && (source->culled || (source->panL == 0 && source->panR == 0))) {
+			source->culled = true;
+			source->panL = 0;
+			source->panR = 0;
+			return false;
+		}
+
+		if (source->culled) {
+			// Fade back in from silence
+			source->culled = false;
+			source->panL = 0;
+			source->panR = 0;
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// Send positions from the game to the mixer
+	/// </summary>
+	void Sound::UpdatePositions() {
+		if (!positionalSFX) {
+			return;
+		}
+
+		Size2D<int> viewSize = Graphics::GetViewSize();
+		float minDist = (sfxRange.x > 0) ? sfxRange.x : viewSize.w * 0.5f;
+		float maxDist = (sfxRange.y > 0) ? sfxRange.y : viewSize.w * 1.5f;
+
+		std::lock_guard<std::mutex> lock(cmdMutex);
+
+		sentListenerPos = { listenerOrigin.x + viewSize.w * 0.5f, listenerOrigin.y + viewSize.h * 0.5f };
+		sentPanDist = Math::Max(viewSize.w * 0.5f, 1.0f);
+		sentSFXRange = { minDist, Math::Max(maxDist, minDist + 1) };
+
+		size_t i = 0;
+		while (i < positionalSFX->size()) {
+			std::shared_ptr<SoundSource> source = positionalSFX->at(i).lock();
+			if (!source || source->ended) {
+				positionalSFX->erase(positionalSFX->begin() + i);
+			}
+			else {
+				source->sentPos = source->gamePos;
+				++i;
+			}
+		}
+	}
+
+	/// <summary>
+	/// Take in the positions last sent by the game (command mutex must be locked)
+	/// </summary>
+	void Sound::ReceivePositions() {
+		mixListenerPos = sentListenerPos;
+		mixPanDist = sentPanDist;
+		mixSFXRange = sentSFXRange;
+
+		for (auto& source : *sfx) {
+			if (source->positional) {
+				source->mixPos = source->sentPos;
+			}
+		}
 	}
 
 	/// <summary>
@@ -209,16 +574,44 @@ namespace Violet {
 	/// <param name="loop">Loop flag</param>
 	/// <returns>Created sound source</returns>
 	std::shared_ptr<SoundSource> Sound::PlaySound(std::string fileName, const bool loop) {
+		AllocScope allocScope(AllocTag::Sound);
 		std::shared_ptr<SoundSource> source = nullptr;
 
-		// Ogg
-		OggVorbis_File* vorbis_file = static_cast<OggVorbis_File*>(malloc(sizeof(OggVorbis_File)));
-		if (vorbis_file) {
-			if (ov_fopen(fileName.c_str(), vorbis_file) < 0) {
-				free(vorbis_file);
+		// Probe header
+		U8 header[36] = { 0 };
+		FILE* fp = nullptr;
+		fopen_s(&fp, fileName.c_str(), "rb");
+		if (fp) {
+			fread(header, 1, sizeof(header), fp);
+			fclose(fp);
+		}
+
+		if (memcmp(header, "RIFF", 4) == 0 && memcmp(header + 8, "WAVE", 4) == 0) {
+			// WAV
+			source = std::shared_ptr<SoundSourceWAV>(new SoundSourceWAV(fileName, loop));
+		}
+		else if (memcmp(header, "OggS", 4) == 0 && memcmp(header + 28, "OpusHead", 8) == 0) {
+#ifdef VIOLET_SOUND_OPUS
+			// Opus
+			OggOpusFile* opus_file = op_open_file(fileName.c_str(), nullptr);
+			if (opus_file) {
+				source = std::shared_ptr<SoundSourceOpus>(new SoundSourceOpus(fileName, opus_file, loop));
 			}
-			else {
-				source = std::shared_ptr<SoundSourceOgg>(new SoundSourceOgg(fileName, vorbis_file, loop));
+#else
+			Engine::Error("Opus support is not enabled for sound file \"" + fileName + "\"");
+			return nullptr;
+#endif
+		}
+		else if (memcmp(header, "OggS", 4) == 0) {
+			// Ogg
+			OggVorbis_File* vorbis_file = static_cast<OggVorbis_File*>(malloc(sizeof(OggVorbis_File)));
+			if (vorbis_file) {
+				if (ov_fopen(fileName.c_str(), vorbis_file) < 0) {
+					free(vorbis_file);
+				}
+				else {
+					source = std::shared_ptr<SoundSourceOgg>(new SoundSourceOgg(fileName, vorbis_file, loop));
+				}
 			}
 		}
 
@@ -235,11 +628,13 @@ namespace Violet {
 	/// </summary>
 	/// <param name="fileName">File name</param>
 	/// <param name="loop">Loop flag</param>
-	/// <param name="curFade">Fade current song out flag</param>
-	/// <param name="nextFade">Fade next song in flag</param>
-	void Sound::PlayMusic(std::string fileName, const bool loop, const bool curFade, const bool nextFade) {
+	/// <param name="fadeOut">Current song fade out time</param>
+	/// <param name="fadeIn">Next song fade in time</param>
+	/// <param name="crossfade">Crossfade flag (start the next song while the current one fades out)</param>
+	void Sound::PlayMusic(std::string fileName, const bool loop, const std::chrono::milliseconds fadeOut, const std::chrono::milliseconds fadeIn, const bool crossfade) {
 		std::shared_ptr<SoundSource> sound = PlaySound(fileName, loop);
-		musicCmds->push_back({ MusicCmdType::Play, sound, curFade, nextFade });
+		std::lock_guard<std::mutex> lock(cmdMutex);
+		musicCmds->push_back({ MusicCmdType::Play, sound, static_cast<int>(fadeOut.count()), static_cast<int>(fadeIn.count()), crossfade });
 	}
 
 	/// <summary>
@@ -247,19 +642,22 @@ namespace Violet {
 	/// </summary>
 	/// <param name="fileName">File name</param>
 	/// <param name="loop">Loop flag</param>
-	/// <param name="curFade">Fade current song out flag (only if current song is the main music)</param>
-	/// <param name="nextFade">Fade next song in flag (only if current song is the main music)</param>
-	void Sound::SetMainMusic(std::string fileName, const bool loop, const bool curFade, const bool nextFade) {
+	/// <param name="fadeOut">Current song fade out time (only if current song is the main music)</param>
+	/// <param name="fadeIn">Next song fade in time (only if current song is the main music)</param>
+	/// <param name="crossfade">Crossfade flag (only if current song is the main music)</param>
+	void Sound::SetMainMusic(std::string fileName, const bool loop, const std::chrono::milliseconds fadeOut, const std::chrono::milliseconds fadeIn, const bool crossfade) {
 		std::shared_ptr<SoundSource> sound = PlaySound(fileName, loop);
-		musicCmds->push_back({ MusicCmdType::SetMain, sound, curFade, nextFade });
+		std::lock_guard<std::mutex> lock(cmdMutex);
+		musicCmds->push_back({ MusicCmdType::SetMain, sound, static_cast<int>(fadeOut.count()), static_cast<int>(fadeIn.count()), crossfade });
 	}
 
 	/// <summary>
 	/// Stop music
 	/// </summary>
-	/// <param name="fadeOut">Fade out flag</param>
-	void Sound::StopMusic(const bool fadeOut) {
-		musicCmds->push_back({ MusicCmdType::Stop, nullptr, fadeOut, false });
+	/// <param name="fadeOut">Fade out time</param>
+	void Sound::StopMusic(const std::chrono::milliseconds fadeOut) {
+		std::lock_guard<std::mutex> lock(cmdMutex);
+		musicCmds->push_back({ MusicCmdType::Stop, nullptr, static_cast<int>(fadeOut.count()), 0, false });
 	}
 
 	/// <summary>
@@ -267,29 +665,90 @@ namespace Violet {
 	/// </summary>
 	/// <param name="fileName">File name</param>
 	/// <param name="loop">Loop flag</param>
-	/// <param name="curFade">Fade current song out flag</param>
-	/// <param name="nextFade">Fade next song in flag</param>
-	void Sound::PushMusic(std::string fileName, const bool loop, const bool curFade, const bool nextFade) {
+	/// <param name="fadeOut">Current song fade out time</param>
+	/// <param name="fadeIn">Next song fade in time</param>
+	/// <param name="crossfade">Crossfade flag (start the next song while the current one fades out)</param>
+	void Sound::PushMusic(std::string fileName, const bool loop, const std::chrono::milliseconds fadeOut, const std::chrono::milliseconds fadeIn, const bool crossfade) {
 		std::shared_ptr<SoundSource> sound = PlaySound(fileName, loop);
-		musicCmds->push_back({ MusicCmdType::Push, sound, curFade, nextFade });
+		std::lock_guard<std::mutex> lock(cmdMutex);
+		musicCmds->push_back({ MusicCmdType::Push, sound, static_cast<int>(fadeOut.count()), static_cast<int>(fadeIn.count()), crossfade });
 	}
 
 	/// <summary>
 	/// Pop music from stack
 	/// </summary>
-	/// <param name="curFade">Fade current song out flag</param>
-	/// <param name="nextFade">Fade next song in flag</param>
-	void Sound::PopMusic(const bool curFade, const bool nextFade) {
-		musicCmds->push_back({ MusicCmdType::Pop, nullptr, curFade, nextFade });
+	/// <param name="fadeOut">Current song fade out time</param>
+	/// <param name="fadeIn">Next song fade in time</param>
+	/// <param name="crossfade">Crossfade flag (resume the next song while the current one fades out)</param>
+	void Sound::PopMusic(const std::chrono::milliseconds fadeOut, const std::chrono::milliseconds fadeIn, const bool crossfade) {
+		std::lock_guard<std::mutex> lock(cmdMutex);
+		musicCmds->push_back({ MusicCmdType::Pop, nullptr, static_cast<int>(fadeOut.count()), static_cast<int>(fadeIn.count()), crossfade });
 	}
 
 	/// <summary>
 	/// Play sound effect
 	/// </summary>
 	/// <param name="fileName">File name</param>
-	void Sound::PlaySFX(std::string fileName) {
+	/// <returns>Sound effect source</returns>
+	std::shared_ptr<SoundSource> Sound::PlaySFX(std::string fileName) {
 		std::shared_ptr<SoundSource> sound = PlaySound(fileName, false);
-		sfx->push_back(sound);
+		std::lock_guard<std::mutex> lock(cmdMutex);
+		sfxQueue->push_back(sound);
+		return sound;
+	}
+
+	/// <summary>
+	/// Play positional sound effect
+	/// </summary>
+	/// <param name="fileName">File name</param>
+	/// <param name="pos">Position</param>
+	/// <param name="loop">Loop flag</param>
+	/// <returns>Sound effect source (move it with SoundSource::SetPosition)</returns>
+	std::shared_ptr<SoundSource> Sound::PlaySFX(std::string fileName, const Vec2D<float> pos, const bool loop) {
+		std::shared_ptr<SoundSource> sound = PlaySound(fileName, loop);
+		sound->positional = true;
+		sound->gamePos = pos;
+		sound->sentPos = pos;
+		sound->mixPos = pos;
+		sound->panL = -1;
+		positionalSFX->push_back(sound);
+
+		std::lock_guard<std::mutex> lock(cmdMutex);
+		sfxQueue->push_back(sound);
+		return sound;
+	}
+
+	/// <summary>
+	/// Set listener origin (the listener is at the center of the view from here, i.e. the camera position)
+	/// </summary>
+	/// <param name="origin">Listener origin</param>
+	void Sound::SetListenerOrigin(const Vec2D<float> origin) {
+		listenerOrigin = origin;
+	}
+
+	/// <summary>
+	/// Set positional sound effect range
+	/// </summary>
+	/// <param name="minDist">Distance where sound effects start to get quieter (0 = half the view width)</param>
+	/// <param name="maxDist">Distance where sound effects become inaudible (0 = 1.5 times the view width)</param>
+	void Sound::SetSFXRange(const float minDist, const float maxDist) {
+		sfxRange = { Math::Max(minDist, 0.0f), Math::Max(maxDist, 0.0f) };
+	}
+
+	/// <summary>
+	/// Set output sample rate (must be set before the engine starts)
+	/// </summary>
+	/// <param name="rate">Sample rate (0 = output device's native rate)</param>
+	void Sound::SetSampleRate(const int rate) {
+		sampleRate = Math::Max(rate, 0);
+	}
+
+	/// <summary>
+	/// Get output sample rate
+	/// </summary>
+	/// <returns>Output sample rate</returns>
+	int Sound::GetSampleRate() {
+		return (sampleRate > 0) ? sampleRate : SoundSampleRate;
 	}
 
 }
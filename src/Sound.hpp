@@ -10,8 +10,47 @@ namespace Violet {
 
 	// Sound buffer length
 	constexpr auto SoundBufferLen = 4096;
-	// Sound sample rate
+	// Default sound sample rate
 	constexpr auto SoundSampleRate = 44100;
+	// Default music fade time
+	constexpr std::chrono::milliseconds MusicFadeTime{ 500 };
+	// Maximum WAV device data size (the RIFF size, which includes the 36 header bytes after it, is 32-bit)
+	constexpr U64 SoundWAVMaxSize = ((0xFFFFFFFFULL - 36) / SoundBufferLen) * SoundBufferLen;
+
+	/// <summary>
+	/// Sound output device
+	/// </summary>
+	enum class SoundDevice {
+		/// <summary>
+		/// Shell's audio output
+		/// </summary>
+		Shell = 0,
+
+		/// <summary>
+		/// Discard output
+		/// </summary>
+		Null,
+
+		/// <summary>
+		/// Write output to a WAV file
+		/// </summary>
+		WAV
+	};
+
+	/// <summary>
+	/// Sound device statistics
+	/// </summary>
+	struct SoundDeviceStats {
+		/// <summary>
+		/// Number of blocks mixed
+		/// </summary>
+		U64 blocks{ 0 };
+
+		/// <summary>
+		/// Time spent mixing (in milliseconds)
+		/// </summary>
+		double time{ 0 };
+	};
 
 	/// <summary>
 	/// Sound
@@ -37,46 +76,105 @@ namespace Violet {
 		/// </summary>
 		/// <param name="fileName">File name</param>
 		/// <param name="loop">Loop flag</param>
-		/// <param name="curFade">Fade current song out flag</param>
-		/// <param name="nextFade">Fade next song in flag</param>
-		static void PlayMusic(std::string fileName, const bool loop = false, const bool curFade = true, const bool nextFade = false);
+		/// <param name="fadeOut">Current song fade out time</param>
+		/// <param name="fadeIn">Next song fade in time</param>
+		/// <param name="crossfade">Crossfade flag (start the next song while the current one fades out)</param>
+		static void PlayMusic(std::string fileName, const bool loop = false, const std::chrono::milliseconds fadeOut = MusicFadeTime, const std::chrono::milliseconds fadeIn = std::chrono::milliseconds(0), const bool crossfade = false);
 
 		/// <summary>
 		/// Set new main music without interrupting stack
 		/// </summary>
 		/// <param name="fileName">File name</param>
 		/// <param name="loop">Loop flag</param>
-		/// <param name="curFade">Fade current song out flag (only if current song is the main music)</param>
-		/// <param name="nextFade">Fade next song in flag (only if current song is the main music)</param>
-		static void SetMainMusic(std::string fileName, const bool loop = false, const bool curFade = true, const bool nextFade = false);
+		/// <param name="fadeOut">Current song fade out time (only if current song is the main music)</param>
+		/// <param name="fadeIn">Next song fade in time (only if current song is the main music)</param>
+		/// <param name="crossfade">Crossfade flag (only if current song is the main music)</param>
+		static void SetMainMusic(std::string fileName, const bool loop = false, const std::chrono::milliseconds fadeOut = MusicFadeTime, const std::chrono::milliseconds fadeIn = std::chrono::milliseconds(0), const bool crossfade = false);
 
 		/// <summary>
 		/// Stop music
 		/// </summary>
-		/// <param name="fadeOut">Fade out flag</param>
-		static void StopMusic(const bool fadeOut = false);
+		/// <param name="fadeOut">Fade out time</param>
+		static void StopMusic(const std::chrono::milliseconds fadeOut = std::chrono::milliseconds(0));
 
 		/// <summary>
 		/// Push music to stack
 		/// </summary>
 		/// <param name="fileName">File name</param>
 		/// <param name="loop">Loop flag</param>
-		/// <param name="curFade">Fade current song out flag</param>
-		/// <param name="nextFade">Fade next song in flag</param>
-		static void PushMusic(std::string fileName, const bool loop = false, const bool curFade = true, const bool nextFade = false);
+		/// <param name="fadeOut">Current song fade out time</param>
+		/// <param name="fadeIn">Next song fade in time</param>
+		/// <param name="crossfade">Crossfade flag (start the next song while the current one fades out)</param>
+		static void PushMusic(std::string fileName, const bool loop = false, const std::chrono::milliseconds fadeOut = MusicFadeTime, const std::chrono::milliseconds fadeIn = std::chrono::milliseconds(0), const bool crossfade = false);
 
 		/// <summary>
 		/// Pop music from stack
 		/// </summary>
-		/// <param name="curFade">Fade current song out flag</param>
-		/// <param name="nextFade">Fade next song in flag</param>
-		static void PopMusic(const bool curFade = true, const bool nextFade = true);
+		/// <param name="fadeOut">Current song fade out time</param>
+		/// <param name="fadeIn">Next song fade in time</param>
+		/// <param name="crossfade">Crossfade flag (resume the next song while the current one fades out)</param>
+		static void PopMusic(const std::chrono::milliseconds fadeOut = MusicFadeTime, const std::chrono::milliseconds fadeIn = MusicFadeTime, const bool crossfade = false);
 
 		/// <summary>
 		/// Play sound effect
 		/// </summary>
 		/// <param name="fileName">File name</param>
-		static void PlaySFX(std::string fileName);
+		/// <returns>Sound effect source</returns>
+		static std::shared_ptr<SoundSource> PlaySFX(std::string fileName);
+
+		/// <summary>
+		/// Play positional sound effect
+		/// </summary>
+		/// <param name="fileName">File name</param>
+		/// <param name="pos">Position</param>
+		/// <param name="loop">Loop flag</param>
+		/// <returns>Sound effect source (move it with SoundSource::SetPosition)</returns>
+		static std::shared_ptr<SoundSource> PlaySFX(std::string fileName, const Vec2D<float> pos, const bool loop = false);
+
+		/// <summary>
+		/// Set listener origin (the listener is at the center of the view from here, i.e. the camera position)
+		/// </summary>
+		/// <param name="origin">Listener origin</param>
+		static void SetListenerOrigin(const Vec2D<float> origin);
+
+		/// <summary>
+		/// Set positional sound effect range
+		/// </summary>
+		/// <param name="minDist">Distance where sound effects start to get quieter (0 = half the view width)</param>
+		/// <param name="maxDist">Distance where sound effects become inaudible (0 = 1.5 times the view width)</param>
+		static void SetSFXRange(const float minDist, const float maxDist);
+
+		/// <summary>
+		/// Set output sample rate (must be set before the engine starts)
+		/// </summary>
+		/// <param name="rate">Sample rate (0 = output device's native rate)</param>
+		static void SetSampleRate(const int rate);
+
+		/// <summary>
+		/// Get output sample rate
+		/// </summary>
+		/// <returns>Output sample rate</returns>
+		static int GetSampleRate();
+
+		/// <summary>
+		/// Set output device (must be set before the engine starts)
+		/// </summary>
+		/// <param name="device">Output device</param>
+		/// <param name="fileName">Output file name (WAV device only)</param>
+		/// <param name="freeRun">Free run flag (mix as fast as possible on a separate thread, otherwise only mix through Render)</param>
+		static void SetDevice(const SoundDevice device, std::string fileName = "", const bool freeRun = false);
+
+		/// <summary>
+		/// Mix blocks of sound on the calling thread (Null and WAV devices without free run only)
+		/// </summary>
+		/// <param name="blocks">Number of blocks</param>
+		static void Render(const int blocks);
+
+		/// <summary>
+		/// Get device statistics
+		/// </summary>
+		/// <returns>Device statistics</returns>
+		static SoundDeviceStats GetDeviceStats();
 
 	private:
 		/// <summary>
@@ -114,26 +212,6 @@ namespace Violet {
 			Stop
 		};
 
-		/// <summary>
-		/// Music fade mode
-		/// </summary>
-		enum class MusicFadeMode {
-			/// <summary>
-			/// None
-			/// </summary>
-			None = 0,
-
-			/// <summary>
-			/// In
-			/// </summary>
-			In,
-
-			/// <summary>
-			/// Fade out
-			/// </summary>
-			Out
-		};
-
 		/// <summary>
 		/// Music command
 		/// </summary>
@@ -149,14 +227,19 @@ namespace Violet {
 			std::shared_ptr<SoundSource> sound;
 
 			/// <summary>
-			/// Fade current song out flag
+			/// Current song fade out time (in milliseconds)
 			/// </summary>
-			bool curFade{ false };
+			int fadeOut{ 0 };
 
 			/// <summary>
-			/// Fade next song in flag
+			/// Next song fade in time (in milliseconds)
 			/// </summary>
-			bool nextFade{ false };
+			int fadeIn{ 0 };
+
+			/// <summary>
+			/// Crossfade flag
+			/// </summary>
+			bool crossfade{ false };
 		};
 
 		/// <summary>
@@ -165,6 +248,75 @@ namespace Violet {
 		/// <param name="buffer">Output sound buffer</param>
 		static void Update(S16* const buffer);
 
+		/// <summary>
+		/// Start output device
+		/// </summary>
+		static void StartDevice();
+
+		/// <summary>
+		/// Stop output device
+		/// </summary>
+		static void StopDevice();
+
+		/// <summary>
+		/// Mix a block of sound into the Null or WAV device
+		/// </summary>
+		static void RenderBlock();
+
+		/// <summary>
+		/// Process queued music commands
+		/// </summary>
+		static void ProcessMusicCmds();
+
+		/// <summary>
+		/// Apply a music command
+		/// </summary>
+		/// <param name="cmd">Music command</param>
+		/// <param name="fadeCurrent">Fade out current song flag</param>
+		static void ApplyMusicCmd(const MusicCmd& cmd, const bool fadeCurrent);
+
+		/// <summary>
+		/// Get current song
+		/// </summary>
+		/// <returns>Current song</returns>
+		static std::shared_ptr<SoundSource> GetCurrentMusic();
+
+		/// <summary>
+		/// Fade out a song in the background
+		/// </summary>
+		/// <param name="song">Song</param>
+		/// <param name="time">Fade out time</param>
+		static void FadeOutMusic(std::shared_ptr<SoundSource> song, const int time);
+
+		/// <summary>
+		/// Mix a sound source into the mix buffer
+		/// </summary>
+		/// <param name="source">Sound source</param>
+		static void MixSource(SoundSource* const source);
+
+		/// <summary>
+		/// Mix a positional sound source into the mix buffer
+		/// </summary>
+		/// <param name="source">Sound source</param>
+		static void MixPositional(SoundSource* const source);
+
+		/// <summary>
+		/// Update a positional sound source's gains
+		/// </summary>
+		/// <param name="source">Sound source</param>
+		/// <returns>True if audible, false if culled</returns>
+		static bool UpdatePan(SoundSource* const source);
+
+		/// <summary>
+		/// Send positions from the game to the mixer
+		/// </summary>
+		static void UpdatePositions();
+
+		/// <summary>
+		/// Take in the positions last sent by the game (command mutex must be locked)
+		/// </summary>
+		static void ReceivePositions();
+
 		/// <summary>
 		/// Play sound
 		/// </summary>
@@ -184,19 +336,139 @@ namespace Violet {
 		static std::unique_ptr<std::vector<std::shared_ptr<SoundSource>>> musicStack;
 
 		/// <summary>
-		/// Music commands
+		/// Music commands (queued by the game)
 		/// </summary>
 		static std::unique_ptr<std::vector<MusicCmd>> musicCmds;
 
 		/// <summary>
-		/// Music fade mode
+		/// Music commands (being processed by the mixer)
+		/// </summary>
+		static std::unique_ptr<std::vector<MusicCmd>> musicQueue;
+
+		/// <summary>
+		/// Songs fading out in the background
 		/// </summary>
-		static MusicFadeMode musicFadeMode;
+		static std::unique_ptr<std::vector<std::shared_ptr<SoundSource>>> musicFades;
+
+		/// <summary>
+		/// Song that must finish fading out before the next music command is applied
+		/// </summary>
+		static std::shared_ptr<SoundSource> musicWait;
 
 		/// <summary>
 		/// Sound effect pool
 		/// </summary>
 		static std::unique_ptr<std::vector<std::shared_ptr<SoundSource>>> sfx;
+
+		/// <summary>
+		/// Sound effects queued by the game
+		/// </summary>
+		static std::unique_ptr<std::vector<std::shared_ptr<SoundSource>>> sfxQueue;
+
+		/// <summary>
+		/// Positional sound effects (game side)
+		/// </summary>
+		static std::unique_ptr<std::vector<std::weak_ptr<SoundSource>>> positionalSFX;
+
+		/// <summary>
+		/// Listener origin (game side)
+		/// </summary>
+		static Vec2D<float> listenerOrigin;
+
+		/// <summary>
+		/// Positional sound effect range (game side)
+		/// </summary>
+		static Vec2D<float> sfxRange;
+
+		/// <summary>
+		/// Listener position (sent to the mixer, guarded by the command mutex)
+		/// </summary>
+		static Vec2D<float> sentListenerPos;
+
+		/// <summary>
+		/// Distance for full panning (sent to the mixer, guarded by the command mutex)
+		/// </summary>
+		static float sentPanDist;
+
+		/// <summary>
+		/// Positional sound effect range (sent to the mixer, guarded by the command mutex)
+		/// </summary>
+		static Vec2D<float> sentSFXRange;
+
+		/// <summary>
+		/// Listener position (mixer side)
+		/// </summary>
+		static Vec2D<float> mixListenerPos;
+
+		/// <summary>
+		/// Distance for full panning (mixer side)
+		/// </summary>
+		static float mixPanDist;
+
+		/// <summary>
+		/// Positional sound effect range (mixer side)
+		/// </summary>
+		static Vec2D<float> mixSFXRange;
+
+		/// <summary>
+		/// Mix buffer
+		/// </summary>
+		static std::unique_ptr<float[]> mixBuffer;
+
+		/// <summary>
+		/// Command queue mutex
+		/// </summary>
+		static std::mutex cmdMutex;
+
+		/// <summary>
+		/// Output sample rate
+		/// </summary>
+		static int sampleRate;
+
+		/// <summary>
+		/// Output device
+		/// </summary>
+		static SoundDevice device;
+
+		/// <summary>
+		/// Output device file name
+		/// </summary>
+		static std::string deviceFileName;
+
+		/// <summary>
+		/// Output device free run flag
+		/// </summary>
+		static bool deviceFreeRun;
+
+		/// <summary>
+		/// Output device thread
+		/// </summary>
+		static std::unique_ptr<std::thread> deviceThread;
+
+		/// <summary>
+		/// Output device running flag
+		/// </summary>
+		static std::atomic<bool> deviceRunning;
+
+		/// <summary>
+		/// Output device buffer
+		/// </summary>
+		static std::unique_ptr<S16[]> deviceBuffer;
+
+		/// <summary>
+		/// Output WAV file
+		/// </summary>
+		static std::shared_ptr<BinaryFile> deviceWAV;
+
+		/// <summary>
+		/// Output WAV data size
+		/// </summary>
+		static U64 deviceWAVSize;
+
+		/// <summary>
+		/// Device statistics
+		/// </summary>
+		static SoundDeviceStats deviceStats;
 	};
 
 }
@@ -0,0 +1,178 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+namespace Violet {
+
+	/// <summary>
+	/// Output device
+	/// </summary>
+	SoundDevice Sound::device{ SoundDevice::Shell };
+
+	/// <summary>
+	/// Output device file name
+	/// </summary>
+	std::string Sound::deviceFileName{ "" };
+
+	/// <summary>
+	/// Output device free run flag
+	/// </summary>
+	bool Sound::deviceFreeRun{ false };
+
+	/// <summary>
+	/// Output device thread
+	/// </summary>
+	std::unique_ptr<std::thread> Sound::deviceThread;
+
+	/// <summary>
+	/// Output device running flag
+	/// </summary>
+	std::atomic<bool> Sound::deviceRunning{ false };
+
+	/// <summary>
+	/// Output device buffer
+	/// </summary>
+	std::unique_ptr<S16[]> Sound::deviceBuffer;
+
+	/// <summary>
+	/// Output WAV file
+	/// </summary>
+	std::shared_ptr<BinaryFile> Sound::deviceWAV{ nullptr };
+
+	/// <summary>
+	/// Output WAV data size
+	/// </summary>
+	U64 Sound::deviceWAVSize{ 0 };
+
+	/// <summary>
+	/// Device statistics
+	/// </summary>
+	SoundDeviceStats Sound::deviceStats;
+
+	/// <summary>
+	/// Set output device (must be set before the engine starts)
+	/// </summary>
+	/// <param name="device">Output device</param>
+	/// <param name="fileName">Output file name (WAV device only)</param>
+	/// <param name="freeRun">Free run flag (mix as fast as possible on a separate thread, otherwise only mix through Render)</param>
+	void Sound::SetDevice(const SoundDevice device, std::string fileName, const bool freeRun) {
+		if (device == SoundDevice::WAV && fileName.empty()) {
+			Engine::Error("No file name given for the WAV sound device.");
+		}
+		Sound::device = device;
+		deviceFileName = fileName;
+		deviceFreeRun = freeRun;
+	}
+
+	/// <summary>
+	/// Mix blocks of sound on the calling thread (Null and WAV devices without free run only)
+	/// </summary>
+	/// <param name="blocks">Number of blocks</param>
+	void Sound::Render(const int blocks) {
+		if (device == SoundDevice::Shell || deviceFreeRun) {
+			Engine::Error("Sound can only be rendered manually with a Null or WAV device that isn't free running.");
+		}
+		if (!deviceBuffer) {
+			return;
+		}
+
+		for (int i = 0; i < blocks; ++i) {
+			RenderBlock();
+		}
+	}
+
+	/// <summary>
+	/// Get device statistics
+	/// </summary>
+	/// <returns>Device statistics</returns>
+	SoundDeviceStats Sound::GetDeviceStats() {
+		std::lock_guard<std::mutex> lock(cmdMutex);
+		return deviceStats;
+	}
+
+	/// <summary>
+	/// Start output device
+	/// </summary>
+	void Sound::StartDevice() {
+		deviceStats = {};
+		if (device == SoundDevice::Shell) {
+			// Opened by the shell
+			return;
+		}
+
+		deviceBuffer = std::make_unique<S16[]>(SoundBufferLen / sizeof(S16));
+
+		if (device == SoundDevice::WAV) {
+			deviceWAV = Engine::OpenBinaryFile(deviceFileName, false);
+			deviceWAVSize = 0;
+
+			// Header (sizes are filled in when the device is stopped)
+			deviceWAV->WriteString("RIFF", false);
+			deviceWAV->WriteUInt32(0);
+			deviceWAV->WriteString("WAVE", false);
+			deviceWAV->WriteString("fmt ", false);
+			deviceWAV->WriteUInt32(16);
+			deviceWAV->WriteUInt16(1);
+			deviceWAV->WriteUInt16(2);
+			deviceWAV->WriteUInt32(GetSampleRate());
+			deviceWAV->WriteUInt32(GetSampleRate() * 2 * sizeof(S16));
+			deviceWAV->WriteUInt16(2 * sizeof(S16));
+			deviceWAV->WriteUInt16(16);
+			deviceWAV->WriteString("data", false);
+			deviceWAV->WriteUInt32(0);
+		}
+
+		Engine::DebugMessage("SOUND DEVICE:        " + std::string((device == SoundDevice::WAV) ? "WAV " + deviceFileName : "Null") +
+			(deviceFreeRun ? ", FREE RUN" : ""));
+
+		if (deviceFreeRun) {
+			deviceRunning = true;
+			deviceThread = std::make_unique<std::thread>([]() {
+				while (deviceRunning) {
+					RenderBlock();
+				}
+			});
+		}
+	}
+
+	/// <summary>
+	/// Stop output device
+	/// </summary>
+	void Sound::StopDevice() {
+		if (deviceThread) {
+			deviceRunning = false;
+			deviceThread->join();
+			deviceThread = nullptr;
+		}
+
+		if (deviceWAV) {
+			deviceWAV->Seek(4);
+			deviceWAV->WriteUInt32(static_cast<U32>(36 + deviceWAVSize));
+			deviceWAV->Seek(40);
+			deviceWAV->WriteUInt32(static_cast<U32>(deviceWAVSize));
+			deviceWAV = nullptr;
+		}
+
+		deviceBuffer = nullptr;
+	}
+
+	/// <summary>
+	/// Mix a block of sound into the Null or WAV device
+	/// </summary>
+	void Sound::RenderBlock() {
+		Update(deviceBuffer.get());
+
+		// Stop writing once the file is as large as a WAV file can be, but keep mixing
+		if (deviceWAV && deviceWAVSize < SoundWAVMaxSize) {
+			deviceWAV->WriteData(deviceBuffer.get(), SoundBufferLen);
+			deviceWAVSize += SoundBufferLen;
+			if (deviceWAVSize >= SoundWAVMaxSize) {
+				Engine::DebugMessage("SOUND DEVICE FULL:   " + deviceFileName);
+			}
+		}
+	}
+
+}
@@ -20,6 +20,8 @@ namespace Violet {
 		if (!streamBuffer) {
 			Engine::Error("Failed to create sound source stream buffer.");
 		}
+
+		SetFormat(SoundSampleRate, 2);
 	}
 
 	/// <summary>
@@ -32,4 +34,364 @@ namespace Violet {
 		Engine::DebugMessage("SOUND DELETE:        " + fileName);
 	}
 
+	/// <summary>
+	/// Set source format
+	/// </summary>
+	/// <param name="sampleRate">Sample rate</param>
+	/// <param name="channels">Channel count</param>
+	/// <param name="waveLayout">WAV channel layout flag (Vorbis layout otherwise)</param>
+	void SoundSource::SetFormat(const int sampleRate, const int channels, const bool waveLayout) {
+		if (sampleRate <= 0 || channels <= 0) {
+			Engine::Error("Invalid sound format in \"" + fileName + "\"");
+		}
+
+		this->sampleRate = sampleRate;
+		this->channels = channels;
+
+		// Set up stereo down mix
+		const float c = 0.7071f;
+		downMix.assign(channels * 2, 0.0f);
+		if (channels == 1) {
+			downMix = { 1, 1 };
+		}
+		else if (waveLayout) {
+			// FL, FR, FC, LFE, BL, BR, SL, SR
+			switch (channels) {
+			case 3:
+				downMix = { 1, 0, 0, 1, c, c };
+				break;
+
+			case 4:
+				downMix = { 1, 0, 0, 1, c, 0, 0, c };
+				break;
+
+			case 5:
+				downMix = { 1, 0, 0, 1, c, c, c, 0, 0, c };
+				break;
+
+			case 6:
+				downMix = { 1, 0, 0, 1, c, c, 0, 0, c, 0, 0, c };
+				break;
+
+			case 7:
+				downMix = { 1, 0, 0, 1, c, c, 0, 0, 0.5f, 0.5f, c, 0, 0, c };
+				break;
+
+			case 8:
+				downMix = { 1, 0, 0, 1, c, c, 0, 0, c, 0, 0, c, c, 0, 0, c };
+				break;
+
+			default:
+				downMix[0] = 1;
+				downMix[3] = 1;
+				break;
+			}
+		}
+		else {
+			// Vorbis order
+			switch (channels) {
+			case 3:
+				downMix = { 1, 0, c, c, 0, 1 };
+				break;
+
+			case 4:
+				downMix = { 1, 0, 0, 1, c, 0, 0, c };
+				break;
+
+			case 5:
+				downMix = { 1, 0, c, c, 0, 1, c, 0, 0, c };
+				break;
+
+			case 6:
+				downMix = { 1, 0, c, c, 0, 1, c, 0, 0, c, 0, 0 };
+				break;
+
+			case 7:
+				downMix = { 1, 0, c, c, 0, 1, c, 0, 0, c, 0.5f, 0.5f, 0, 0 };
+				break;
+
+			case 8:
+				downMix = { 1, 0, c, c, 0, 1, c, 0, 0, c, c, 0, 0, c, 0, 0 };
+				break;
+
+			default:
+				// Stereo, or an unknown layout where only the first 2 channels are kept
+				downMix[0] = 1;
+				downMix[3] = 1;
+				break;
+			}
+		}
+
+		// Normalize so that the down mix can't clip
+		float sumL = 0;
+		float sumR = 0;
+		for (int i = 0; i < channels; ++i) {
+			sumL += downMix[i * 2];
+			sumR += downMix[i * 2 + 1];
+		}
+		for (int i = 0; i < channels; ++i) {
+			downMix[i * 2] /= Math::Max(sumL, 1.0f);
+			downMix[i * 2 + 1] /= Math::Max(sumR, 1.0f);
+		}
+
+		// Set up resampler
+		const int frames = SoundBufferLen / (sizeof(S16) * 2);
+		resampler = nullptr;
+		if (sampleRate != Sound::GetSampleRate()) {
+			resampler = std::make_unique<Resampler>(sampleRate, Sound::GetSampleRate(), frames * 2);
+			Engine::DebugMessage("SOUND RESAMPLE:      " + fileName + ", " + std::to_string(sampleRate) +
+				" -> " + std::to_string(Sound::GetSampleRate()));
+		}
+
+		readBuffer.resize(frames * 2 * channels);
+		mixBuffer.resize(frames * 2 * 2);
+		outBuffer.resize(frames * 2);
+	}
+
+	/// <summary>
+	/// Set loop points from LOOPSTART, LOOPEND and LOOPLENGTH tags
+	/// </summary>
+	/// <param name="comments">Tag comments</param>
+	/// <param name="count">Number of comments</param>
+	void SoundSource::SetLoopTags(char** const comments, const int count) {
+		U64 loopLength = 0;
+
+		for (int i = 0; i < count; ++i) {
+			const char* comment = comments[i];
+			const char* value = strchr(comment, '=');
+			if (!value) {
+				continue;
+			}
+
+			size_t nameLen = value - comment;
+			++value;
+			if (nameLen == 9 && strncmp(comment, "LOOPSTART", nameLen) == 0) {
+				loopStart = strtoull(value, nullptr, 10);
+			}
+			else if (nameLen == 7 && strncmp(comment, "LOOPEND", nameLen) == 0) {
+				loopEnd = strtoull(value, nullptr, 10);
+			}
+			else if (nameLen == 10 && strncmp(comment, "LOOPLENGTH", nameLen) == 0) {
+				loopLength = strtoull(value, nullptr, 10);
+			}
+		}
+
+		if (loopLength > 0 && loopEnd == 0) {
+			loopEnd = loopStart + loopLength;
+		}
+	}
+
+	/// <summary>
+	/// Fade volume
+	/// </summary>
+	/// <param name="target">Target volume</param>
+	/// <param name="time">Time for a full volume fade (in milliseconds, 0 = instant)</param>
+	void SoundSource::Fade(const float target, const int time) {
+		volumeTarget = target;
+		volumeStep = 0;
+
+		float frames = static_cast<float>(time) * Sound::GetSampleRate() / 1000.0f;
+		if (frames < 1 || volume == target) {
+			volume = target;
+		}
+		else {
+			volumeStep = ((target > volume) ? 1.0f : -1.0f) / frames;
+		}
+	}
+
+	/// <summary>
+	/// Skip ahead while not being streamed
+	/// </summary>
+	/// <param name="frames">Number of output frames skipped</param>
+	/// <returns>True if still active, false if ended</returns>
+	bool SoundSource::Skip(const int frames) {
+		skipFrames += static_cast<double>(frames) * sampleRate / Sound::GetSampleRate();
+		if (!loop && curPos + static_cast<U64>(skipFrames) >= GetLength()) {
+			ended = true;
+		}
+		return !ended;
+	}
+
+	/// <summary>
+	/// Apply skipped frames before streaming again
+	/// </summary>
+	/// <returns>True if still active, false if ended</returns>
+	bool SoundSource::ApplySkip() {
+		U64 frames = static_cast<U64>(skipFrames);
+		skipFrames -= frames;
+		if (frames == 0 || ended) {
+			return !ended;
+		}
+
+		U64 length = GetLength();
+		U64 target = curPos + frames;
+		if (loop) {
+			U64 end = (loopEnd > loopStart) ? loopEnd : length;
+			if (end > loopStart && target >= end) {
+				target = loopStart + (target - loopStart) % (end - loopStart);
+			}
+		}
+		else if (target >= length) {
+			ended = true;
+			return false;
+		}
+
+		if (!Seek(target)) {
+			ended = true;
+			return false;
+		}
+		curPos = target;
+		if (resampler) {
+			resampler->Reset();
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// Set position (positional sound effects only, sent to the mixer on the next position update)
+	/// </summary>
+	/// <param name="pos">Position</param>
+	void SoundSource::SetPosition(const Vec2D<float> pos) {
+		gamePos = pos;
+	}
+
+	/// <summary>
+	/// Get position
+	/// </summary>
+	/// <returns>Position</returns>
+	Vec2D<float> SoundSource::GetPosition() const {
+		return gamePos;
+	}
+
+	/// <summary>
+	/// Check if this is a positional sound
+	/// </summary>
+	/// <returns>True if positional, false if not</returns>
+	bool SoundSource::IsPositional() const {
+		return positional;
+	}
+
+	/// <summary>
+	/// Stream audio data, converted to the output sample rate in stereo
+	/// </summary>
+	/// <returns>True if active, false if not</returns>
+	bool SoundSource::Stream() {
+		const int frames = SoundBufferLen / (sizeof(S16) * 2);
+
+		// Already in the output format, so read directly into the stream buffer
+		if (!resampler && channels == 2) {
+			if (ended) {
+				return false;
+			}
+
+			int read = ReadBlock(streamBuffer, frames);
+			if (read <= 0) {
+				ended = true;
+				return false;
+			}
+			if (read < frames) {
+				memset(streamBuffer + read * 2, 0, (frames - read) * 2 * sizeof(S16));
+				ended = true;
+			}
+			return true;
+		}
+
+		int produced = 0;
+		while (produced < frames) {
+			if (resampler) {
+				produced += resampler->Pull(&outBuffer[produced * 2], frames - produced);
+				if (produced >= frames || ended) {
+					break;
+				}
+			}
+			else if (ended) {
+				break;
+			}
+
+			// Read source frames
+			int needed = frames - produced;
+			if (resampler) {
+				needed = Math::Min(Math::Max(resampler->GetFramesNeeded(needed), 1), resampler->GetFramesFree());
+			}
+			needed = Math::Min(needed, frames * 2);
+
+			int read = ReadBlock(readBuffer.data(), needed);
+			if (read < 0) {
+				ended = true;
+				return false;
+			}
+
+			// Mix down to stereo
+			float* mix = resampler ? mixBuffer.data() : &outBuffer[produced * 2];
+			const S16* in = readBuffer.data();
+			for (int i = 0; i < read; ++i) {
+				float l = 0;
+				float r = 0;
+				for (int c = 0; c < channels; ++c) {
+					l += *in * downMix[c * 2];
+					r += *in * downMix[c * 2 + 1];
+					++in;
+				}
+				*mix++ = l;
+				*mix++ = r;
+			}
+
+			if (resampler) {
+				resampler->Push(mixBuffer.data(), read);
+			}
+			else {
+				produced += read;
+			}
+
+			if (read < needed) {
+				ended = true;
+				if (resampler) {
+					resampler->Flush();
+				}
+			}
+		}
+
+		if (produced == 0) {
+			return false;
+		}
+
+		// Convert to output
+		for (int i = 0; i < produced * 2; ++i) {
+			float sample = outBuffer[i];
+			if (sample > 32767.0f) {
+				sample = 32767.0f;
+			}
+			else if (sample < -32768.0f) {
+				sample = -32768.0f;
+			}
+			streamBuffer[i] = static_cast<S16>(sample);
+		}
+		if (produced < frames) {
+			memset(streamBuffer + produced * 2, 0, (frames - produced) * 2 * sizeof(S16));
+		}
+
+		return true;
+	}
+
+	/// <summary>
+	/// Read a block of frames, reading until the block is full or the source ends
+	/// </summary>
+	/// <param name="buffer">Interleaved output buffer</param>
+	/// <param name="frames">Number of frames to read</param>
+	/// <returns>Number of frames read, -1 on error</returns>
+	int SoundSource::ReadBlock(S16* const buffer, const int frames) {
+		int total = 0;
+		while (total < frames) {
+			int read = Read(buffer + total * channels, frames - total);
+			if (read < 0) {
+				return -1;
+			}
+			if (read == 0) {
+				break;
+			}
+			total += read;
+		}
+		return total;
+	}
+
 }
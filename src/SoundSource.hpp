@@ -19,10 +19,28 @@ namespace Violet {
 		virtual ~SoundSource();
 
 		/// <summary>
-		/// Stream audio data
+		/// Stream audio data, converted to the output sample rate in stereo
 		/// </summary>
 		/// <returns>True if active, false if not</returns>
-		virtual bool Stream() = 0;
+		bool Stream();
+
+		/// <summary>
+		/// Set position (positional sound effects only, sent to the mixer on the next position update)
+		/// </summary>
+		/// <param name="pos">Position</param>
+		void SetPosition(const Vec2D<float> pos);
+
+		/// <summary>
+		/// Get position
+		/// </summary>
+		/// <returns>Position</returns>
+		Vec2D<float> GetPosition() const;
+
+		/// <summary>
+		/// Check if this is a positional sound
+		/// </summary>
+		/// <returns>True if positional, false if not</returns>
+		bool IsPositional() const;
 
 		// Friend classes
 		friend class Engine;
@@ -36,6 +54,62 @@ namespace Violet {
 		/// <param name="loop">Loop flag</param>
 		SoundSource(std::string fileName, const bool loop);
 
+		/// <summary>
+		/// Read audio data in the source's format
+		/// </summary>
+		/// <param name="buffer">Interleaved output buffer</param>
+		/// <param name="frames">Maximum number of frames to read</param>
+		/// <returns>Number of frames read, 0 if ended, -1 on error</returns>
+		virtual int Read(S16* const buffer, const int frames) = 0;
+
+		/// <summary>
+		/// Get length
+		/// </summary>
+		/// <returns>Length in source frames</returns>
+		virtual U64 GetLength() = 0;
+
+		/// <summary>
+		/// Seek to a position
+		/// </summary>
+		/// <param name="frame">Position in source frames</param>
+		/// <returns>True if successful, false if not</returns>
+		virtual bool Seek(const U64 frame) = 0;
+
+		/// <summary>
+		/// Set source format
+		/// </summary>
+		/// <param name="sampleRate">Sample rate</param>
+		/// <param name="channels">Channel count</param>
+		/// <param name="waveLayout">WAV channel layout flag (Vorbis layout otherwise)</param>
+		void SetFormat(const int sampleRate, const int channels, const bool waveLayout = false);
+
+		/// <summary>
+		/// Set loop points from LOOPSTART, LOOPEND and LOOPLENGTH tags
+		/// </summary>
+		/// <param name="comments">Tag comments</param>
+		/// <param name="count">Number of comments</param>
+		void SetLoopTags(char** const comments, const int count);
+
+		/// <summary>
+		/// Fade volume
+		/// </summary>
+		/// <param name="target">Target volume</param>
+		/// <param name="time">Time for a full volume fade (in milliseconds, 0 = instant)</param>
+		void Fade(const float target, const int time);
+
+		/// <summary>
+		/// Skip ahead while not being streamed
+		/// </summary>
+		/// <param name="frames">Number of output frames skipped</param>
+		/// <returns>True if still active, false if ended</returns>
+		bool Skip(const int frames);
+
+		/// <summary>
+		/// Apply skipped frames before streaming again
+		/// </summary>
+		/// <returns>True if still active, false if ended</returns>
+		bool ApplySkip();
+
 		/// <summary>
 		/// File name
 		/// </summary>
@@ -55,11 +129,59 @@ namespace Violet {
 		bool paused{ false };
 		// Loop flag
 		bool loop{ false };
-		// Fade in flag
-		bool fadeIn{ false };
 
 		// Current volume
 		float volume{ 1 };
+		// Volume fade target
+		float volumeTarget{ 1 };
+		// Volume change per sample frame while fading
+		float volumeStep{ 0 };
+
+		// Positional flag
+		bool positional{ false };
+		// Position (set by the game)
+		Vec2D<float> gamePos{ 0, 0 };
+		// Position (sent to the mixer, guarded by the command mutex)
+		Vec2D<float> sentPos{ 0, 0 };
+		// Position (used by the mixer)
+		Vec2D<float> mixPos{ 0, 0 };
+		// Current left and right gains
+		float panL{ 0 };
+		float panR{ 0 };
+		// Target left and right gains
+		float panTargetL{ 0 };
+		float panTargetR{ 0 };
+		// Culled flag
+		bool culled{ false };
+		// Source frames skipped while culled
+		double skipFrames{ 0 };
+
+		// Source sample rate
+		int sampleRate{ 0 };
+		// Source channel count
+		int channels{ 2 };
+
+	private:
+		/// <summary>
+		/// Read a block of frames, reading until the block is full or the source ends
+		/// </summary>
+		/// <param name="buffer">Interleaved output buffer</param>
+		/// <param name="frames">Number of frames to read</param>
+		/// <returns>Number of frames read, -1 on error</returns>
+		int ReadBlock(S16* const buffer, const int frames);
+
+		// Resampler (only used if the source rate differs from the output rate)
+		std::unique_ptr<Resampler> resampler;
+		// Stereo down mix coefficients (left and right per channel)
+		std::vector<float> downMix;
+		// Read buffer
+		std::vector<S16> readBuffer;
+		// Stereo mix buffer
+		std::vector<float> mixBuffer;
+		// Resampled output buffer
+		std::vector<float> outBuffer;
+		// Source ended flag (set by the mixer, checked by the game)
+		std::atomic<bool> ended{ false };
 	};
 
 }
@@ -18,29 +18,10 @@ namespace Violet {
 		this->file = file;
 
 		vorbis_comment* comments = ov_comment(file, -1);
-		char* token;
-		char* nextToken = nullptr;
-		U64 loopLength = 0;
+		SetLoopTags(comments->user_comments, comments->comments);
 
-		for (int i = 0; i < comments->comments; ++i) {
-			token = strtok_s(comments->user_comments[i], "=", &nextToken);
-
-			if (nextToken) {
-				if (strcmp(token, "LOOPSTART") == 0) {
-					loopStart = atoi(nextToken);
-				}
-				else if (strcmp(token, "LOOPEND") == 0) {
-					loopEnd = atoi(nextToken);
-				}
-				else if (strcmp(token, "LOOPLENGTH") == 0) {
-					loopLength = atoi(nextToken);
-				}
-			}
-		}
-
-		if (loopLength > 0 && loopEnd == 0) {
-			loopEnd = loopStart + loopLength;
-		}
+		vorbis_info* info = ov_info(file, -1);
+		SetFormat(static_cast<int>(info->rate), info->channels);
 
 		Engine::DebugMessage("SOUND PLAY (OGG):    " + fileName + ", LOOP = " + std::to_string(loop));
 	}
@@ -54,40 +35,71 @@ namespace Violet {
 	}
 
 	/// <summary>
-	/// Stream audio data
+	/// Read audio data in the source's format
 	/// </summary>
-	/// <returns>True if active, false if not</returns>
-	bool SoundSourceOgg::Stream() {
-		char* bufPos = (char*)streamBuffer;
-		long lenLeft = SoundBufferLen;
+	/// <param name="buffer">Interleaved output buffer</param>
+	/// <param name="frames">Maximum number of frames to read</param>
+	/// <returns>Number of frames read, 0 if ended, -1 on error</returns>
+	int SoundSourceOgg::Read(S16* const buffer, const int frames) {
+		const long frameSize = channels * sizeof(S16);
+		char* bufPos = (char*)buffer;
+		long lenLeft = frames * frameSize;
+		bool looped = false;
 
 		while (lenLeft > 0) {
-			if (loop && loopEnd > 0) {
-				long loop_left = static_cast<long>((loopEnd - curPos) * 4);
-				if (lenLeft > loop_left) {
-					lenLeft = loop_left;
+			long readLen = lenLeft;
+			if (loop && loopEnd > curPos) {
+				long loop_left = static_cast<long>((loopEnd - curPos) * frameSize);
+				if (readLen > loop_left) {
+					readLen = loop_left;
 				}
 			}
 
-			long read = ov_read(file, bufPos, Math::Min(SoundBufferLen, lenLeft), 0, 2, 1, nullptr);
+			long read = ov_read(file, bufPos, readLen, 0, 2, 1, nullptr);
 			if (read < 0) {
-				return false;
+				return -1;
 			}
 
 			lenLeft -= read;
 			bufPos += read;
-			curPos += read / 4;
+			curPos += read / frameSize;
 
 			if (loop && (read == 0 || (loopEnd > 0 && curPos >= loopEnd))) {
+				// Stop if the loop itself is empty
+				if (read == 0 && looped) {
+					break;
+				}
 				ov_pcm_seek(file, loopStart);
 				curPos = loopStart;
+				looped = true;
 			}
-			else if (!loop && read == 0) {
-				return false;
+			else if (read == 0) {
+				break;
+			}
+			else {
+				looped = false;
 			}
 		}
 
-		return true;
+		return static_cast<int>((bufPos - (char*)buffer) / frameSize);
+	}
+
+	/// <summary>
+	/// Get length
+	/// </summary>
+	/// <returns>Length in source frames</returns>
+	U64 SoundSourceOgg::GetLength() {
+		ogg_int64_t length = ov_pcm_total(file, -1);
+		return (length < 0) ? 0 : static_cast<U64>(length);
+	}
+
+	/// <summary>
+	/// Seek to a position
+	/// </summary>
+	/// <param name="frame">Position in source frames</param>
+	/// <returns>True if successful, false if not</returns>
+	bool SoundSourceOgg::Seek(const U64 frame) {
+		return ov_pcm_seek(file, static_cast<ogg_int64_t>(frame)) == 0;
 	}
 
 }
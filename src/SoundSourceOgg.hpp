@@ -20,12 +20,6 @@ namespace Violet {
 		/// </summary>
 		~SoundSourceOgg();
 
-		/// <summary>
-		/// Stream audio data
-		/// </summary>
-		/// <returns>True if active, false if not</returns>
-		bool Stream();
-
 		// Friend classes
 		friend class Engine;
 		friend class Sound;
@@ -39,6 +33,27 @@ namespace Violet {
 		/// <param name="loop">Loop flag</param>
 		SoundSourceOgg(std::string fileName, OggVorbis_File* const file, const bool loop);
 
+		/// <summary>
+		/// Read audio data in the source's format
+		/// </summary>
+		/// <param name="buffer">Interleaved output buffer</param>
+		/// <param name="frames">Maximum number of frames to read</param>
+		/// <returns>Number of frames read, 0 if ended, -1 on error</returns>
+		int Read(S16* const buffer, const int frames);
+
+		/// <summary>
+		/// Get length
+		/// </summary>
+		/// <returns>Length in source frames</returns>
+		U64 GetLength();
+
+		/// <summary>
+		/// Seek to a position
+		/// </summary>
+		/// <param name="frame">Position in source frames</param>
+		/// <returns>True if successful, false if not</returns>
+		bool Seek(const U64 frame);
+
 		// File handler
 		OggVorbis_File* file{ nullptr };
 	};
@@ -0,0 +1,114 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+#ifdef VIOLET_SOUND_OPUS
+
+namespace Violet {
+
+	/// <summary>
+	/// Opus sound source constructor
+	/// </summary>
+	/// <param name="fileName">File name</param>
+	/// <param name="file">File handler</param>
+	/// <param name="loop">Loop flag</param>
+	SoundSourceOpus::SoundSourceOpus(std::string fileName, OggOpusFile* const file, const bool loop) :
+		SoundSource(fileName, loop) {
+		this->file = file;
+
+		const OpusTags* tags = op_tags(file, -1);
+		if (tags) {
+			SetLoopTags(tags->user_comments, tags->comments);
+		}
+
+		int channelCount = op_channel_count(file, -1);
+		stereo = channelCount > 2;
+		SetFormat(OpusSampleRate, stereo ? 2 : channelCount);
+
+		Engine::DebugMessage("SOUND PLAY (OPUS):   " + fileName + ", LOOP = " + std::to_string(loop));
+	}
+
+	/// <summary>
+	/// Opus sound source destructor
+	/// </summary>
+	SoundSourceOpus::~SoundSourceOpus() {
+		op_free(file);
+	}
+
+	/// <summary>
+	/// Read audio data in the source's format
+	/// </summary>
+	/// <param name="buffer">Interleaved output buffer</param>
+	/// <param name="frames">Maximum number of frames to read</param>
+	/// <returns>Number of frames read, 0 if ended, -1 on error</returns>
+	int SoundSourceOpus::Read(S16* const buffer, const int frames) {
+		int total = 0;
+		bool looped = false;
+
+		while (total < frames) {
+			int readLen = frames - total;
+			if (loop && loopEnd > curPos) {
+				readLen = static_cast<int>(Math::Min(static_cast<U64>(readLen), loopEnd - curPos));
+			}
+
+			S16* bufPos = buffer + total * channels;
+			int read;
+			if (stereo) {
+				read = op_read_stereo(file, bufPos, readLen * 2);
+			}
+			else {
+				read = op_read(file, bufPos, readLen * channels, nullptr);
+			}
+			if (read < 0) {
+				return -1;
+			}
+
+			// Never trust a packet to fit inside the loop region
+			read = Math::Min(read, readLen);
+			total += read;
+			curPos += read;
+
+			if (loop && (read == 0 || (loopEnd > 0 && curPos >= loopEnd))) {
+				// Stop if the loop itself is empty
+				if (read == 0 && looped) {
+					break;
+				}
+				op_pcm_seek(file, static_cast<ogg_int64_t>(loopStart));
+				curPos = loopStart;
+				looped = true;
+			}
+			else if (read == 0) {
+				break;
+			}
+			else {
+				looped = false;
+			}
+		}
+
+		return total;
+	}
+
+	/// <summary>
+	/// Get length
+	/// </summary>
+	/// <returns>Length in source frames</returns>
+	U64 SoundSourceOpus::GetLength() {
+		ogg_int64_t length = op_pcm_total(file, -1);
+		return (length < 0) ? 0 : static_cast<U64>(length);
+	}
+
+	/// <summary>
+	/// Seek to a position
+	/// </summary>
+	/// <param name="frame">Position in source frames</param>
+	/// <returns>True if successful, false if not</returns>
+	bool SoundSourceOpus::Seek(const U64 frame) {
+		return op_pcm_seek(file, static_cast<ogg_int64_t>(frame)) == 0;
+	}
+
+}
+
+#endif // VIOLET_SOUND_OPUS
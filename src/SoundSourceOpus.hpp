@@ -0,0 +1,74 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#ifndef VIOLET_SOUND_SOURCE_OPUS_HPP
+#define VIOLET_SOUND_SOURCE_OPUS_HPP
+
+#ifdef VIOLET_SOUND_OPUS
+
+#include <opusfile.h>
+
+namespace Violet {
+
+	/// <summary>
+	/// Opus sample rate (Opus always decodes at 48 kHz)
+	/// </summary>
+	constexpr int OpusSampleRate = 48000;
+
+	/// <summary>
+	/// Opus sound source
+	/// </summary>
+	class SoundSourceOpus : public SoundSource {
+	public:
+		/// <summary>
+		/// Opus sound source destructor
+		/// </summary>
+		~SoundSourceOpus();
+
+		// Friend classes
+		friend class Engine;
+		friend class Sound;
+
+	private:
+		/// <summary>
+		/// Opus sound source constructor
+		/// </summary>
+		/// <param name="fileName">File name</param>
+		/// <param name="file">File handler</param>
+		/// <param name="loop">Loop flag</param>
+		SoundSourceOpus(std::string fileName, OggOpusFile* const file, const bool loop);
+
+		/// <summary>
+		/// Read audio data in the source's format
+		/// </summary>
+		/// <param name="buffer">Interleaved output buffer</param>
+		/// <param name="frames">Maximum number of frames to read</param>
+		/// <returns>Number of frames read, 0 if ended, -1 on error</returns>
+		int Read(S16* const buffer, const int frames);
+
+		/// <summary>
+		/// Get length
+		/// </summary>
+		/// <returns>Length in source frames</returns>
+		U64 GetLength();
+
+		/// <summary>
+		/// Seek to a position
+		/// </summary>
+		/// <param name="frame">Position in source frames</param>
+		/// <returns>True if successful, false if not</returns>
+		bool Seek(const U64 frame);
+
+		// File handler
+		OggOpusFile* file{ nullptr };
+		// Stereo down mix flag (let libopusfile handle surround streams)
+		bool stereo{ false };
+	};
+
+}
+
+#endif // VIOLET_SOUND_OPUS
+
+#endif // VIOLET_SOUND_SOURCE_OPUS_HPP
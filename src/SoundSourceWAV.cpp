@@ -0,0 +1,290 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Violet {
+
+	/// <summary>
+	/// Read little endian 16-bit value
+	/// </summary>
+	/// <param name="data">Data</param>
+	/// <returns>Read value</returns>
+	static U16 ReadLE16(const U8* const data) {
+		return static_cast<U16>(data[0] | (data[1] << 8));
+	}
+
+	/// <summary>
+	/// Read little endian 32-bit value
+	/// </summary>
+	/// <param name="data">Data</param>
+	/// <returns>Read value</returns>
+	static U32 ReadLE32(const U8* const data) {
+		return static_cast<U32>(data[0]) | (static_cast<U32>(data[1]) << 8) |
+			(static_cast<U32>(data[2]) << 16) | (static_cast<U32>(data[3]) << 24);
+	}
+
+	/// <summary>
+	/// WAV sound source constructor
+	/// </summary>
+	/// <param name="fileName">File name</param>
+	/// <param name="loop">Loop flag</param>
+	SoundSourceWAV::SoundSourceWAV(std::string fileName, const bool loop) :
+		SoundSource(fileName, loop) {
+		if (!MapFile()) {
+			Engine::Error("Failed to open sound file \"" + fileName + "\"");
+		}
+		if (!Parse()) {
+			UnmapFile();
+			Engine::Error("Unsupported WAV file \"" + fileName + "\"");
+		}
+
+		Engine::DebugMessage("SOUND PLAY (WAV):    " + fileName + ", LOOP = " + std::to_string(loop));
+	}
+
+	/// <summary>
+	/// WAV sound source destructor
+	/// </summary>
+	SoundSourceWAV::~SoundSourceWAV() {
+		UnmapFile();
+	}
+
+	/// <summary>
+	/// Map file into memory
+	/// </summary>
+	/// <returns>True if successful, false if not</returns>
+	bool SoundSourceWAV::MapFile() {
+#ifdef _WIN32
+		HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+		if (!mapping) {
+			return false;
+		}
+
+		// The view keeps the mapping alive
+		fileData = static_cast<const U8*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+		CloseHandle(mapping);
+		fileSize = static_cast<size_t>(size.QuadPart);
+#else
+		int fd = open(fileName.c_str(), O_RDONLY);
+		if (fd < 0) {
+			return false;
+		}
+
+		struct stat info;
+		if (fstat(fd, &info) != 0 || info.st_size == 0) {
+			close(fd);
+			return false;
+		}
+
+		void* map = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if (map == MAP_FAILED) {
+			return false;
+		}
+
+		fileData = static_cast<const U8*>(map);
+		fileSize = static_cast<size_t>(info.st_size);
+#endif
+		return fileData != nullptr;
+	}
+
+	/// <summary>
+	/// Unmap file from memory
+	/// </summary>
+	void SoundSourceWAV::UnmapFile() {
+		if (fileData) {
+#ifdef _WIN32
+			UnmapViewOfFile(fileData);
+#else
+			munmap(const_cast<U8*>(fileData), fileSize);
+#endif
+			fileData = nullptr;
+		}
+	}
+
+	/// <summary>
+	/// Parse WAV chunks
+	/// </summary>
+	/// <returns>True if successful, false if not</returns>
+	bool SoundSourceWAV::Parse() {
+		if (fileSize < 12 || memcmp(fileData, "RIFF", 4) != 0 || memcmp(fileData + 8, "WAVE", 4) != 0) {
+			return false;
+		}
+
+		int format = 0;
+		int channelCount = 0;
+		int rate = 0;
+		int bits = 0;
+		U64 dataSize = 0;
+
+		size_t pos = 12;
+		while (pos + 8 <= fileSize) {
+			const U8* chunk = fileData + pos;
+			U32 chunkSize = ReadLE32(chunk + 4);
+			const U8* body = chunk + 8;
+			size_t bodySize = Math::Min(static_cast<size_t>(chunkSize), fileSize - pos - 8);
+
+			if (memcmp(chunk, "fmt ", 4) == 0 && bodySize >= 16) {
+				format = ReadLE16(body);
+				channelCount = ReadLE16(body + 2);
+				rate = static_cast<int>(ReadLE32(body + 4));
+				bits = ReadLE16(body + 14);
+
+				// Extensible format, get the actual format from the sub format GUID
+				if (format == 0xFFFE && bodySize >= 26) {
+					format = ReadLE16(body + 24);
+				}
+			}
+			else if (memcmp(chunk, "data", 4) == 0) {
+				data = body;
+				dataSize = bodySize;
+			}
+			else if (memcmp(chunk, "smpl", 4) == 0 && bodySize >= 60 && ReadLE32(body + 28) > 0) {
+				// First sampler loop (end is inclusive)
+				loopStart = ReadLE32(body + 44);
+				loopEnd = static_cast<U64>(ReadLE32(body + 48)) + 1;
+			}
+
+			// Chunks are padded to 2 bytes
+			pos += 8 + static_cast<size_t>(chunkSize) + (chunkSize & 1);
+		}
+
+		if (!data || channelCount <= 0 || rate <= 0) {
+			return false;
+		}
+
+		if (format == 1 && (bits == 8 || bits == 16 || bits == 24 || bits == 32)) {
+			floatData = false;
+		}
+		else if (format == 3 && bits == 32) {
+			floatData = true;
+		}
+		else {
+			return false;
+		}
+
+		sampleSize = bits / 8;
+		frameSize = sampleSize * channelCount;
+		frameCount = dataSize / frameSize;
+
+		SetFormat(rate, channelCount, true);
+		return true;
+	}
+
+	/// <summary>
+	/// Read audio data in the source's format
+	/// </summary>
+	/// <param name="buffer">Interleaved output buffer</param>
+	/// <param name="frames">Maximum number of frames to read</param>
+	/// <returns>Number of frames read, 0 if ended, -1 on error</returns>
+	int SoundSourceWAV::Read(S16* const buffer, const int frames) {
+		int total = 0;
+
+		while (total < frames) {
+			U64 end = frameCount;
+			if (loop && loopEnd > 0 && curPos <= loopEnd) {
+				end = Math::Min(loopEnd, frameCount);
+			}
+
+			if (curPos >= end) {
+				if (loop && end > loopStart) {
+					curPos = loopStart;
+					continue;
+				}
+				break;
+			}
+
+			int count = static_cast<int>(Math::Min(static_cast<U64>(frames - total), end - curPos));
+			const U8* in = data + curPos * frameSize;
+			S16* out = buffer + total * channels;
+			int samples = count * channels;
+
+			switch (sampleSize) {
+			case 1:
+				for (int i = 0; i < samples; ++i) {
+					out[i] = static_cast<S16>((in[i] - 128) << 8);
+				}
+				break;
+
+			case 2:
+				// Already in the right format
+				memcpy(out, in, samples * sizeof(S16));
+				break;
+
+			case 3:
+				for (int i = 0; i < samples; ++i) {
+					out[i] = static_cast<S16>(ReadLE16(in + i * 3 + 1));
+				}
+				break;
+
+			case 4:
+				if (floatData) {
+					for (int i = 0; i < samples; ++i) {
+						float sample;
+						memcpy(&sample, in + i * 4, sizeof(float));
+						sample = Math::Max(-1.0f, Math::Min(1.0f, sample));
+						out[i] = static_cast<S16>(sample * 32767.0f);
+					}
+				}
+				else {
+					for (int i = 0; i < samples; ++i) {
+						out[i] = static_cast<S16>(ReadLE16(in + i * 4 + 2));
+					}
+				}
+				break;
+			}
+
+			total += count;
+			curPos += count;
+		}
+
+		return total;
+	}
+
+	/// <summary>
+	/// Get length
+	/// </summary>
+	/// <returns>Length in source frames</returns>
+	U64 SoundSourceWAV::GetLength() {
+		return frameCount;
+	}
+
+	/// <summary>
+	/// Seek to a position
+	/// </summary>
+	/// <param name="frame">Position in source frames</param>
+	/// <returns>True if successful, false if not</returns>
+	bool SoundSourceWAV::Seek(const U64 frame) {
+		if (frame > frameCount) {
+			return false;
+		}
+		curPos = frame;
+		return true;
+	}
+
+}
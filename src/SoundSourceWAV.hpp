@@ -0,0 +1,90 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#ifndef VIOLET_SOUND_SOURCE_WAV_HPP
+#define VIOLET_SOUND_SOURCE_WAV_HPP
+
+namespace Violet {
+
+	/// <summary>
+	/// WAV sound source (PCM data is read straight from the memory mapped file)
+	/// </summary>
+	class SoundSourceWAV : public SoundSource {
+	public:
+		/// <summary>
+		/// WAV sound source destructor
+		/// </summary>
+		~SoundSourceWAV();
+
+		// Friend classes
+		friend class Engine;
+		friend class Sound;
+
+	private:
+		/// <summary>
+		/// WAV sound source constructor
+		/// </summary>
+		/// <param name="fileName">File name</param>
+		/// <param name="loop">Loop flag</param>
+		SoundSourceWAV(std::string fileName, const bool loop);
+
+		/// <summary>
+		/// Read audio data in the source's format
+		/// </summary>
+		/// <param name="buffer">Interleaved output buffer</param>
+		/// <param name="frames">Maximum number of frames to read</param>
+		/// <returns>Number of frames read, 0 if ended, -1 on error</returns>
+		int Read(S16* const buffer, const int frames);
+
+		/// <summary>
+		/// Get length
+		/// </summary>
+		/// <returns>Length in source frames</returns>
+		U64 GetLength();
+
+		/// <summary>
+		/// Seek to a position
+		/// </summary>
+		/// <param name="frame">Position in source frames</param>
+		/// <returns>True if successful, false if not</returns>
+		bool Seek(const U64 frame);
+
+		/// <summary>
+		/// Map file into memory
+		/// </summary>
+		/// <returns>True if successful, false if not</returns>
+		bool MapFile();
+
+		/// <summary>
+		/// Unmap file from memory
+		/// </summary>
+		void UnmapFile();
+
+		/// <summary>
+		/// Parse WAV chunks
+		/// </summary>
+		/// <returns>True if successful, false if not</returns>
+		bool Parse();
+
+		// Mapped file data
+		const U8* fileData{ nullptr };
+		// Mapped file size
+		size_t fileSize{ 0 };
+
+		// Sample data
+		const U8* data{ nullptr };
+		// Number of sample frames
+		U64 frameCount{ 0 };
+		// Bytes per sample
+		int sampleSize{ 0 };
+		// Bytes per sample frame
+		int frameSize{ 0 };
+		// Floating point sample flag
+		bool floatData{ false };
+	};
+
+}
+
+#endif // VIOLET_SOUND_SOURCE_WAV_HPP
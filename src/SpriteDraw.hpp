@@ -208,6 +208,16 @@ namespace Violet {
 		/// Shader user data
 		/// </summary>
 		void* userData;
+
+		/// <summary>
+		/// Depth (set from the layer when queued in depth ordering mode)
+		/// </summary>
+		float depth{ 0 };
+
+		/// <summary>
+		/// Texture array layer
+		/// </summary>
+		int arrayLayer{ 0 };
 	};
 
 }
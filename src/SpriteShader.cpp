@@ -14,24 +14,38 @@ namespace Violet {
 		Vec2D<float> pos;
 		ColorRGBA<float> color;
 		Vec2D<float> texCoord;
+		float depth;
+		float arrayLayer;
 	};
 
 	/// <summary>
 	/// Sprite shader constructor
 	/// </summary>
-	SpriteShader::SpriteShader() : Shader(sizeof(SpriteVertex), SpriteBufCount * 6, GetVertexShader(), GetFragmentShader()) {
+	/// <param name="array">Texture array flag (samples the sprite's array layer of a texture array)</param>
+	SpriteShader::SpriteShader(const bool array) : Shader(sizeof(SpriteVertex), SpriteBufCount * 6, GetVertexShader(array), GetFragmentShader(array)) {
 		vertexBuffer->AddAttribute(VertexBuffer::AttribType::Float, 2);
 		vertexBuffer->AddAttribute(VertexBuffer::AttribType::Float, 4);
 		vertexBuffer->AddAttribute(VertexBuffer::AttribType::Float, 2);
+		vertexBuffer->AddAttribute(VertexBuffer::AttribType::Float, 1);
+		vertexBuffer->AddAttribute(VertexBuffer::AttribType::Float, 1);
 
-		AddVariable("projection");
+		AddUniformBlock("FrameData", FrameUniformBinding);
+		alphaCutoffVar = AddVariable("alphaCutoff");
+	}
+
+	/// <summary>
+	/// Set the alpha that fragments have to be above to be drawn
+	/// </summary>
+	/// <param name="cutoff">Alpha cutoff</param>
+	void SpriteShader::SetAlphaCutoff(const float cutoff) {
+		SetFloat(alphaCutoffVar, cutoff);
 	}
 
 	/// <summary>
 	/// Start sprite draw
 	/// </summary>
 	void SpriteShader::StartSpriteDraw() {
-		SetMatrix4x4("projection", Engine::GetDefaultOrthoMat());
+		// The projection comes from the frame uniform buffer
 	}
 
 	/// <summary>
@@ -60,6 +74,8 @@ namespace Violet {
 
 		vertexData[0].pos = { posTransform0.x, posTransform0.y };
 		vertexData[0].color = sprite.color;
+		vertexData[0].depth = sprite.depth;
+		vertexData[0].arrayLayer = static_cast<float>(sprite.arrayLayer);
 		vertexData[0].texCoord = {
 			static_cast<float>(sprite.bounds.x / texWidth),
 			static_cast<float>(sprite.bounds.y / texHeight)
@@ -67,6 +83,8 @@ namespace Violet {
 
 		vertexData[1].pos = { posTransform1.x, posTransform1.y };
 		vertexData[1].color = sprite.color;
+		vertexData[1].depth = sprite.depth;
+		vertexData[1].arrayLayer = static_cast<float>(sprite.arrayLayer);
 		vertexData[1].texCoord = {
 			static_cast<float>(sprite.bounds.x / texWidth),
 			static_cast<float>((sprite.bounds.y + sprite.bounds.h) / texHeight)
@@ -74,6 +92,8 @@ namespace Violet {
 
 		vertexData[2].pos = { posTransform2.x, posTransform2.y };
 		vertexData[2].color = sprite.color;
+		vertexData[2].depth = sprite.depth;
+		vertexData[2].arrayLayer = static_cast<float>(sprite.arrayLayer);
 		vertexData[2].texCoord = {
 			static_cast<float>((sprite.bounds.x + sprite.bounds.w) / texWidth),
 			static_cast<float>(sprite.bounds.y / texHeight)
@@ -81,6 +101,8 @@ namespace Violet {
 
 		vertexData[4].pos = { posTransform3.x, posTransform3.y };
 		vertexData[4].color = sprite.color;
+		vertexData[4].depth = sprite.depth;
+		vertexData[4].arrayLayer = static_cast<float>(sprite.arrayLayer);
 		vertexData[4].texCoord = {
 			static_cast<float>((sprite.bounds.x + sprite.bounds.w) / texWidth),
 			static_cast<float>((sprite.bounds.y + sprite.bounds.h) / texHeight)
@@ -104,6 +126,7 @@ namespace Violet {
 			vertexBuffer->RefreshData();
 			vertexBuffer->Draw(vertexCount);
 			vertexCount = 0;
+			++Graphics::drawFrame->stats.drawCalls;
 		}
 	}
 
@@ -42,22 +42,36 @@ namespace Violet {
 		/// <summary>
 		/// Sprite shader constructor
 		/// </summary>
-		SpriteShader();
+		/// <param name="array">Texture array flag (samples the sprite's array layer of a texture array)</param>
+		SpriteShader(const bool array);
 
 		/// <summary>
 		/// Get sprite shader vertex shader code
 		/// </summary>
+		/// <param name="array">Texture array flag</param>
 		/// <returns>Sprite shader vertex shader code</returns>
-		static const char* GetVertexShader();
+		static const char* GetVertexShader(const bool array);
 
 		/// <summary>
 		/// Get sprite shader fragment shader code
 		/// </summary>
+		/// <param name="array">Texture array flag</param>
 		/// <returns>Sprite shader fragment shader code</returns>
-		static const char* GetFragmentShader();
+		static const char* GetFragmentShader(const bool array);
+
+		/// <summary>
+		/// Set the alpha that fragments have to be above to be drawn
+		/// </summary>
+		/// <param name="cutoff">Alpha cutoff</param>
+		void SetAlphaCutoff(const float cutoff);
 
 		// Vertex count
 		int vertexCount{ 0 };
+
+		/// <summary>
+		/// Alpha cutoff variable
+		/// </summary>
+		ShaderVar alphaCutoffVar;
 	};
 
 }
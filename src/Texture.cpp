@@ -8,9 +8,42 @@
 namespace Violet {
 
 	/// <summary>
-	/// Active textures
+	/// Active textures (per thread, as each thread has its own context)
 	/// </summary>
-	Texture::Unit Texture::active[16] = { 0 };
+	thread_local Texture::Unit Texture::active[16] = { 0 };
+
+	/// <summary>
+	/// Check if the texture has partially transparent pixels
+	/// </summary>
+	/// <returns>True if any pixel is partially transparent, false if every pixel is either opaque or fully transparent</returns>
+	bool Texture::IsTranslucent() const {
+		return translucent;
+	}
+
+	/// <summary>
+	/// Get the number of array layers
+	/// </summary>
+	/// <returns>Number of array layers (0 if not a texture array)</returns>
+	int Texture::GetArrayLayers() const {
+		return arrayLayers;
+	}
+
+	/// <summary>
+	/// Check an image for partially transparent pixels
+	/// </summary>
+	/// <param name="image">Image</param>
+	/// <returns>True if any pixel is partially transparent, false if not</returns>
+	bool Texture::HasTranslucentPixels(const Image& image) {
+		// Textures without any can be drawn as opaque in depth ordering mode, with the transparent pixels discarded
+		int count = image.size.w * image.size.h;
+		for (int i = 0; i < count; ++i) {
+			float alpha = image.pixels[i].a;
+			if (alpha > 0 && alpha < 1) {
+				return true;
+			}
+		}
+		return false;
+	}
 
 	/// <summary>
 	/// Draw texture as a sprite
@@ -29,6 +62,31 @@ namespace Violet {
 	/// <param name="bounds">Texture boundaries</param>
 	/// <param name="spriteParams">Sprite draw parameters</param>
 	void Texture::Draw(TextureFilter filter, Rect<float> bounds, SpriteParams spriteParams) {
+		Draw(filter, 0, bounds, spriteParams);
+	}
+
+	/// <summary>
+	/// Draw a texture array layer as a sprite
+	/// </summary>
+	/// <param name="filter">Texture filter</param>
+	/// <param name="arrayLayer">Array layer</param>
+	/// <param name="spriteParams">Sprite draw parameters</param>
+	void Texture::Draw(TextureFilter filter, const int arrayLayer, SpriteParams spriteParams) {
+		Draw(filter, arrayLayer, { 0, 0, size.w, size.h }, spriteParams);
+	}
+
+	/// <summary>
+	/// Draw a texture array layer as a sprite
+	/// </summary>
+	/// <param name="filter">Texture filter</param>
+	/// <param name="arrayLayer">Array layer</param>
+	/// <param name="bounds">Texture boundaries</param>
+	/// <param name="spriteParams">Sprite draw parameters</param>
+	void Texture::Draw(TextureFilter filter, const int arrayLayer, Rect<float> bounds, SpriteParams spriteParams) {
+		if (arrayLayer < 0 || arrayLayer >= Math::Max(arrayLayers, 1)) {
+			Engine::Error("Invalid texture array layer \"" + std::to_string(arrayLayer) + "\".");
+		}
+
 		std::shared_ptr<std::vector<TextureBind>> textureBinds = std::make_shared<std::vector<TextureBind>>();
 		textureBinds->push_back({ shared_from_this(), 0, filter });
 		
@@ -42,6 +100,7 @@ namespace Violet {
 			spriteParams.color,
 			spriteParams.shader,
 			spriteParams.userData };
+		sprite.arrayLayer = arrayLayer;
 
 		Graphics::AddSprite(textureBinds, sprite);
 	}
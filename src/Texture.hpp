@@ -14,8 +14,10 @@ namespace Violet {
 	class Texture : public std::enable_shared_from_this<Texture> {
 	public:
 		// Friend classes
+		friend class AssetWatcher;
 		friend class Engine;
 		friend class Graphics;
+		friend class RenderTarget;
 
 		/// <summary>
 		/// Texture destructor
@@ -28,6 +30,24 @@ namespace Violet {
 		/// <returns>Texture size</returns>
 		Size2D<int> GetSize();
 
+		/// <summary>
+		/// Check if the texture has partially transparent pixels
+		/// </summary>
+		/// <returns>True if any pixel is partially transparent, false if every pixel is either opaque or fully transparent</returns>
+		bool IsTranslucent() const;
+
+		/// <summary>
+		/// Get the number of array layers
+		/// </summary>
+		/// <returns>Number of array layers (0 if not a texture array)</returns>
+		int GetArrayLayers() const;
+
+		/// <summary>
+		/// Replace the texture's image in place (the wrap mode is kept, and texture arrays can't be reloaded)
+		/// </summary>
+		/// <param name="image">Image</param>
+		void Reload(std::shared_ptr<Image> image);
+
 		/// <summary>
 		/// Draw texture as a sprite
 		/// </summary>
@@ -44,6 +64,23 @@ namespace Violet {
 		/// <param name="spriteParams">Sprite draw parameters</param>
 		void Draw(TextureFilter filter, Rect<float> bounds, SpriteParams spriteParams);
 
+		/// <summary>
+		/// Draw a texture array layer as a sprite
+		/// </summary>
+		/// <param name="filter">Texture filter</param>
+		/// <param name="arrayLayer">Array layer</param>
+		/// <param name="spriteParams">Sprite draw parameters</param>
+		void Draw(TextureFilter filter, const int arrayLayer, SpriteParams spriteParams);
+
+		/// <summary>
+		/// Draw a texture array layer as a sprite
+		/// </summary>
+		/// <param name="filter">Texture filter</param>
+		/// <param name="arrayLayer">Array layer</param>
+		/// <param name="bounds">Texture boundaries</param>
+		/// <param name="spriteParams">Sprite draw parameters</param>
+		void Draw(TextureFilter filter, const int arrayLayer, Rect<float> bounds, SpriteParams spriteParams);
+
 	private:
 		/// <summary>
 		/// Texture unit
@@ -58,6 +95,11 @@ namespace Violet {
 			/// Filter
 			/// </summary>
 			TextureFilter filter;
+
+			/// <summary>
+			/// Texture array flag
+			/// </summary>
+			bool array;
 		};
 
 		/// <summary>
@@ -67,6 +109,40 @@ namespace Violet {
 		/// <param name="wrap">Wrap mode</param>
 		Texture(std::string fileName, TextureWrap wrap);
 
+		/// <summary>
+		/// Texture constructor
+		/// </summary>
+		/// <param name="image">Image</param>
+		/// <param name="wrap">Wrap mode</param>
+		Texture(std::shared_ptr<Image> image, TextureWrap wrap);
+
+		/// <summary>
+		/// Texture constructor
+		/// </summary>
+		/// <param name="images">Images (1 per layer, all the same size)</param>
+		/// <param name="wrap">Wrap mode</param>
+		/// <param name="array">Texture array flag</param>
+		Texture(const std::vector<std::shared_ptr<Image>>& images, TextureWrap wrap, const bool array);
+
+		/// <summary>
+		/// Upload image to the texture
+		/// </summary>
+		/// <param name="image">Image</param>
+		void Upload(std::shared_ptr<Image> image);
+
+		/// <summary>
+		/// Upload images to the texture array's layers
+		/// </summary>
+		/// <param name="images">Images</param>
+		void UploadArray(const std::vector<std::shared_ptr<Image>>& images);
+
+		/// <summary>
+		/// Check an image for partially transparent pixels
+		/// </summary>
+		/// <param name="image">Image</param>
+		/// <returns>True if any pixel is partially transparent, false if not</returns>
+		static bool HasTranslucentPixels(const Image& image);
+
 		/// <summary>
 		/// Set active
 		/// </summary>
@@ -106,9 +182,19 @@ namespace Violet {
 		Size2D<int> size;
 
 		/// <summary>
-		/// Active textures
+		/// Partially transparent pixel flag
+		/// </summary>
+		bool translucent{ true };
+
+		/// <summary>
+		/// Number of array layers (0 if not a texture array)
+		/// </summary>
+		int arrayLayers{ 0 };
+
+		/// <summary>
+		/// Active textures (per thread, as each thread has its own context)
 		/// </summary>
-		static Unit active[16];
+		static thread_local Unit active[16];
 
 	};
 
@@ -0,0 +1,46 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#include "Violet.hpp"
+
+namespace Violet {
+
+	/// <summary>
+	/// Set data (uploaded the next time the buffer is set active, if it changed)
+	/// </summary>
+	/// <param name="offset">Offset</param>
+	/// <param name="size">Size</param>
+	/// <param name="data">Data</param>
+	void UniformBuffer::SetData(const int offset, const int size, const void* data) {
+		if (offset < 0 || size < 0 || offset + size > static_cast<int>(this->data.size())) {
+			Engine::Error("Invalid uniform buffer range \"" + std::to_string(offset) + ", " + std::to_string(size) + "\".");
+		}
+
+		// Only mark data that actually changed
+		U8* dest = this->data.data() + offset;
+		if (memcmp(dest, data, size) == 0) {
+			return;
+		}
+		memcpy(dest, data, size);
+
+		if (dirtyEnd <= dirtyStart) {
+			dirtyStart = offset;
+			dirtyEnd = offset + size;
+		}
+		else {
+			dirtyStart = Math::Min(dirtyStart, offset);
+			dirtyEnd = Math::Max(dirtyEnd, offset + size);
+		}
+	}
+
+	/// <summary>
+	/// Get binding point
+	/// </summary>
+	/// <returns>Binding point</returns>
+	int UniformBuffer::GetBinding() const {
+		return binding;
+	}
+
+}
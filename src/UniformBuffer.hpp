@@ -0,0 +1,80 @@
+/******************************************************************/
+/* Violet Engine                                                  */
+/* (C) Devon Artmeier 2022                                        */
+/******************************************************************/
+
+#ifndef VIOLET_UNIFORM_BUFFER_HPP
+#define VIOLET_UNIFORM_BUFFER_HPP
+
+namespace Violet {
+
+	/// <summary>
+	/// Uniform buffer (data laid out by std140 rules, shared by every shader with a matching uniform block)
+	/// </summary>
+	class UniformBuffer {
+	public:
+		// Friend classes
+		friend class Engine;
+		friend class Graphics;
+
+		/// <summary>
+		/// Uniform buffer destructor
+		/// </summary>
+		~UniformBuffer();
+
+		/// <summary>
+		/// Set data (uploaded the next time the buffer is set active, if it changed)
+		/// </summary>
+		/// <param name="offset">Offset</param>
+		/// <param name="size">Size</param>
+		/// <param name="data">Data</param>
+		void SetData(const int offset, const int size, const void* data);
+
+		/// <summary>
+		/// Set active (uploads changed data and binds the buffer to its binding point)
+		/// </summary>
+		void SetActive();
+
+		/// <summary>
+		/// Get binding point
+		/// </summary>
+		/// <returns>Binding point</returns>
+		int GetBinding() const;
+
+	private:
+		/// <summary>
+		/// Uniform buffer constructor
+		/// </summary>
+		/// <param name="size">Size</param>
+		/// <param name="binding">Binding point</param>
+		UniformBuffer(const int size, const int binding);
+
+		/// <summary>
+		/// Buffer ID
+		/// </summary>
+		Ptr id{ 0 };
+
+		/// <summary>
+		/// Binding point
+		/// </summary>
+		int binding{ 0 };
+
+		/// <summary>
+		/// Buffer data
+		/// </summary>
+		std::vector<U8> data;
+
+		/// <summary>
+		/// Start of the data changed since the last upload
+		/// </summary>
+		int dirtyStart{ 0 };
+
+		/// <summary>
+		/// End of the data changed since the last upload
+		/// </summary>
+		int dirtyEnd{ 0 };
+	};
+
+}
+
+#endif // VIOLET_UNIFORM_BUFFER_HPP
@@ -8,8 +8,18 @@
 namespace Violet {
 
 	/// <summary>
-	/// Active vertex buffer
+	/// Active vertex buffer (per thread, as each thread has its own context)
 	/// </summary>
-	VertexBuffer* VertexBuffer::active = nullptr;
+	thread_local VertexBuffer* VertexBuffer::active = nullptr;
+
+	/// <summary>
+	/// Render thread vertex arrays left to delete
+	/// </summary>
+	std::vector<Ptr> VertexBuffer::orphans;
+
+	/// <summary>
+	/// Orphaned vertex array mutex
+	/// </summary>
+	std::mutex VertexBuffer::orphanMutex;
 
 }
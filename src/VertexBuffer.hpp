@@ -79,11 +79,41 @@ namespace Violet {
 		/// </summary>
 		static void Unset();
 
+		/// <summary>
+		/// Set up attribute pointers for the currently bound vertex array
+		/// </summary>
+		void SetupAttributes();
+
+		/// <summary>
+		/// Delete render thread vertex arrays of destroyed vertex buffers
+		/// </summary>
+		static void DeleteOrphans();
+
+		/// <summary>
+		/// Vertex attribute
+		/// </summary>
+		struct Attribute {
+			/// <summary>
+			/// Attribute type
+			/// </summary>
+			AttribType type;
+
+			/// <summary>
+			/// Attribute size
+			/// </summary>
+			int size;
+		};
+
 		/// <summary>
 		/// Buffer ID
 		/// </summary>
 		Ptr id{ 0 };
 
+		/// <summary>
+		/// Render thread vertex array ID (vertex arrays aren't shared between contexts)
+		/// </summary>
+		Ptr renderID{ 0 };
+
 		/// <summary>
 		/// Buffer data ID
 		/// </summary>
@@ -105,19 +135,24 @@ namespace Violet {
 		int vertexSize{ 0 };
 
 		/// <summary>
-		/// Attribute count
+		/// Attributes
+		/// </summary>
+		std::vector<Attribute> attributes;
+
+		/// <summary>
+		/// Active vertex buffer (per thread, as each thread has its own context)
 		/// </summary>
-		int attribCount{ 0 };
+		static thread_local VertexBuffer* active;
 
 		/// <summary>
-		/// Attribute pointer
+		/// Render thread vertex arrays left to delete
 		/// </summary>
-		Ptr attribPtr{ 0 };
+		static std::vector<Ptr> orphans;
 
 		/// <summary>
-		/// Active vertex buffer
+		/// Orphaned vertex array mutex
 		/// </summary>
-		static VertexBuffer* active;
+		static std::mutex orphanMutex;
 	};
 
 }
@@ -12,16 +12,31 @@ namespace Violet {
 	/// </summary>
 	class Actor;
 
+	/// <summary>
+	/// Allocation tracker
+	/// </summary>
+	class AllocTracker;
+
 	/// <summary>
 	/// Application
 	/// </summary>
 	class App;
 
+	/// <summary>
+	/// Asset watcher
+	/// </summary>
+	class AssetWatcher;
+
 	/// <summary>
 	/// Binary file
 	/// </summary>
 	class BinaryFile;
 
+	/// <summary>
+	/// Camera
+	/// </summary>
+	class Camera;
+
 	/// <summary>
 	/// Engine
 	/// </summary>
@@ -37,21 +52,51 @@ namespace Violet {
 	/// </summary>
 	class Graphics;
 
+	/// <summary>
+	/// Image
+	/// </summary>
+	class Image;
+
 	/// <summary>
 	/// Map
 	/// </summary>
 	class Map;
 
+	/// <summary>
+	/// Post processing shader
+	/// </summary>
+	class PostShader;
+
+	/// <summary>
+	/// Render target
+	/// </summary>
+	class RenderTarget;
+
+	/// <summary>
+	/// Resampler
+	/// </summary>
+	class Resampler;
+
 	/// <summary>
 	/// Scene
 	/// </summary>
 	class Scene;
 
+	/// <summary>
+	/// Screen shader
+	/// </summary>
+	class ScreenShader;
+
 	/// <summary>
 	/// Shader
 	/// </summary>
 	class Shader;
 
+	/// <summary>
+	/// Shader cache
+	/// </summary>
+	class ShaderCache;
+
 	/// <summary>
 	/// Shell
 	/// </summary>
@@ -77,11 +122,21 @@ namespace Violet {
 	/// </summary>
 	class SpriteShader;
 
+	/// <summary>
+	/// Texture
+	/// </summary>
+	class Texture;
+
 	/// <summary>
 	/// Timer
 	/// </summary>
 	class Timer;
 
+	/// <summary>
+	/// Uniform buffer
+	/// </summary>
+	class UniformBuffer;
+
 	/// <summary>
 	/// Vertex buffer
 	/// </summary>
@@ -91,38 +146,83 @@ namespace Violet {
 #ifdef VIOLET_SHELL_SDL2
 #include <SDL.h>
 #endif
+#ifdef VIOLET_SHELL_HEADLESS
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
 #ifdef VIOLET_GRAPHICS_OPENGL
 #include <glad/glad.h>
 #endif
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <chrono>
+#include <cerrno>
+#include <condition_variable>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <initializer_list>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <string>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#ifndef _WIN32
+/// <summary>
+/// Open a file (fopen_s is only provided by the Windows C runtime)
+/// </summary>
+/// <param name="fp">Pointer to store the file pointer in</param>
+/// <param name="fileName">File name</param>
+/// <param name="mode">Open mode</param>
+/// <returns>0 if successful, error code if not</returns>
+inline int fopen_s(FILE** fp, const char* fileName, const char* mode) {
+	*fp = fopen(fileName, mode);
+	return *fp ? 0 : errno;
+}
+#endif
+
 #include "Types.hpp"
 #include "Math.hpp"
+#include "AllocTracker.hpp"
 #include "Message.hpp"
 #include "BinaryFile.hpp"
 #include "Timer.hpp"
 #include "Input.hpp"
+#include "InputRecorder.hpp"
 #include "Image.hpp"
 #include "SpriteDraw.hpp"
 #include "Texture.hpp"
 #include "VertexBuffer.hpp"
+#include "UniformBuffer.hpp"
+#include "RenderTarget.hpp"
+#include "ShaderCache.hpp"
 #include "Shader.hpp"
 #include "SpriteShader.hpp"
+#include "ScreenShader.hpp"
+#include "PostShader.hpp"
+#include "AssetWatcher.hpp"
 #include "Sheet.hpp"
+#include "Camera.hpp"
 #include "Graphics.hpp"
+#include "Resampler.hpp"
 #include "SoundSource.hpp"
 #include "SoundSourceOgg.hpp"
+#include "SoundSourceOpus.hpp"
+#include "SoundSourceWAV.hpp"
 #include "Sound.hpp"
 #include "Map.hpp"
 #include "Actor.hpp"